@@ -0,0 +1,387 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include "cshllink.h"
+
+/*
+    usage: bench [file.lnk] [iterations]
+
+    measures the mean latency of loading and serializing a shell link
+*/
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+//counting allocator (heap calls made by the library)
+static long heapCalls = 0;
+static void *countAlloc(void *user, size_t size) {
+    heapCalls++;
+    return malloc(size);
+}
+static void *countRealloc(void *user, void *ptr, size_t size) {
+    heapCalls++;
+    return realloc(ptr, size);
+}
+static void countFree(void *user, void *ptr) {
+    heapCalls++;
+    free(ptr);
+}
+static const cshllink_allocator counting = {countAlloc, countRealloc, countFree, NULL};
+
+int main(int argc, char **argv) {
+
+    const char *path = argc>1 ? argv[1] : "../exmpl/test1.lnk";
+    long iter = argc>2 ? atol(argv[2]) : 100000;
+
+    FILE *fp = fopen(path, "rb");
+    if(fp==NULL) {
+        printf("ERR OPEN %s\n", path);
+        return 1;
+    }
+
+    //loadFile (open FILE, includes parse and free)
+    {
+        cshllink LNK = {0};
+        double start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_loadFile(fp, &LNK)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+            cshllink_free(&LNK);
+        }
+        printf("%-24s %10.1f ns/file\n", "loadFile", (now()-start)/iter);
+
+        //heap calls of loadFile + free
+        cshllink_setAllocator(&counting);
+        heapCalls = 0;
+        if(cshllink_loadFile(fp, &LNK)==255) {
+            printf("ERR READ 0x%x\n", cshllink_error);
+            return 1;
+        }
+        cshllink_free(&LNK);
+        cshllink_setAllocator(NULL);
+        printf("%-24s %10ld heap calls/file\n", "loadFile", heapCalls);
+    }
+
+    //loadFileArena (one arena reused, released with a reset)
+    {
+        cshllink LNK = {0};
+        cshllink_arena arena;
+        cshllink_setAllocator(&counting);
+        heapCalls = 0;
+        cshllink_arena_init(&arena, 0);
+        double start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_loadFileArena(fp, &LNK, &arena)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+            cshllink_arena_reset(&arena);
+        }
+        printf("%-24s %10.1f ns/file\n", "loadFileArena", (now()-start)/iter);
+        printf("%-24s %10.4f heap calls/file\n", "loadFileArena", (double)heapCalls/iter);
+        cshllink_arena_free(&arena);
+        cshllink_setAllocator(NULL);
+    }
+
+    //loadBuffer / loadView (file already in memory)
+    {
+        uint8_t *buf = malloc(1<<16);
+        fseek(fp, 0, SEEK_SET);
+        size_t size = fread(buf, 1, 1<<16, fp);
+        cshllink LNK = {0};
+
+        double start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_loadBuffer(buf, size, &LNK)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+            cshllink_free(&LNK);
+        }
+        printf("%-24s %10.1f ns/file\n", "loadBuffer", (now()-start)/iter);
+
+        //reloadBuffer (same structure, buffers kept in a pool by cshllink_reset)
+        cshllink_pool POOL = {0};
+        cshllink_setAllocator(&counting);
+        start = now();
+        for(long i=0; i<iter; i++) {
+            if(i==1)
+                heapCalls = 0;
+            if(cshllink_reloadBuffer(buf, size, &LNK, &POOL)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+        }
+        printf("%-24s %10.1f ns/file\n", "reloadBuffer", (now()-start)/iter);
+        printf("%-24s %10.4f heap calls/file\n", "reloadBuffer", (double)heapCalls/(iter-1));
+        cshllink_free(&LNK);
+        cshllink_pool_free(&POOL);
+        cshllink_setAllocator(NULL);
+
+        start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_loadView(buf, size, &LNK)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+            cshllink_free(&LNK);
+        }
+        printf("%-24s %10.1f ns/file\n", "loadView", (now()-start)/iter);
+
+        //loadBufferSkip (LinkInfo and StringData only)
+        start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_loadBufferSkip(buf, size, &LNK, CSHLLINK_SEC_LINKTARGETIDLIST|CSHLLINK_SEC_EXTRADATA)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+            cshllink_free(&LNK);
+        }
+        printf("%-24s %10.1f ns/file\n", "loadBufferSkip", (now()-start)/iter);
+
+        //loadViewSkip (ExtraDataBlocks decoded on first access, written back verbatim)
+        start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_loadViewSkip(buf, size, &LNK, CSHLLINK_SEC_EDBLKS)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+            cshllink_free(&LNK);
+        }
+        printf("%-24s %10.1f ns/file\n", "loadViewSkip (lazy)", (now()-start)/iter);
+
+        //loadHeader (ShellLinkHeader only)
+        struct _cshllink_header header;
+        start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_loadHeader(buf, size, &header)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+        }
+        printf("%-24s %10.1f ns/file\n", "loadHeader", (now()-start)/iter);
+
+        //toCompact / fromCompact (resident size of a parsed link)
+        {
+            cshllink_compact compact;
+            double tcompact = 0, texpand = 0;
+            size_t resident = 0;
+            for(long i=0; i<iter; i++) {
+                if(cshllink_loadBuffer(buf, size, &LNK)==255) {
+                    printf("ERR READ 0x%x\n", cshllink_error);
+                    return 1;
+                }
+                start = now();
+                if(cshllink_toCompact(&LNK, &compact)==255) {
+                    printf("ERR COMPACT 0x%x\n", cshllink_error);
+                    return 1;
+                }
+                tcompact += now()-start;
+                resident = sizeof compact + compact.cshllink_coldsize;
+                start = now();
+                cshllink_fromCompact(&compact, &LNK);
+                texpand += now()-start;
+                cshllink_free(&LNK);
+            }
+            printf("%-24s %10.1f ns/file\n", "toCompact", tcompact/iter);
+            printf("%-24s %10.1f ns/file\n", "fromCompact", texpand/iter);
+            printf("%-24s %10zu bytes/file\n", "cshllink", sizeof(cshllink));
+            printf("%-24s %10zu bytes/file\n", "cshllink_compact", resident);
+        }
+
+        //writeBuffer (serialize an already parsed link)
+        if(cshllink_loadBuffer(buf, size, &LNK)==255) {
+            printf("ERR READ 0x%x\n", cshllink_error);
+            return 1;
+        }
+        uint8_t *out = malloc(cshllink_serializedSize(&LNK));
+        start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_writeBuffer(&LNK, out, cshllink_serializedSize(&LNK), NULL)==255) {
+                printf("ERR WRITE 0x%x\n", cshllink_error);
+                return 1;
+            }
+        }
+        printf("%-24s %10.1f ns/file\n", "writeBuffer", (now()-start)/iter);
+
+        //writeBuffer (view with cshllink_trackDirty: unmodified sections copied from the input)
+        {
+            cshllink VIEW = {0};
+            if(cshllink_loadView(buf, size, &VIEW)==255 || cshllink_trackDirty(&VIEW)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+            start = now();
+            for(long i=0; i<iter; i++) {
+                if(cshllink_writeBuffer(&VIEW, out, cshllink_serializedSize(&VIEW), NULL)==255) {
+                    printf("ERR WRITE 0x%x\n", cshllink_error);
+                    return 1;
+                }
+            }
+            printf("%-24s %10.1f ns/file\n", "writeBuffer (tracked)", (now()-start)/iter);
+            cshllink_free(&VIEW);
+        }
+        free(out);
+
+        //writeFile / writeFd (rewrite of the same temporary file)
+        char tmpPath[] = "/tmp/cshllink_benchXXXXXX";
+        int fd = mkstemp(tmpPath);
+        FILE *tfp = fdopen(fd, "w+b");
+        if(tfp==NULL) {
+            printf("ERR OPEN %s\n", tmpPath);
+            return 1;
+        }
+        start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_writeFile(tfp, &LNK)==255) {
+                printf("ERR WRITE 0x%x\n", cshllink_error);
+                return 1;
+            }
+            fflush(tfp);
+        }
+        printf("%-24s %10.1f ns/file\n", "writeFile", (now()-start)/iter);
+
+        start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_writeFd(fd, &LNK)==255) {
+                printf("ERR WRITE 0x%x\n", cshllink_error);
+                return 1;
+            }
+        }
+        printf("%-24s %10.1f ns/file\n", "writeFd", (now()-start)/iter);
+        fclose(tfp);
+        unlink(tmpPath);
+        cshllink_free(&LNK);
+        free(buf);
+    }
+
+    fclose(fp);
+
+    //loadPath (mmap, copy, unmap)
+    {
+        cshllink LNK = {0};
+        double start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_loadPath(path, &LNK)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+            cshllink_free(&LNK);
+        }
+        printf("%-24s %10.1f ns/file\n", "loadPath", (now()-start)/iter);
+    }
+
+    //loadMapped (mapping kept, strings borrowed)
+    {
+        cshllink LNK = {0};
+        double start = now();
+        for(long i=0; i<iter; i++) {
+            if(cshllink_loadMapped(path, &LNK, 1)==255) {
+                printf("ERR READ 0x%x\n", cshllink_error);
+                return 1;
+            }
+            cshllink_free(&LNK);
+        }
+        printf("%-24s %10.1f ns/file\n", "loadMapped (keep)", (now()-start)/iter);
+    }
+
+    //string kernels (260 character path: NUL search in the input, strlen16 of a field, +1: misaligned)
+    {
+        static char ansi[261];
+        static uint8_t str[2*261+1];
+        memset(ansi, 'a', 260);
+        for(int i=0; i<260; i++)
+            str[2*i] = 'a' + i%26;
+        #ifdef _CSHLLINK_SIMD_X86
+            size_t (*scan16[])(const uint8_t *, size_t) = {_cshllink_scan16Scalar, _cshllink_scan16SSE2, _cshllink_scan16AVX2};
+            size_t (*len16[])(const char16_t *) = {_cshllink_strlen16Scalar, _cshllink_strlen16SSE2, _cshllink_strlen16AVX2};
+            const char *names[] = {"scalar", "SSE2", "AVX2"};
+            int kernels = 1 + _cshllink_simdLevel();
+        #else
+            size_t (*scan16[])(const uint8_t *, size_t) = {_cshllink_scan16Scalar};
+            size_t (*len16[])(const char16_t *) = {_cshllink_strlen16Scalar};
+            const char *names[] = {"scalar"};
+            int kernels = 1;
+        #endif
+        volatile size_t sink = 0;
+        char name[32];
+
+        double start = now();
+        for(long i=0; i<iter; i++)
+            sink += (const char *)memchr(ansi, 0, sizeof ansi) - ansi;
+        printf("%-24s %10.1f ns/string\n", "NUL scan 8-bit memchr", (now()-start)/iter);
+        for(int k=0; k<kernels; k++) {
+            start = now();
+            for(long i=0; i<iter; i++)
+                sink += scan16[k](str, 2*261);
+            snprintf(name, sizeof name, "NUL scan 16-bit %s", names[k]);
+            printf("%-24s %10.1f ns/string\n", name, (now()-start)/iter);
+        }
+        for(int mis=0; mis<2; mis++) {
+            // misaligned copy of the string
+            if(mis)
+                memmove(str+1, str, 2*261);
+            for(int k=0; k<kernels; k++) {
+                start = now();
+                for(long i=0; i<iter; i++)
+                    sink += len16[k]((const char16_t *)(str+mis));
+                snprintf(name, sizeof name, "strlen16 %s%s", names[k], mis ? " +1" : "");
+                printf("%-24s %10.1f ns/string\n", name, (now()-start)/iter);
+            }
+            if(mis)
+                memmove(str, str+1, 2*261);
+        }
+
+        //UTF-16 to UTF-8 (ASCII path, path with a non-ASCII character every 20 characters)
+        static char utf8[4*261];
+        for(int mixed=0; mixed<2; mixed++) {
+            if(mixed) {
+                for(int i=10; i<260; i+=20) {
+                    str[2*i] = 0xE4;
+                    str[2*i+1] = 0x00;
+                }
+            }
+            for(int k=0; k<kernels; k++) {
+                start = now();
+                for(long i=0; i<iter; i++) {
+                    size_t written;
+                    _cshllink_utf16ToUtf8Level((const char16_t *)str, 260, utf8, sizeof utf8, &written, k);
+                    sink += written;
+                }
+                snprintf(name, sizeof name, "toUtf8 %s %s", mixed ? "mixed" : "ascii", names[k]);
+                printf("%-24s %10.1f ns/string\n", name, (now()-start)/iter);
+            }
+        }
+
+        //cp1252 to UTF-16 / UTF-8 (ASCII path, path with a non-ASCII character every 20 characters)
+        static char16_t utf16[261];
+        for(int mixed=0; mixed<2; mixed++) {
+            if(mixed) {
+                for(int i=10; i<260; i+=20)
+                    ansi[i] = (char)0xE4;
+            }
+            for(int utf8out=0; utf8out<2; utf8out++) {
+                for(int k=0; k<kernels; k++) {
+                    start = now();
+                    for(long i=0; i<iter; i++) {
+                        size_t written;
+                        _cshllink_ansiDecodeLevel((const uint8_t *)ansi, 260, 1252, utf8out ? (void *)utf8 : (void *)utf16, utf8out ? sizeof utf8 : 261, &written, utf8out, k);
+                        sink += written;
+                    }
+                    snprintf(name, sizeof name, "ansiTo%s %s %s", utf8out ? "Utf8" : "Utf16", mixed ? "mixed" : "ascii", names[k]);
+                    printf("%-24s %10.1f ns/string\n", name, (now()-start)/iter);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
@@ -26,11 +26,14 @@ int main(void) {
     FILE *fp1 = fopen("../exmpl/test1.lnk", "rb+");
     FILE *fp2 = fopen("../exmpl/test2.lnk", "rb+");
 
-    if(cshllink_loadFile(fp1, &LNK1)==255) {
+    // keep the input: the sections not changed below are written back byte for byte
+    cshllink_ctx ctx = {0};
+    ctx.track = 1;
+    if(cshllink_loadFileCtx(fp1, &LNK1, &ctx)==255) {
         printf("ERR READ 1 0x%x\n", cshllink_error);
         return 0;
     }
-    if(cshllink_loadFile(fp2, &LNK2)==255) {
+    if(cshllink_loadFileCtx(fp2, &LNK2, &ctx)==255) {
         printf("ERR READ 2 0x%x\n", cshllink_error);
         return 0;
     }
@@ -13,10 +13,285 @@
 #include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#else
+    #include <io.h>
+#endif
+#ifdef _CSHLLINK_SIMD_X86
+    #include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif !defined(__GNUC__)
+    #include <stdatomic.h>
+#endif
+
+	// last error code (per thread)
+    _CSHLLINK_TLS uint8_t cshllink_error=0;
+    // error context of the last failed call (per thread)
+    static _CSHLLINK_TLS cshllink_ctx _cshllink_threadctx;
+
+    /*
+        <- error context of the last failed call of the calling thread
+    */
+    const cshllink_ctx *cshllink_lastError(void) {
+        return &_cshllink_threadctx;
+    }
+
+    /*
+        set the error code of the calling thread (cshllink_error and the thread context, position cleared)
+    */
+    void _cshllink_seterr(uint8_t error) {
+        cshllink_error = error;
+        _cshllink_threadctx.error = error;
+        _cshllink_threadctx.offset = 0;
+        _cshllink_threadctx.section = 0;
+    }
+
+    /*
+        record the position of the last error in the thread context and ctx (may be NULL)
+    */
+    void _cshllink_errpos(cshllink_ctx *ctx, size_t offset, uint32_t section) {
+        _cshllink_threadctx.offset = offset;
+        _cshllink_threadctx.section = section;
+        if(ctx!=NULL) {
+            ctx->offset = offset;
+            ctx->section = section;
+        }
+    }
+
+    /*
+        start / finish a call with an explicit context (ctx may be NULL)
+    */
+    void _cshllink_ctxBegin(cshllink_ctx *ctx) {
+        if(ctx==NULL)
+            return;
+        // the allocator is an input of the call
+        ctx->error = 0;
+        ctx->offset = 0;
+        ctx->section = 0;
+    }
+    uint8_t _cshllink_ctxEnd(cshllink_ctx *ctx, uint8_t ret) {
+        if(ctx!=NULL && ret!=0) {
+            ctx->error = cshllink_error;
+            // failed before parsing / serializing started
+            if(ctx->section==0)
+                ctx->offset = 0;
+        }
+        return ret;
+    }
+
+    /*
+        default allocator (malloc / realloc / free)
+    */
+    void *_cshllink_libcAlloc(void *user, size_t size) {
+        (void)user;
+        return malloc(size);
+    }
+    void *_cshllink_libcRealloc(void *user, void *ptr, size_t size) {
+        (void)user;
+        return realloc(ptr, size);
+    }
+    void _cshllink_libcFree(void *user, void *ptr) {
+        (void)user;
+        free(ptr);
+    }
+    static const cshllink_allocator _cshllink_libcallocator = {_cshllink_libcAlloc, _cshllink_libcRealloc, _cshllink_libcFree, NULL};
+    static const cshllink_allocator *_cshllink_globalallocator = &_cshllink_libcallocator;
+
+    /*
+        -> allocator used by all following loads without an explicit context (NULL restores malloc / realloc / free)
+        -- the allocator must stay valid as long as structures loaded with it exist, install it before any structure is created
+    */
+    void cshllink_setAllocator(const cshllink_allocator *allocator) {
+        _cshllink_globalallocator = allocator!=NULL ? allocator : &_cshllink_libcallocator;
+    }
+
+    /*
+        <- current global allocator (never NULL)
+    */
+    const cshllink_allocator *cshllink_getAllocator(void) {
+        return _cshllink_globalallocator;
+    }
+
+    /*
+        allocate / resize / release through allocator (NULL: global allocator)
+    */
+    void *_cshllink_alloc(const cshllink_allocator *allocator, size_t size) {
+        if(allocator==NULL)
+            allocator = _cshllink_globalallocator;
+        return allocator->alloc(allocator->user, size);
+    }
+    void *_cshllink_realloc(const cshllink_allocator *allocator, void *ptr, size_t size) {
+        if(allocator==NULL)
+            allocator = _cshllink_globalallocator;
+        return allocator->realloc(allocator->user, ptr, size);
+    }
+    void _cshllink_dealloc(const cshllink_allocator *allocator, void *ptr) {
+        if(ptr==NULL)
+            return;
+        if(allocator==NULL)
+            allocator = _cshllink_globalallocator;
+        // arena: released as a whole
+        if(allocator->free!=NULL)
+            allocator->free(allocator->user, ptr);
+    }
+
+    /*
+        allocator of a call with context ctx (may be NULL), never NULL
+    */
+    const cshllink_allocator *_cshllink_allocator(const cshllink_ctx *ctx) {
+        if(ctx!=NULL && ctx->allocator!=NULL)
+            return ctx->allocator;
+        return _cshllink_globalallocator;
+    }
+
+    /*
+        -> arena
+        -> initial capacity in bytes (0: first block allocated by the first load)
+        -- initializes the arena, blocks come from the current global allocator
+        <- on error this function will return -1, on success 0
+    */
+    uint8_t cshllink_arena_init(cshllink_arena *arena, size_t capacity) {
+        if(arena==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        cshllink_arena tmp = {{_cshllink_arenaAlloc, _cshllink_arenaRealloc, NULL, NULL}};
+        *arena = tmp;
+        arena->allocator.user = arena;
+        arena->backing = cshllink_getAllocator();
+        if(capacity!=0)
+            return _cshllink_arenaGrow(arena, capacity);
+        return 0;
+    }
+
+    /*
+        -> arena
+        -> number of bytes
+        -- makes sure the next "size" bytes can be allocated without adding a block
+        <- on error this function will return -1, on success 0
+    */
+    uint8_t cshllink_arena_reserve(cshllink_arena *arena, size_t size) {
+        if(arena==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        if(arena->block!=NULL && arena->block->size-arena->used>=size)
+            return 0;
+        return _cshllink_arenaGrow(arena, size);
+    }
+
+    /*
+        -> arena
+        -- releases all memory allocated from the arena in O(1) (older blocks are returned, the newest is reused)
+        structures loaded with the arena must not be used afterwards (cshllink_free is not needed)
+    */
+    void cshllink_arena_reset(cshllink_arena *arena) {
+        if(arena==NULL || arena->block==NULL)
+            return;
+        struct _cshllink_arenablk *blk = arena->block->prev;
+        while(blk!=NULL) {
+            struct _cshllink_arenablk *prev = blk->prev;
+            _cshllink_dealloc(arena->backing, blk);
+            blk = prev;
+        }
+        arena->block->prev = NULL;
+        arena->used = 0;
+    }
+
+    /*
+        -> arena
+        -- returns all blocks to the backing allocator
+    */
+    void cshllink_arena_free(cshllink_arena *arena) {
+        if(arena==NULL)
+            return;
+        cshllink_arena_reset(arena);
+        _cshllink_dealloc(arena->backing, arena->block);
+        arena->block = NULL;
+        arena->used = 0;
+    }
+
+    /*
+        arena allocator functions (user is the arena), each allocation is preceded by its size
+    */
+    void *_cshllink_arenaAlloc(void *user, size_t size) {
+        cshllink_arena *arena = user;
+        size_t need = _CSHLLINK_ARENA_ALIGN + ((size+_CSHLLINK_ARENA_ALIGN-1)&~(size_t)(_CSHLLINK_ARENA_ALIGN-1));
+        if(cshllink_arena_reserve(arena, need))
+            return NULL;
+        uint8_t *ptr = (uint8_t *)(arena->block+1) + arena->used + _CSHLLINK_ARENA_ALIGN;
+        ((size_t *)ptr)[-1] = size;
+        arena->used += need;
+        return ptr;
+    }
+    void *_cshllink_arenaRealloc(void *user, void *ptr, size_t size) {
+        cshllink_arena *arena = user;
+        if(ptr==NULL)
+            return _cshllink_arenaAlloc(user, size);
+
+        size_t oldsize = ((size_t *)ptr)[-1];
+        size_t rsize = (size+_CSHLLINK_ARENA_ALIGN-1)&~(size_t)(_CSHLLINK_ARENA_ALIGN-1);
+        uintptr_t start = (uintptr_t)(arena->block+1);
+        uintptr_t end = start + arena->used;
+        // last allocation of the newest block: resize in place
+        if((uintptr_t)ptr>start && (uintptr_t)ptr<=end && (uintptr_t)ptr+((oldsize+_CSHLLINK_ARENA_ALIGN-1)&~(size_t)(_CSHLLINK_ARENA_ALIGN-1))==end
+            && (uintptr_t)ptr-start+rsize<=arena->block->size) {
+            arena->used = (uintptr_t)ptr-start+rsize;
+            ((size_t *)ptr)[-1] = size;
+            return ptr;
+        }
+        // shrinking elsewhere keeps the allocation
+        if(size<=oldsize)
+            return ptr;
+
+        void *tmp = _cshllink_arenaAlloc(user, size);
+        if(tmp==NULL)
+            return NULL;
+        memcpy(tmp, ptr, oldsize);
+        return tmp;
+    }
+
+    /*
+        add a block of at least "size" usable bytes
+    */
+    uint8_t _cshllink_arenaGrow(cshllink_arena *arena, size_t size) {
+        // at least double the newest block so repeated growth stays rare
+        size_t bsize = size;
+        if(arena->block!=NULL && arena->block->size*2>bsize)
+            bsize = arena->block->size*2;
+        struct _cshllink_arenablk *blk = _cshllink_alloc(arena->backing, sizeof *blk + bsize);
+        if(blk==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        blk->size = bsize;
+        blk->prev = arena->block;
+        // an unused newest block is replaced instead of kept
+        if(arena->block!=NULL && arena->used==0) {
+            blk->prev = arena->block->prev;
+            _cshllink_dealloc(arena->backing, arena->block);
+        }
+        arena->block = blk;
+        arena->used = 0;
+        arena->blocks++;
+        return 0;
+    }
+
+    /*
+        -> pool
+        -- returns all kept buffers to their allocator, the pool can be used again
+    */
+    void cshllink_pool_free(cshllink_pool *pool) {
+        if(pool==NULL)
+            return;
+        for(int i=0; i<pool->num; i++)
+            _cshllink_dealloc(pool->allocator, pool->spare[i].ptr);
+        pool->num = 0;
+    }
 
-	// last error code
-    uint8_t cshllink_error=0;
     /*
         -> open file descriptor of type FILE (R mode)
         -> cshllink structure pointer containing the FILE content
@@ -27,6 +302,22 @@
     */
     #pragma region loadFile
     uint8_t cshllink_loadFile(FILE *fp, cshllink *inputStruct) {
+        return cshllink_loadFileCtx(fp, inputStruct, NULL);
+    }
+
+    /*
+        same as cshllink_loadFile, the error code and position are also stored in ctx (may be NULL)
+        with ctx->track the input is kept for cshllink_trackDirty (an owned copy, released by cshllink_free)
+    */
+    uint8_t cshllink_loadFileCtx(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx) {
+        _cshllink_ctxBegin(ctx);
+        return _cshllink_ctxEnd(ctx, _cshllink_loadFileChecked(fp, inputStruct, ctx));
+    }
+
+    /*
+        argument checks of cshllink_loadFile
+    */
+    uint8_t _cshllink_loadFileChecked(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx) {
 
         // test if FILE is open
         if(fp==NULL) 
@@ -52,587 +343,1602 @@
         cshllink_free(inputStruct);
 
         // read FILE
-        return cshllink_loadFile_i(fp, inputStruct);
+        return _cshllink_loadFile(fp, inputStruct, ctx, NULL);
     }
-    
+
     /*
-        Processes inputFile
-    */
-    uint8_t cshllink_loadFile_i(FILE *fp, cshllink *inputStruct) {
-        
-        fseek(fp, 0, SEEK_SET);
+        -> pointer to a buffer containing the complete shell link
+        -> size of the buffer in bytes
+        -> cshllink structure pointer containing the buffer content
+        -- reads content, modifies cshllink structure (the buffer is not referenced after the call)
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
 
-        /*
-            HEADER
-        */
-       {
-            //HeaderSize
-            if(fread(&inputStruct->cshllink_header.HeaderSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            if(inputStruct->cshllink_header.HeaderSize!=0x4c)
-                _cshllink_errint(_CSHLLINK_ERR_WHEADS);
-            
-            //LinkCLSID
-            if(fread(&inputStruct->cshllink_header.LinkCLSID_L, 16, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            cshllink_sEndian(&inputStruct->cshllink_header.LinkCLSID_L, 16);
-            if(inputStruct->cshllink_header.LinkCLSID_H!=0x0114020000000000)
-                _cshllink_errint(_CSHLLINK_ERR_WCLSIDS);
-            if(inputStruct->cshllink_header.LinkCLSID_L!=0xC000000000000046)
-                _cshllink_errint(_CSHLLINK_ERR_WCLSIDS);
-
-            //LinkFlags
-            if(fread(&inputStruct->cshllink_header.LinkFlags, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //FileAttributes
-            if(fread(&inputStruct->cshllink_header.FileAttributes, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //CreationTime
-            if(fread(&inputStruct->cshllink_header.CreationTime, 8, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            //AccessTime
-            if(fread(&inputStruct->cshllink_header.AccessTime, 8, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            //WriteTime
-            if(fread(&inputStruct->cshllink_header.WriteTime, 8, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadBuffer(const uint8_t *data, size_t size, cshllink *inputStruct) {
+        return _cshllink_loadBuffer(data, size, inputStruct, 0, 0, NULL);
+    }
 
-            //FileSize
-            if(fread(&inputStruct->cshllink_header.FileSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        same as cshllink_loadBuffer, the error code and position are also stored in ctx (may be NULL)
+        with ctx->track the input is kept for cshllink_trackDirty (an owned copy, released by cshllink_free)
+    */
+    uint8_t cshllink_loadBufferCtx(const uint8_t *data, size_t size, cshllink *inputStruct, cshllink_ctx *ctx) {
+        _cshllink_ctxBegin(ctx);
+        return _cshllink_ctxEnd(ctx, _cshllink_loadBuffer(data, size, inputStruct, 0, 0, ctx));
+    }
 
-            //IconIndex
-            if(fread(&inputStruct->cshllink_header.IconIndex, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //ShowCommand
-            if(fread(&inputStruct->cshllink_header.ShowCommand, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        same as cshllink_loadFile / cshllink_loadBuffer, all fields are allocated from arena (released with cshllink_arena_reset)
+    */
+    uint8_t cshllink_loadFileArena(FILE *fp, cshllink *inputStruct, cshllink_arena *arena) {
+        if(arena==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        cshllink_ctx ctx = {0};
+        ctx.allocator = &arena->allocator;
+        return cshllink_loadFileCtx(fp, inputStruct, &ctx);
+    }
+    uint8_t cshllink_loadBufferArena(const uint8_t *data, size_t size, cshllink *inputStruct, cshllink_arena *arena) {
+        if(arena==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        cshllink_ctx ctx = {0};
+        ctx.allocator = &arena->allocator;
+        return cshllink_loadBufferCtx(data, size, inputStruct, &ctx);
+    }
 
-            //HotKey
-            if(fread(&inputStruct->cshllink_header.HotKey, 2, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        -> pointer to a buffer containing the complete shell link
+        -> size of the buffer in bytes
+        -> cshllink structure pointer containing the buffer content
+        -> skip: sections (CSHLLINK_SEC_*) and ExtraDataBlocks (CSHLLINK_SEC_EDBLK) not to decode
+        -- same as cshllink_loadBuffer; skipped sections are stepped over by their size fields and left zeroed
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
 
-            fseek(fp, 10, SEEK_CUR);
-        }
+        skipped sections are recorded in cshllink_skipped. The input is not kept, so writing such a structure fails with 0x2F (use cshllink_loadViewSkip and cshllink_trackDirty to write unmodified skipped sections back)
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadBufferSkip(const uint8_t *data, size_t size, cshllink *inputStruct, uint32_t skip) {
+        return _cshllink_loadBuffer(data, size, inputStruct, skip, 0, NULL);
+    }
+    
+    /*
+        -> pointer to a buffer containing the complete shell link
+        -> size of the buffer in bytes
+        -> cshllink structure pointer referencing the buffer content
+        -- reads content, modifies cshllink structure; string and blob fields (IDList items, LinkInfo strings, StringData UStrings, ExtraData strings and blobs) point into the buffer instead of being copied
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
 
-        /*
-            LinkTargetIDList
-        */
-        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkTargetIDList) {
-            //IDList size
-            if(fread(&inputStruct->cshllink_lnktidl.idl_size, 2, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        the buffer must outlive inputStruct (or until cshllink_detach). Borrowed fields are read-only, may be unaligned and keep their lengths in the existing size fields (idl_bloblen of an IDList blob, whose ItemIDs are located by the owned offset array idl_off, CountCharacters, BlockSize, ...)
+        setters detach the structure before modifying it. cshllink_free does not free borrowed fields
+        all ExtraDataBlocks are decoded while loading, lazy decoding is opt-in: pass them in the skip mask of cshllink_loadViewSkip
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadView(const uint8_t *data, size_t size, cshllink *inputStruct) {
+        return _cshllink_loadBuffer(data, size, inputStruct, 0, _CSHLLINK_SEC_VIEW, NULL);
+    }
 
-            int tmpS=inputStruct->cshllink_lnktidl.idl_size-2;
-            inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum=0;
+    /*
+        -> pointer to a buffer containing the complete shell link
+        -> size of the buffer in bytes
+        -> cshllink structure pointer referencing the buffer content
+        -> skip: sections (CSHLLINK_SEC_*) and ExtraDataBlocks (CSHLLINK_SEC_EDBLK) not to decode
+        -- same as cshllink_loadView; skipped sections are stepped over by their size fields and left zeroed
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
 
-            //realloc enough mem
-            inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item = realloc(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item, (tmpS)* sizeof *inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item);
-            if(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item==NULL) 
-                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+        skipped ExtraDataBlocks (e.g. CSHLLINK_SEC_EDBLKS) stay in the buffer: cshllink_getBlock decodes them on first access, the writers copy them verbatim
+        other skipped sections are only written back after cshllink_trackDirty and while unmodified, otherwise writing fails with 0x2F
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadViewSkip(const uint8_t *data, size_t size, cshllink *inputStruct, uint32_t skip) {
+        return _cshllink_loadBuffer(data, size, inputStruct, skip, _CSHLLINK_SEC_VIEW, NULL);
+    }
 
-            while(tmpS>0) {
-            
-                //Element size
-                if(fread(&inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum].item_size, 2, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                //Element (size -2 as struct contains one 2byte var)
-                inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum].item = malloc((inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum].item_size-2)* sizeof *inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum].item);
-                if(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum].item==NULL)
-                    _cshllink_errint(_CSHLLINK_ERR_NULLPIDLM);
-                if(fread(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum].item, inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum].item_size-2, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        Processes input buffer (shared by the buffer, view and mapped loaders)
+    */
+    uint8_t _cshllink_loadBuffer(const uint8_t *data, size_t size, cshllink *inputStruct, uint32_t skip, uint32_t borrow, cshllink_ctx *ctx) {
 
-                tmpS-=inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum].item_size;
-                inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum+=1;
-            }
-            //free unneccessary mem
-            inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item = realloc(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item, (inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum)* sizeof *inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item);
-            if(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item==NULL) 
-                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+        // test if buffer is present
+        if(data==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
 
-            uint16_t nullb;
-            if(fread(&nullb, 2, 1, fp)!=1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            if(tmpS<0||nullb!=0)
-                _cshllink_errint(_CSHLLINK_ERR_INVIDL);   
+        // clear inputStruct
+        if(inputStruct==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA)
+        {
+            cshllink tmp = {0};
+            *inputStruct = tmp;
         }
-        /*
-            LinkInfo
-        */
-        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkInfo) {
-            //LinkInfoSize
-            if(fread(&inputStruct->cshllink_lnkinfo.LinkInfoSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //LinkInfoHeaderSize
-            if(fread(&inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize!=0x0000001C && inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize<0x00000024)
-                _cshllink_errint(_CSHLLINK_ERR_INVLIHS);
-            
-            //LinkInfoFlags
-            if(fread(&inputStruct->cshllink_lnkinfo.LinkInfoFlags, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
 
-            //VolumeIDOffset
-            if(fread(&inputStruct->cshllink_lnkinfo.VolumeIDOffset, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //LocalBasePathOffset
-            if(fread(&inputStruct->cshllink_lnkinfo.LocalBasePathOffset, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        // read buffer
+        struct _cshllink_cursor cur = {0};
+        cur.data = data;
+        cur.size = size;
+        cur.skip = skip;
+        cur.ctx = ctx;
+        inputStruct->cshllink_borrowed = cur.borrow = borrow;
+        return _cshllink_parse(&cur, inputStruct);
+    }
 
-            //CommonNetworkRelativeLinkOffset
-            if(fread(&inputStruct->cshllink_lnkinfo.CommonNetworkRelativeLinkOffset, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        -> path of the shell link
+        -> cshllink structure pointer containing the file content
+        -- maps the file read-only, parses the mapping and unmaps it again
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
 
-            //CommonPathSuffixOffset
-            if(fread(&inputStruct->cshllink_lnkinfo.CommonPathSuffixOffset, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadPath(const char *path, cshllink *inputStruct) {
+        return cshllink_loadMapped(path, inputStruct, 0);
+    }
 
-            //only present if LinkInfoHeaderSize >= 0x00000024
-            if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize>=0x00000024) {
-                //LocalBasePathOffsetUnicode
-                if(fread(&inputStruct->cshllink_lnkinfo.LocalBasePathOffsetUnicode, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        -> path of the shell link
+        -> cshllink structure pointer containing the file content
+        -> keep: 0 - unmap after parsing (same as cshllink_loadPath)
+                 1 - keep the mapping alive; string and blob fields point into the mapping instead of being copied (see cshllink_loadView)
+        -- maps the file read-only and parses the mapping
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
 
-                //CommonPathSuffixOffsetUnicode
-                if(fread(&inputStruct->cshllink_lnkinfo.CommonPathSuffixOffsetUnicode, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-            }
+        borrowed fields are read-only, may be unaligned and StringData UStrings are not NULL terminated (use CountCharacters).
+        The mapping is released by cshllink_free (also call it after an error).
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadMapped(const char *path, cshllink *inputStruct, uint8_t keep) {
+        return cshllink_loadMappedSkip(path, inputStruct, keep, 0);
+    }
 
-            /*
-                VolumeID
-            */
-            if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) {
-                int VtmpSize=16;
-                //VolumeIDSize
-                if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        -> path of the shell link
+        -> cshllink structure pointer containing the file content
+        -> keep: see cshllink_loadMapped
+        -> skip: sections (CSHLLINK_SEC_*) and ExtraDataBlocks (CSHLLINK_SEC_EDBLK) not to decode
+        -- same as cshllink_loadMapped; skipped sections are stepped over by their size fields and left zeroed
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
 
-                //DriveType
-                if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.DriveType, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                
-                //DriveSerialNumber
-                if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.DriveSerialNumber, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+        with keep 1 skipped ExtraDataBlocks (e.g. CSHLLINK_SEC_EDBLKS) stay in the mapping: cshllink_getBlock decodes them on first access, the writers copy them verbatim
+        other skipped sections are only written back with keep 1, after cshllink_trackDirty and while unmodified, otherwise writing fails with 0x2F
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadMappedSkip(const char *path, cshllink *inputStruct, uint8_t keep, uint32_t skip) {
 
-                //VolumeLabelOffset
-                if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                
-                //only present if VolumeLabelOffset == 0x00000014
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014) {
-                    //VolumeLabelOffsetUnicode
-                    if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffsetUnicode, 4, 1, fp) != 1)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
-                    VtmpSize+=4;
-                }
+        // test if path is present
+        if(path==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
 
-                //DATA
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize<=VtmpSize)
-                    _cshllink_errint(_CSHLLINK_ERR_VIDSLOW);
-                inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data = malloc(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize);
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data==NULL)
-                    _cshllink_errint(_CSHLLINK_ERR_NULLPVIDD);
-                //Data
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014) {
-                    if(fread(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, sizeof(char16_t), (inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize)/2, fp) != (inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize)/2)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
-                }
-                else {
-                    if(fread(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, sizeof(char), inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize, fp) != inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
-                }
+        // clear inputStruct
+        if(inputStruct==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA)
+        {
+            cshllink tmp = {0};
+            *inputStruct = tmp;
+        }
 
-                //LocalBasePath
-                if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.LocalBasePath, _CSHLLINK_ERR_NULLPLBP, _CSHLLINK_ERR_FIO, fp))
-                    return -1;
-            }
-            /*
-                CommonNetworkRelativeLink
-            */
-            if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_CommonNetworkRelativeLinkAndPathSuffix) {
-                //CommonNetworkRelativeSize
-                if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.CommonNetworkRelativeSize, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+        void *map;
+        size_t size;
+        if(_cshllink_map(path, &map, &size))
+            return -1;
 
-                //CommonNetworkRelativeLinkFlags
-                if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.CommonNetworkRelativeLinkFlags, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+        struct _cshllink_cursor cur = {0};
+        cur.data = map;
+        cur.size = size;
+        cur.skip = skip;
+        if(keep) {
+            // mapping is owned by inputStruct from here on
+            inputStruct->cshllink_map = map;
+            inputStruct->cshllink_mapsize = size;
+            inputStruct->cshllink_borrowed = cur.borrow = _CSHLLINK_SEC_VIEW;
+            return _cshllink_parse(&cur, inputStruct);
+        }
 
-                //NetNameOffset
-                if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffset, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+        uint8_t ret = _cshllink_parse(&cur, inputStruct);
+        _cshllink_unmap(map, size);
+        return ret;
+    }
 
-                //DeviceNameOffset
-                if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceNameOffset, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                
-                //NetworkProviderType
-                if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetworkProviderType, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffset>0x00000014) {
-                    //NetNameOffsetUnicode
-                    if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffsetUnicode, 4, 1, fp) != 1)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        map file read-only (falls back to a heap copy where mmap is not available)
+    */
+    uint8_t _cshllink_map(const char *path, void **map, size_t *size) {
+    #ifndef _WIN32
+        int fd = open(path, O_RDONLY);
+        if(fd<0)
+            _cshllink_errint(_CSHLLINK_ERR_FCL);
 
-                    //DeviceNameOffsetUnicode
-                    if(fread(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceNameOffsetUnicode, 4, 1, fp) != 1)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
-                }
+        struct stat st;
+        if(fstat(fd, &st) || st.st_size<=0) {
+            close(fd);
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        }
 
-                //NetName
-                if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetName, _CSHLLINK_ERR_NULLPNETN, _CSHLLINK_ERR_FIO, fp))
-                        return -1;
-                
-                //DeviceName
-                if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceName, _CSHLLINK_ERR_NULLPDEVN, _CSHLLINK_ERR_FIO, fp))
-                        return -1;
+        *size = st.st_size;
+        *map = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if(*map==MAP_FAILED)
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    #else
+        FILE *fp = fopen(path, "rb");
+        if(fp==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_FCL);
 
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffset>0x00000014) {
-                    //NetNameUnicode
-                    if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameUnicode, _CSHLLINK_ERR_NULLPNNU, _CSHLLINK_ERR_FIO, fp))
-                            return -1;
+        fseek(fp, 0, SEEK_END);
+        long int epos=ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+        if(epos<=0 || (*map = malloc(epos))==NULL) {
+            fclose(fp);
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        }
 
-                    //DeviceNameUnicode
-                    if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceNameUnicode, _CSHLLINK_ERR_NULLPDNU, _CSHLLINK_ERR_FIO, fp))
-                            return -1;
-                }
-            }
+        *size = epos;
+        if(fread(*map, 1, *size, fp)!=*size) {
+            fclose(fp);
+            free(*map);
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        }
+        fclose(fp);
+    #endif
+        return 0;
+    }
 
-            //CommonPathSuffix
-            if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.CommonPathSuffix, _CSHLLINK_ERR_NULLPCPS, _CSHLLINK_ERR_FIO, fp))
-                    return -1;
+    /*
+        unmap file mapped by _cshllink_map
+    */
+    void _cshllink_unmap(void *map, size_t size) {
+    #ifndef _WIN32
+        munmap(map, size);
+    #else
+        free(map);
+    #endif
+    }
 
-            if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize>=0x00000024) {
-                //LocalBasePathUnicode
-                if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) {
-                    if(cshllink_rNULLwstr(&inputStruct->cshllink_lnkinfo.LocalBasePathUnicode, _CSHLLINK_ERR_NULLPLBPU, _CSHLLINK_ERR_FIO, fp))
-                        return -1;
+    /*
+        -> pointer to a buffer starting with the shell link (at least 0x4C bytes)
+        -> size of the buffer in bytes
+        -> header structure pointer
+        -- reads only the ShellLinkHeader, no allocation
+        <- on error this function will return -1 (the content of header is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadHeader(const uint8_t *data, size_t size, struct _cshllink_header *header) {
+        if(data==NULL || header==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        if(size<_CSHLLINK_HEADERSIZE)
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        return _cshllink_decodeHeader(data, header);
+    }
+
+    /*
+        -> open file descriptor (read access)
+        -> header structure pointer
+        -- reads exactly the 0x4C bytes of the ShellLinkHeader from the start of the file (the file position is not changed), no allocation
+        <- on error this function will return -1 (the content of header is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadHeaderFd(int fd, struct _cshllink_header *header) {
+        if(fd<0)
+            _cshllink_errint(_CSHLLINK_ERR_FCL);
+        if(header==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+
+        uint8_t raw[_CSHLLINK_HEADERSIZE];
+    #ifndef _WIN32
+        if(pread(fd, raw, _CSHLLINK_HEADERSIZE, 0)!=_CSHLLINK_HEADERSIZE)
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    #else
+        if(_lseek(fd, 0, SEEK_SET)!=0 || _read(fd, raw, _CSHLLINK_HEADERSIZE)!=_CSHLLINK_HEADERSIZE)
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    #endif
+        return _cshllink_decodeHeader(raw, header);
+    }
+
+    /*
+        memcpy of a buffer field of a fixed layout (out of line: constant sizes of some hundred bytes would be inlined as slow rep movs)
+    */
+    _CSHLLINK_NOINLINE
+    void *_cshllink_copyBuf(void *dest, const void *src, size_t size) {
+        return memcpy(dest, src, size);
+    }
+
+    /*
+        buffer field of a fixed layout: src if the cursor borrows the current section, otherwise a copy allocated with the cursor (NULL on failure)
+    */
+    _CSHLLINK_NOINLINE
+    const void *_cshllink_decodeBuf(const uint8_t *src, size_t size, struct _cshllink_cursor *cur) {
+        if(cur->borrow&cur->section)
+            return src;
+        void *copy = _cshllink_curAlloc(cur, size);
+        if(copy==NULL)
+            return NULL;
+        return memcpy(copy, src, size);
+    }
+
+    /*
+        fixed-layout decoders and encoders (see _CSHLLINK_LAYOUT_*), every field is a copy with constant offset and size
+    */
+    #define _cshllink_decodeValue(T, member, offset) \
+        if(offset+sizeof dest->member<=size) \
+            memcpy(&dest->member, raw+offset, sizeof dest->member);
+    #ifdef CSHLLINK_INLINE_EXTRADATA
+        #define _cshllink_decodeRef(T, member, offset, bytes, err) \
+            if(offset+bytes<=size) \
+                _cshllink_copyBuf(dest->member, raw+offset, bytes);
+    #else
+        #define _cshllink_decodeRef(T, member, offset, bytes, err) \
+            if(offset+bytes<=size) { \
+                const void *ptr = _cshllink_decodeBuf(raw+offset, bytes, cur); \
+                if(ptr==NULL) \
+                    _cshllink_errint(err); \
+                memcpy(&dest->member, &ptr, sizeof ptr); \
+            }
+    #endif
+    #define _cshllink_encodeValue(T, member, offset) \
+        if(offset+sizeof src->member<=size) \
+            memcpy(raw+offset, &src->member, sizeof src->member);
+    #ifdef CSHLLINK_INLINE_EXTRADATA
+        #define _cshllink_encodeRef(T, member, offset, bytes, err) \
+            if(offset+bytes<=size) \
+                _cshllink_copyBuf(raw+offset, src->member, bytes);
+    #else
+        #define _cshllink_encodeRef(T, member, offset, bytes, err) \
+            if(offset+bytes<=size) { \
+                if(src->member==NULL) \
+                    _cshllink_errint(err); \
+                _cshllink_copyBuf(raw+offset, src->member, bytes); \
+            }
+    #endif
+    #define _cshllink_layout(name, list, T, bytes) \
+        static uint8_t _cshllink_layoutDecode##name(const uint8_t *raw, size_t size, void *out, struct _cshllink_cursor *cur) { \
+            T *dest = out; \
+            list(_cshllink_decodeValue, _cshllink_decodeRef, T) \
+            return 0; \
+        } \
+        static uint8_t _cshllink_layoutEncode##name(const void *in, uint8_t *raw, size_t size) { \
+            const T *src = in; \
+            memset(raw, 0, size); \
+            list(_cshllink_encodeValue, _cshllink_encodeRef, T) \
+            return 0; \
+        } \
+        static const struct _cshllink_layout _cshllink_layout##name = {_cshllink_layoutDecode##name, _cshllink_layoutEncode##name, bytes};
+
+    _cshllink_layout(Header, _CSHLLINK_LAYOUT_HEADER, struct _cshllink_header, _CSHLLINK_HEADERSIZE)
+    _cshllink_layout(LinkInfo, _CSHLLINK_LAYOUT_LINKINFO, struct _cshllink_lnkinfo, 0x24)
+    _cshllink_layout(VolumeID, _CSHLLINK_LAYOUT_VOLUMEID, struct _cshllink_lnkinfo_volid, 0x14)
+    _cshllink_layout(CNetRLnk, _CSHLLINK_LAYOUT_CNETRLNK, struct _cshllink_lnkinfo_cnetrlnk, 0x1C)
+    _cshllink_layout(Console, _CSHLLINK_LAYOUT_CONSOLE, struct _cshllink_extdatablk_consdblk, _CSHLLINK_EDBLK_ConsoleDataBlockSiz-8)
+    _cshllink_layout(Darwin, _CSHLLINK_LAYOUT_DARWIN, struct _cshllink_extdatablk_darwdblk, _CSHLLINK_EDBLK_DarwinDataBlockSiz-8)
+    _cshllink_layout(Environment, _CSHLLINK_LAYOUT_ENVIRONMENT, struct _cshllink_extdatablk_envdblk, _CSHLLINK_EDBLK_EnvironmentVariableDataBlockSiz-8)
+    _cshllink_layout(IconEnvironment, _CSHLLINK_LAYOUT_ICONENVIRONMENT, struct _cshllink_extdatablk_icoenvdblk, _CSHLLINK_EDBLK_IconEnvironmentDataBlockSiz-8)
+    _cshllink_layout(ConsoleFE, _CSHLLINK_LAYOUT_CONSOLEFE, struct _cshllink_extdatablk_consfdblk, _CSHLLINK_EDBLK_ConsoleFEDataBlockSiz-8)
+    _cshllink_layout(SpecialFolder, _CSHLLINK_LAYOUT_SPECIALFOLDER, struct _cshllink_extdatablk_specfdblk, _CSHLLINK_EDBLK_SpecialFolderDataBlockSiz-8)
+    _cshllink_layout(KnownFolder, _CSHLLINK_LAYOUT_KNOWNFOLDER, struct _cshllink_extdatablk_knownfdblk, _CSHLLINK_EDBLK_KnownFolderDataBlockSiz-8)
+    _cshllink_layout(Tracker, _CSHLLINK_LAYOUT_TRACKER, struct _cshllink_extdatablk_trackdblk, _CSHLLINK_EDBLK_TrackerDataBlockSiz-8)
+
+    #undef _cshllink_layout
+    #undef _cshllink_encodeRef
+    #undef _cshllink_encodeValue
+    #undef _cshllink_decodeRef
+    #undef _cshllink_decodeValue
+
+    // HeaderSize 0x4C followed by LinkCLSID 00021401-0000-0000-C000-000000000046
+    static const uint8_t _cshllink_headerSig[20] = {
+        0x4C, 0x00, 0x00, 0x00,
+        0x01, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46
+    };
+
+    /*
+        validates HeaderSize and LinkCLSID (one comparison) and decodes the 0x4C header bytes at raw
+    */
+    uint8_t _cshllink_decodeHeader(const uint8_t *raw, struct _cshllink_header *header) {
+        if(memcmp(raw, _cshllink_headerSig, sizeof _cshllink_headerSig)) {
+            if(memcmp(raw, _cshllink_headerSig, 4))
+                _cshllink_errint(_CSHLLINK_ERR_WHEADS);
+            _cshllink_errint(_CSHLLINK_ERR_WCLSIDS);
+        }
+
+        //HeaderSize
+        header->HeaderSize = _CSHLLINK_HEADERSIZE;
+        //LinkCLSID (stored byte-swapped, see cshllink_sEndian)
+        header->LinkCLSID_L = 0xC000000000000046;
+        header->LinkCLSID_H = 0x0114020000000000;
+        //LinkFlags to HotKey (10 bytes NULL)
+        return _cshllink_layoutHeader.decode(raw, _CSHLLINK_HEADERSIZE, header, NULL);
+    }
+
+    /*
+        -> parser state
+        -> cshllink structure pointer receiving the content
+        -- prepares an incremental parse (see cshllink_parser_feed), clears inputStruct
+        <- on error this function will return -1, on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_parser_init(cshllink_parser *ctx, cshllink *inputStruct) {
+        if(ctx==NULL || inputStruct==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        {
+            cshllink tmp = {0};
+            *inputStruct = tmp;
+        }
+        cshllink_parser tmp = {0};
+        *ctx = tmp;
+        ctx->out = inputStruct;
+        inputStruct->cshllink_allocator = ctx->allocator = cshllink_getAllocator();
+        ctx->phase = _CSHLLINK_PARSER_HEADER;
+        ctx->need = _CSHLLINK_HEADERSIZE;
+        return 0;
+    }
+
+    /*
+        -> parser state (cshllink_parser_init)
+        -> next chunk of the input (any size, may be empty)
+        -> size of the chunk in bytes
+        -> optional pointer receiving the number of bytes of the chunk consumed (may be NULL)
+        -- parses the chunk; only the current section (ExtraDataBlock) is buffered, bytes after the TerminalBlock are not consumed
+        <- CSHLLINK_PARSER_NEEDMORE - feed the next chunk
+           CSHLLINK_PARSER_DONE     - the TerminalBlock was read, the structure is complete
+           CSHLLINK_PARSER_ERROR    - (-1) the input is invalid (the content of the structure is undefined, free it with cshllink_free)
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_parser_feed(cshllink_parser *ctx, const uint8_t *data, size_t size, size_t *used) {
+        if(used!=NULL)
+            *used = 0;
+        if(ctx==NULL || (data==NULL && size!=0))
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        if(ctx->phase==_CSHLLINK_PARSER_ERROR)
+            _cshllink_errint(ctx->error);
+
+        size_t pos = 0;
+        while(ctx->phase!=_CSHLLINK_PARSER_DONE) {
+            // complete the current unit
+            size_t take = ctx->need-ctx->have;
+            if(take>size-pos)
+                take = size-pos;
+            if(take!=0) {
+                if(ctx->need>ctx->capacity) {
+                    uint8_t *tmp = _cshllink_realloc(ctx->allocator, ctx->buf, ctx->need);
+                    if(tmp==NULL) {
+                        ctx->error = _CSHLLINK_ERR_FIO;
+                        ctx->phase = _CSHLLINK_PARSER_ERROR;
+                        _cshllink_errint(_CSHLLINK_ERR_FIO);
+                    }
+                    ctx->buf = tmp;
+                    ctx->capacity = ctx->need;
                 }
-                //CommonPathSuffixUnicode
-                if(cshllink_rNULLwstr(&inputStruct->cshllink_lnkinfo.CommonPathSuffixUnicode, _CSHLLINK_ERR_NULLPCPSU, _CSHLLINK_ERR_FIO, fp))
+                memcpy(ctx->buf+ctx->have, data+pos, take);
+                ctx->have+=take;
+                ctx->offset+=take;
+                pos+=take;
+            }
+            if(used!=NULL)
+                *used = pos;
+            if(ctx->have<ctx->need)
+                return CSHLLINK_PARSER_NEEDMORE;
+
+            if(_cshllink_parser_step(ctx)) {
+                // section of each parser phase, the unit starts need bytes before offset
+                static const uint32_t phasesec[_CSHLLINK_PARSER_DONE] = {CSHLLINK_SEC_HEADER, CSHLLINK_SEC_LINKTARGETIDLIST, CSHLLINK_SEC_LINKTARGETIDLIST, CSHLLINK_SEC_LINKINFO, CSHLLINK_SEC_LINKINFO, CSHLLINK_SEC_STRINGDATA, CSHLLINK_SEC_STRINGDATA, CSHLLINK_SEC_EXTRADATA, CSHLLINK_SEC_EXTRADATA};
+                _cshllink_errpos(NULL, ctx->offset-ctx->need, phasesec[ctx->phase]);
+                ctx->error = cshllink_error;
+                ctx->phase = _CSHLLINK_PARSER_ERROR;
+                return -1;
+            }
+        }
+        return CSHLLINK_PARSER_DONE;
+    }
+
+    /*
+        -> parser state
+        <- number of bytes still missing for the current unit, 0 once done
+        (feeding exactly this many bytes never consumes input beyond the TerminalBlock)
+    */
+    size_t cshllink_parser_pending(const cshllink_parser *ctx) {
+        if(ctx==NULL || ctx->phase==_CSHLLINK_PARSER_DONE || ctx->phase==_CSHLLINK_PARSER_ERROR)
+            return 0;
+        return ctx->need-ctx->have;
+    }
+
+    /*
+        -> parser state
+        -- releases the unit buffer of the parser (not the cshllink structure)
+    */
+    void cshllink_parser_free(cshllink_parser *ctx) {
+        if(ctx==NULL)
+            return;
+        _cshllink_dealloc(ctx->allocator, ctx->buf);
+        ctx->buf = NULL;
+        ctx->capacity = 0;
+    }
+
+    /*
+        decodes the completed unit of the parser and selects the next one
+    */
+    uint8_t _cshllink_parser_step(cshllink_parser *ctx) {
+        // StringData structures in file order
+        static const uint32_t strflags[5] = {CSHLLINK_LF_HasName, CSHLLINK_LF_HasRelativePath, CSHLLINK_LF_HasWorkingDir, CSHLLINK_LF_HasArguments, CSHLLINK_LF_HasIconLocation};
+        static const uint8_t strerrs[5] = {_CSHLLINK_ERR_NULLPSTRDNAME, _CSHLLINK_ERR_NULLPSTRDRPATH, _CSHLLINK_ERR_NULLPSTRDWDIR, _CSHLLINK_ERR_NULLPSTRDARG, _CSHLLINK_ERR_NULLPSTRDICO};
+
+        cshllink *inputStruct = ctx->out;
+        // cursor over the completed unit (never borrowed, the buffer is reused)
+        struct _cshllink_cursor cur = {0};
+        cur.data = ctx->buf;
+        cur.size = ctx->need;
+        cur.alloc = ctx->allocator;
+        cur.base = ctx->offset-ctx->need;
+        uint32_t size32 = 0;
+        uint16_t size16 = 0;
+
+        switch(ctx->phase) {
+            case _CSHLLINK_PARSER_HEADER:
+                cur.section = CSHLLINK_SEC_HEADER;
+                if(_cshllink_readHeader(inputStruct, &cur))
                     return -1;
+                _cshllink_indexSection(inputStruct, CSHLLINK_SEC_HEADER, 0, cur.base, cur.size);
+                ctx->phase = _CSHLLINK_PARSER_IDLISTSIZE;
+                break;
+
+            case _CSHLLINK_PARSER_IDLISTSIZE:
+                //IDListSize, the unit is extended by the IDList
+                memcpy(&size16, ctx->buf, 2);
+                ctx->phase = _CSHLLINK_PARSER_IDLIST;
+                ctx->need = 2+size16;
+                return 0;
+            case _CSHLLINK_PARSER_IDLIST:
+                cur.section = CSHLLINK_SEC_LINKTARGETIDLIST;
+                if(_cshllink_readLinkTargetIDList(inputStruct, &cur))
+                    return -1;
+                _cshllink_indexSection(inputStruct, CSHLLINK_SEC_LINKTARGETIDLIST, 0, cur.base, cur.size);
+                ctx->phase = _CSHLLINK_PARSER_LINKINFOSIZE;
+                break;
+
+            case _CSHLLINK_PARSER_LINKINFOSIZE:
+                //LinkInfoSize (includes itself), the unit is extended by the LinkInfo
+                memcpy(&size32, ctx->buf, 4);
+                if(size32<4 || size32>_CSHLLINK_PARSER_MAXUNIT)
+                    _cshllink_errint(_CSHLLINK_ERR_INVLIHS);
+                ctx->phase = _CSHLLINK_PARSER_LINKINFO;
+                ctx->need = size32;
+                return 0;
+            case _CSHLLINK_PARSER_LINKINFO:
+                cur.section = CSHLLINK_SEC_LINKINFO;
+                if(_cshllink_readLinkInfo(inputStruct, &cur))
+                    return -1;
+                _cshllink_indexSection(inputStruct, CSHLLINK_SEC_LINKINFO, 0, cur.base, cur.size);
+                ctx->phase = _CSHLLINK_PARSER_STRINGSIZE;
+                ctx->sectionStart = ctx->offset;
+                break;
+
+            case _CSHLLINK_PARSER_STRINGSIZE:
+                //CountCharacters, the unit is extended by the String
+                memcpy(&size16, ctx->buf, 2);
+                ctx->phase = _CSHLLINK_PARSER_STRING;
+                ctx->need = 2+size16*sizeof(char16_t);
+                return 0;
+            case _CSHLLINK_PARSER_STRING: {
+                struct _cshllink_strdata_def *defs[5] = {&inputStruct->cshllink_strdata.NameString, &inputStruct->cshllink_strdata.RelativePath, &inputStruct->cshllink_strdata.WorkingDir, &inputStruct->cshllink_strdata.CommandLineArguments, &inputStruct->cshllink_strdata.IconLocation};
+                struct _cshllink_strdata_def *def = defs[ctx->item];
+                cur.section = CSHLLINK_SEC_STRINGDATA;
+                if(_cshllink_cread(&cur, &def->CountCharacters, 2))
+                    return -1;
+                if(cshllink_rwstr(&def->UString, strerrs[ctx->item], _CSHLLINK_ERR_FIO, &cur, def->CountCharacters*2))
+                    return -1;
+                ctx->item++;
+                ctx->phase = _CSHLLINK_PARSER_STRINGSIZE;
+                break;
             }
-        
+
+            case _CSHLLINK_PARSER_BLOCKSIZE:
+                //BlockSize, the unit is extended by the ExtraDataBlock
+                memcpy(&size32, ctx->buf, 4);
+                if(size32<4) {
+                    //TerminalBlock
+                    _cshllink_indexSection(inputStruct, CSHLLINK_SEC_EXTRADATA, 0, ctx->sectionStart, ctx->offset-ctx->sectionStart);
+                    ctx->phase = _CSHLLINK_PARSER_DONE;
+                    return 0;
+                }
+                if(size32<8 || size32>_CSHLLINK_PARSER_MAXUNIT)
+                    _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
+                ctx->phase = _CSHLLINK_PARSER_BLOCK;
+                ctx->need = size32;
+                return 0;
+            case _CSHLLINK_PARSER_BLOCK:
+                cur.section = CSHLLINK_SEC_EXTRADATA;
+                if(_cshllink_readExtraData(inputStruct, &cur))
+                    return -1;
+                ctx->phase = _CSHLLINK_PARSER_BLOCKSIZE;
+                break;
+        }
+
+        // select the next present unit
+        if(ctx->phase==_CSHLLINK_PARSER_IDLISTSIZE && !(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkTargetIDList))
+            ctx->phase = _CSHLLINK_PARSER_LINKINFOSIZE;
+        if(ctx->phase==_CSHLLINK_PARSER_LINKINFOSIZE && !(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkInfo)) {
+            ctx->phase = _CSHLLINK_PARSER_STRINGSIZE;
+            ctx->sectionStart = ctx->offset;
+        }
+        if(ctx->phase==_CSHLLINK_PARSER_STRINGSIZE) {
+            while(ctx->item<5 && !(inputStruct->cshllink_header.LinkFlags&strflags[ctx->item]))
+                ctx->item++;
+            if(ctx->item==5) {
+                if(ctx->offset!=ctx->sectionStart)
+                    _cshllink_indexSection(inputStruct, CSHLLINK_SEC_STRINGDATA, 0, ctx->sectionStart, ctx->offset-ctx->sectionStart);
+                ctx->phase = _CSHLLINK_PARSER_BLOCKSIZE;
+                ctx->sectionStart = ctx->offset;
+            }
+        }
+
+        ctx->have = 0;
+        ctx->need = (ctx->phase==_CSHLLINK_PARSER_IDLISTSIZE || ctx->phase==_CSHLLINK_PARSER_STRINGSIZE) ? 2 : 4;
+        return 0;
+    }
+
+    /*
+        -> open file descriptor of type FILE (R mode, may be a pipe or stdin)
+        -> cshllink structure pointer containing the content
+        -- reads one shell link from the current position up to its TerminalBlock (no seeking, nothing after the TerminalBlock is consumed)
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadStream(FILE *fp, cshllink *inputStruct) {
+        if(fp==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_FCL);
+
+        cshllink_parser parser;
+        if(cshllink_parser_init(&parser, inputStruct))
+            return -1;
+
+        uint8_t chunk[_CSHLLINK_LOADBUF_STACK];
+        uint8_t ret = CSHLLINK_PARSER_NEEDMORE;
+        while(ret==CSHLLINK_PARSER_NEEDMORE) {
+            // read exactly what the current unit is missing
+            size_t want = cshllink_parser_pending(&parser);
+            if(want>sizeof chunk)
+                want = sizeof chunk;
+            size_t got = fread(chunk, 1, want, fp);
+            if(got==0) {
+                _cshllink_seterr(_CSHLLINK_ERR_FIO);
+                ret = -1;
+                break;
+            }
+            ret = cshllink_parser_feed(&parser, chunk, got, NULL);
+        }
+
+        cshllink_parser_free(&parser);
+        return ret==CSHLLINK_PARSER_DONE ? 0 : -1;
+    }
+
+    /*
+        Processes inputFile (reads the whole file with a single fread and parses the buffer)
+    */
+    uint8_t cshllink_loadFile_i(FILE *fp, cshllink *inputStruct) {
+        return _cshllink_loadFile(fp, inputStruct, NULL, NULL);
+    }
+    uint8_t _cshllink_loadFile(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx, cshllink_pool *pool) {
+
+        // file size
+        if(fseek(fp, 0, SEEK_END))
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        long int epos=ftell(fp);
+        if(epos<0)
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        if(fseek(fp, 0, SEEK_SET))
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+
+        struct _cshllink_cursor cur = {0};
+        cur.ctx = ctx;
+        cur.alloc = _cshllink_allocator(ctx);
+        cur.pool = pool;
+
+        // shell links are small, most fit into the stack buffer
+        uint8_t stackbuf[_CSHLLINK_LOADBUF_STACK];
+        uint8_t *buf = stackbuf;
+        if(epos>_CSHLLINK_LOADBUF_STACK) {
+            buf = _cshllink_alloc(cur.alloc, epos);
+            if(buf==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        }
+
+        if(fread(buf, 1, epos, fp)!=(size_t)epos) {
+            if(buf!=stackbuf)
+                _cshllink_dealloc(cur.alloc, buf);
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        }
+
+        cur.data = buf;
+        cur.size = epos;
+        uint8_t ret = _cshllink_parse(&cur, inputStruct);
+
+        if(buf!=stackbuf)
+            _cshllink_dealloc(cur.alloc, buf);
+        return ret;
+    }
+
+    /*
+        Processes input cursor (shared by all load functions)
+    */
+    uint8_t _cshllink_parse(struct _cshllink_cursor *cur, cshllink *inputStruct) {
+        // allocator owning the decoded fields
+        if(cur->alloc==NULL)
+            cur->alloc = _cshllink_allocator(cur->ctx);
+        // spare buffers of cshllink_reset (same allocator only)
+        if(cur->pool!=NULL && cur->pool->allocator!=cur->alloc)
+            cur->pool = NULL;
+        inputStruct->cshllink_allocator = cur->alloc;
+        // arena: one reservation bounded by the input size
+        if(cur->alloc->alloc==_cshllink_arenaAlloc && cshllink_arena_reserve(cur->alloc->user, _CSHLLINK_ARENA_RESERVE(cur->size)))
+            return -1;
+        if(_cshllink_parseSections(cur, inputStruct)) {
+            _cshllink_errpos(cur->ctx, cur->base+cur->pos, cur->section);
+            return -1;
         }
+        // borrowed input, the writers copy unmodified sections from it after cshllink_trackDirty
+        if(cur->borrow) {
+            inputStruct->cshllink_input = cur->data;
+            inputStruct->cshllink_inputsize = cur->pos;
+        }
+        // cshllink_ctx.track: a copied input is kept as owned copy
+        if(cur->ctx!=NULL && cur->ctx->track) {
+            if(!cur->borrow) {
+                uint8_t *input = _cshllink_alloc(cur->alloc, cur->pos);
+                if(input==NULL)
+                    _cshllink_errint(_CSHLLINK_ERR_NOINPUT);
+                inputStruct->cshllink_input = memcpy(input, cur->data, cur->pos);
+                inputStruct->cshllink_inputsize = cur->pos;
+            }
+            inputStruct->cshllink_tracked = 1;
+        }
+        return 0;
+    }
+    uint8_t _cshllink_parseSections(struct _cshllink_cursor *cur, cshllink *inputStruct) {
 
+        /*
+            HEADER
+        */
+        cur->section = CSHLLINK_SEC_HEADER;
+        size_t start = cur->pos;
+        if(_cshllink_readHeader(inputStruct, cur))
+            return -1;
+        _cshllink_indexSection(inputStruct, CSHLLINK_SEC_HEADER, 0, cur->base+start, cur->pos-start);
+
+        /*
+            LinkTargetIDList
+        */
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkTargetIDList) {
+            cur->section = CSHLLINK_SEC_LINKTARGETIDLIST;
+            start = cur->pos;
+            if(cur->skip&CSHLLINK_SEC_LINKTARGETIDLIST) {
+                if(_cshllink_skipSection(inputStruct, cur))
+                    return -1;
+            }
+            else if(_cshllink_readLinkTargetIDList(inputStruct, cur))
+                return -1;
+            _cshllink_indexSection(inputStruct, CSHLLINK_SEC_LINKTARGETIDLIST, 0, cur->base+start, cur->pos-start);
+        }
+        /*
+            LinkInfo
+        */
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkInfo) {
+            cur->section = CSHLLINK_SEC_LINKINFO;
+            start = cur->pos;
+            if(cur->skip&CSHLLINK_SEC_LINKINFO) {
+                if(_cshllink_skipSection(inputStruct, cur))
+                    return -1;
+            }
+            else if(_cshllink_readLinkInfo(inputStruct, cur))
+                return -1;
+            _cshllink_indexSection(inputStruct, CSHLLINK_SEC_LINKINFO, 0, cur->base+start, cur->pos-start);
+        }
         /*
             StringData (all unicode 2 bytes)
         */
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasName) {
-                //NameString
-                if(fread(&inputStruct->cshllink_strdata.NameString.CountCharacters, 2, 1, fp)!=1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_rwstr(&inputStruct->cshllink_strdata.NameString.UString, _CSHLLINK_ERR_NULLPSTRDNAME, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.NameString.CountCharacters*2))
+        cur->section = CSHLLINK_SEC_STRINGDATA;
+        start = cur->pos;
+        if(cur->skip&CSHLLINK_SEC_STRINGDATA) {
+            if(_cshllink_skipSection(inputStruct, cur))
+                return -1;
+        }
+        else if(_cshllink_readStringData(inputStruct, cur))
+            return -1;
+        if(cur->pos!=start)
+            _cshllink_indexSection(inputStruct, CSHLLINK_SEC_STRINGDATA, 0, cur->base+start, cur->pos-start);
+        /*
+            ExtraDataBlock
+        */
+        cur->section = CSHLLINK_SEC_EXTRADATA;
+        start = cur->pos;
+        if(cur->skip&CSHLLINK_SEC_EXTRADATA) {
+            if(_cshllink_skipSection(inputStruct, cur))
+                return -1;
+        }
+        else if(_cshllink_readExtraData(inputStruct, cur))
+            return -1;
+        if(cur->pos!=start)
+            _cshllink_indexSection(inputStruct, CSHLLINK_SEC_EXTRADATA, 0, cur->base+start, cur->pos-start);
+
+        return 0;
+    }
+
+    /*
+        step over the current section (cur->section) using its size fields, records it in cshllink_skipped
+    */
+    uint8_t _cshllink_skipSection(cshllink *inputStruct, struct _cshllink_cursor *cur) {
+        switch(cur->section) {
+            case CSHLLINK_SEC_LINKTARGETIDLIST: {
+                //IDListSize
+                uint16_t size;
+                if(_cshllink_cread(cur, &size, 2))
                     return -1;
+                if(_cshllink_cskip(cur, size))
+                    return -1;
+                break;
             }
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasRelativePath) {
-                //RelativePath
-                if(fread(&inputStruct->cshllink_strdata.RelativePath.CountCharacters, 2, 1, fp)!=1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_rwstr(&inputStruct->cshllink_strdata.RelativePath.UString, _CSHLLINK_ERR_NULLPSTRDRPATH, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.RelativePath.CountCharacters*2))
+            case CSHLLINK_SEC_LINKINFO: {
+                //LinkInfoSize (includes itself)
+                uint32_t size;
+                if(_cshllink_cread(cur, &size, 4))
                     return -1;
+                if(size<4)
+                    _cshllink_errint(_CSHLLINK_ERR_INVLIHS);
+                if(_cshllink_cskip(cur, size-4))
+                    return -1;
+                break;
             }
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasWorkingDir) {
-                //WorkingDir
-                if(fread(&inputStruct->cshllink_strdata.WorkingDir.CountCharacters, 2, 1, fp)!=1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_rwstr(&inputStruct->cshllink_strdata.WorkingDir.UString, _CSHLLINK_ERR_NULLPSTRDWDIR, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.WorkingDir.CountCharacters*2))
+            case CSHLLINK_SEC_STRINGDATA: {
+                //CountCharacters of each present StringData structure
+                static const uint32_t flags[5] = {CSHLLINK_LF_HasName, CSHLLINK_LF_HasRelativePath, CSHLLINK_LF_HasWorkingDir, CSHLLINK_LF_HasArguments, CSHLLINK_LF_HasIconLocation};
+                for(int i=0; i<5; i++) {
+                    if(!(inputStruct->cshllink_header.LinkFlags&flags[i]))
+                        continue;
+                    uint16_t count;
+                    if(_cshllink_cread(cur, &count, 2))
+                        return -1;
+                    if(_cshllink_cskip(cur, count*sizeof(char16_t)))
+                        return -1;
+                }
+                break;
+            }
+            case CSHLLINK_SEC_EXTRADATA: {
+                //BlockSize of each block up to the TerminalBlock
+                while(cur->pos+4<=cur->size) {
+                    size_t start = cur->pos;
+                    uint32_t size, sig=0;
+                    if(_cshllink_cread(cur, &size, 4))
+                        return -1;
+                    if(size<4)
+                        break;
+                    if(size>=8 && _cshllink_cread(cur, &sig, 4))
+                        return -1;
+                    if(_cshllink_cskip(cur, size-(size>=8 ? 8 : 4)))
+                        return -1;
+                    _cshllink_indexSection(inputStruct, _CSHLLINK_EDBLK_KNOWN(sig) ? CSHLLINK_SEC_EDBLK(sig) : 0, sig, cur->base+start, size);
+                }
+                break;
+            }
+        }
+        inputStruct->cshllink_skipped |= cur->section;
+        return 0;
+    }
+
+    /*
+        -> cshllink structure pointer (loaded)
+        -> section (CSHLLINK_SEC_*) or ExtraDataBlock (CSHLLINK_SEC_EDBLK)
+        -- looks up the position of the section in the loaded input
+        <- index entry, NULL if the section was not present
+    */
+    const struct _cshllink_secidx *cshllink_findSection(const cshllink *inputStruct, uint32_t section) {
+        if(inputStruct==NULL)
+            return NULL;
+        for(int i=0; i<inputStruct->cshllink_indexnum; i++) {
+            if(inputStruct->cshllink_index[i].section==section)
+                return &inputStruct->cshllink_index[i];
+        }
+        return NULL;
+    }
+
+    /*
+        append an entry to the section index (ignored once the table is full, the last entry is kept for the ExtraData section recorded after its blocks)
+    */
+    void _cshllink_indexSection(cshllink *inputStruct, uint32_t section, uint32_t BlockSignature, size_t offset, size_t size) {
+        if(inputStruct->cshllink_indexnum>=_CSHLLINK_SECIDX_NUM-((section==0 || BlockSignature!=0) ? 1 : 0))
+            return;
+        struct _cshllink_secidx *entry = &inputStruct->cshllink_index[inputStruct->cshllink_indexnum++];
+        entry->section = section;
+        entry->BlockSignature = BlockSignature;
+        entry->offset = offset;
+        entry->size = size;
+    }
+
+    /*
+        Section read functions
+    */
+    uint8_t _cshllink_readHeader(cshllink *inputStruct, struct _cshllink_cursor *cur) {
+        const void *raw;
+        if(_cshllink_cref(cur, &raw, _CSHLLINK_HEADERSIZE))
+            return -1;
+        return _cshllink_decodeHeader(raw, &inputStruct->cshllink_header);
+    }
+
+    uint8_t _cshllink_readLinkTargetIDList(cshllink *inputStruct, struct _cshllink_cursor *cur) {
+        //IDList size
+        if(_cshllink_cread(cur, &inputStruct->cshllink_lnktidl.idl_size, 2))
+            return -1;
+
+        //IDList (size -2 as idl_size contains the TerminalBlock)
+        if(_cshllink_readIDList(&inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl, inputStruct->cshllink_lnktidl.idl_size-2, cur))
+            return -1;
+
+        return 0;
+    }
+
+    uint8_t _cshllink_readLinkInfo(cshllink *inputStruct, struct _cshllink_cursor *cur) {
+        //LinkInfoSize to CommonPathSuffixOffset, LocalBasePathOffsetUnicode and CommonPathSuffixOffsetUnicode if LinkInfoHeaderSize >= 0x00000024
+        const uint8_t *raw;
+        if(_cshllink_cref(cur, (const void **)&raw, 0x1C))
+            return -1;
+        uint32_t LinkInfoHeaderSize;
+        memcpy(&LinkInfoHeaderSize, raw+4, 4);
+        if(LinkInfoHeaderSize!=0x0000001C && LinkInfoHeaderSize<0x00000024)
+            _cshllink_errint(_CSHLLINK_ERR_INVLIHS);
+        if(LinkInfoHeaderSize>=0x00000024 && _cshllink_cskip(cur, 8))
+            return -1;
+        if(_cshllink_layoutLinkInfo.decode(raw, LinkInfoHeaderSize>=0x00000024 ? 0x24 : 0x1C, &inputStruct->cshllink_lnkinfo, NULL))
+            return -1;
+
+        /*
+            VolumeID
+        */
+        if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) {
+            int VtmpSize=16;
+            //VolumeIDSize to VolumeLabelOffset, VolumeLabelOffsetUnicode if VolumeLabelOffset == 0x00000014
+            if(_cshllink_cref(cur, (const void **)&raw, 16))
+                return -1;
+            uint32_t VolumeLabelOffset;
+            memcpy(&VolumeLabelOffset, raw+12, 4);
+            if(VolumeLabelOffset==0x00000014) {
+                if(_cshllink_cskip(cur, 4))
                     return -1;
+                VtmpSize+=4;
             }
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasArguments) {
-                //CommandLineArguments
-                if(fread(&inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters, 2, 1, fp)!=1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_rwstr(&inputStruct->cshllink_strdata.CommandLineArguments.UString, _CSHLLINK_ERR_NULLPSTRDARG, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters*2))
+            if(_cshllink_layoutVolumeID.decode(raw, VtmpSize, &inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid, NULL))
+                return -1;
+
+            //DATA
+            if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize<=VtmpSize)
+                _cshllink_errint(_CSHLLINK_ERR_VIDSLOW);
+            size_t VdataSize = inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize;
+            if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014)
+                VdataSize = VdataSize/2*sizeof(char16_t);
+            if(cur->borrow&cur->section) {
+                //Data
+                if(_cshllink_cref(cur, (const void **)&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, VdataSize))
                     return -1;
             }
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasIconLocation) {
-                //IconLocation
-                if(fread(&inputStruct->cshllink_strdata.IconLocation.CountCharacters, 2, 1, fp)!=1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_rwstr(&inputStruct->cshllink_strdata.IconLocation.UString, _CSHLLINK_ERR_NULLPSTRDICO, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.IconLocation.CountCharacters*2))
+            else {
+                inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data = _cshllink_curAlloc(cur, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize);
+                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data==NULL)
+                    _cshllink_errint(_CSHLLINK_ERR_NULLPVIDD);
+                //Data
+                if(_cshllink_cread(cur, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, VdataSize))
                     return -1;
             }
+
+            //LocalBasePath
+            if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.LocalBasePath, _CSHLLINK_ERR_NULLPLBP, _CSHLLINK_ERR_FIO, cur))
+                return -1;
+        }
         /*
-            ExtraDataBlock
+            CommonNetworkRelativeLink
         */
-        {
-            long int cpos=ftell(fp);
-            fseek(fp, 0, SEEK_END);
-            long int epos=ftell(fp)-4;      //TerminalBlock
-            fseek(fp, cpos, SEEK_SET);
-
-            for(int i=0; i<_CSHLLINK_EDBLK_NUM; i++) {
-                cpos=ftell(fp);
-                if(cpos>=epos) break;
-                
-                struct _cshllink_extdatablk_blk_info info={0};
-                if(fread(&info.BlockSize, 4, 1, fp)!=1) 
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(fread(&info.BlockSignature, 4, 1, fp)!=1) 
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+        if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_CommonNetworkRelativeLinkAndPathSuffix) {
+            //CommonNetworkRelativeSize to NetworkProviderType, NetNameOffsetUnicode and DeviceNameOffsetUnicode if NetNameOffset > 0x00000014
+            if(_cshllink_cref(cur, (const void **)&raw, 20))
+                return -1;
+            uint32_t NetNameOffset;
+            memcpy(&NetNameOffset, raw+8, 4);
+            if(NetNameOffset>0x00000014 && _cshllink_cskip(cur, 8))
+                return -1;
+            if(_cshllink_layoutCNetRLnk.decode(raw, NetNameOffset>0x00000014 ? 0x1C : 0x14, &inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk, NULL))
+                return -1;
 
-                switch(info.BlockSignature) {
-                    case _CSHLLINK_EDBLK_ConsoleDataBlockSig:
-                        if(_cshllink_readEConsoleDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.ConsoleDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_ConsoleFEDataBlockSig: 
-                        if(_cshllink_readEConsoleFEDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.ConsoleFEDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_DarwinDataBlockSig: 
-                        if(_cshllink_readEDarwinDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.DarwinDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_EnvironmentVariableDataBlockSig: 
-                        if(_cshllink_readEEnvironmentVariableDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_IconEnvironmentDataBlockSig: 
-                        if(_cshllink_readEIconEnvironmentDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_KnownFolderDataBlockSig: 
-                        if(_cshllink_readEKnownFolderDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.KnownFolderDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_PropertyStoreDataBlockSig: 
-                        if(_cshllink_readEPropertyStoreDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_ShimDataBlockSig: 
-                        if(_cshllink_readEShimDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.ShimDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_SpecialFolderDataBlockSig: 
-                        if(_cshllink_readESpecialFolderDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.SpecialFolderDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_TrackerDataBlockSig: 
-                        if(_cshllink_readETrackerDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.TrackerDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    case _CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSig: 
-                        if(_cshllink_readEVistaAndAboveIDListDataBlock(&inputStruct, info, fp)) {
-                            inputStruct->cshllink_extdatablk.VistaAndAboveIDListDataBlock.info.BlockSignature=0;
-                            return -1;
-                            }
-                        break;
-                    default: _cshllink_errint(_CSHLLINK_ERR_UNKEDBSIG);
-                }
+            //NetName
+            if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetName, _CSHLLINK_ERR_NULLPNETN, _CSHLLINK_ERR_FIO, cur))
+                    return -1;
+            
+            //DeviceName
+            if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceName, _CSHLLINK_ERR_NULLPDEVN, _CSHLLINK_ERR_FIO, cur))
+                    return -1;
+
+            if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffset>0x00000014) {
+                //NetNameUnicode
+                if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameUnicode, _CSHLLINK_ERR_NULLPNNU, _CSHLLINK_ERR_FIO, cur))
+                        return -1;
 
+                //DeviceNameUnicode
+                if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceNameUnicode, _CSHLLINK_ERR_NULLPDNU, _CSHLLINK_ERR_FIO, cur))
+                        return -1;
             }
+        }
+
+        //CommonPathSuffix
+        if(cshllink_rNULLstr(&inputStruct->cshllink_lnkinfo.CommonPathSuffix, _CSHLLINK_ERR_NULLPCPS, _CSHLLINK_ERR_FIO, cur))
+                return -1;
 
+        if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize>=0x00000024) {
+            //LocalBasePathUnicode
+            if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) {
+                if(cshllink_rNULLwstr(&inputStruct->cshllink_lnkinfo.LocalBasePathUnicode, _CSHLLINK_ERR_NULLPLBPU, _CSHLLINK_ERR_FIO, cur))
+                    return -1;
+            }
+            //CommonPathSuffixUnicode
+            if(cshllink_rNULLwstr(&inputStruct->cshllink_lnkinfo.CommonPathSuffixUnicode, _CSHLLINK_ERR_NULLPCPSU, _CSHLLINK_ERR_FIO, cur))
+                return -1;
         }
 
         return 0;
     }
 
+    uint8_t _cshllink_readStringData(cshllink *inputStruct, struct _cshllink_cursor *cur) {
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasName) {
+            //NameString
+            if(_cshllink_cread(cur, &inputStruct->cshllink_strdata.NameString.CountCharacters, 2))
+                return -1;
+            if(cshllink_rwstr(&inputStruct->cshllink_strdata.NameString.UString, _CSHLLINK_ERR_NULLPSTRDNAME, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.NameString.CountCharacters*2))
+                return -1;
+        }
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasRelativePath) {
+            //RelativePath
+            if(_cshllink_cread(cur, &inputStruct->cshllink_strdata.RelativePath.CountCharacters, 2))
+                return -1;
+            if(cshllink_rwstr(&inputStruct->cshllink_strdata.RelativePath.UString, _CSHLLINK_ERR_NULLPSTRDRPATH, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.RelativePath.CountCharacters*2))
+                return -1;
+        }
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasWorkingDir) {
+            //WorkingDir
+            if(_cshllink_cread(cur, &inputStruct->cshllink_strdata.WorkingDir.CountCharacters, 2))
+                return -1;
+            if(cshllink_rwstr(&inputStruct->cshllink_strdata.WorkingDir.UString, _CSHLLINK_ERR_NULLPSTRDWDIR, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.WorkingDir.CountCharacters*2))
+                return -1;
+        }
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasArguments) {
+            //CommandLineArguments
+            if(_cshllink_cread(cur, &inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters, 2))
+                return -1;
+            if(cshllink_rwstr(&inputStruct->cshllink_strdata.CommandLineArguments.UString, _CSHLLINK_ERR_NULLPSTRDARG, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters*2))
+                return -1;
+        }
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasIconLocation) {
+            //IconLocation
+            if(_cshllink_cread(cur, &inputStruct->cshllink_strdata.IconLocation.CountCharacters, 2))
+                return -1;
+            if(cshllink_rwstr(&inputStruct->cshllink_strdata.IconLocation.UString, _CSHLLINK_ERR_NULLPSTRDICO, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.IconLocation.CountCharacters*2))
+                return -1;
+        }
+
+        return 0;
+    }
 
     /*
-        Converts little Endian to big Endian and vice versa (size in bytes)
+        member of struct _cshllink_extdatablk for an ExtraDataBlock, indexed by the low nibble of its BlockSignature
     */
-    void cshllink_sEndian(void *inp, size_t size) {
-        for(int i=0; i<size/2; i++) {
-            uint8_t t = ((uint8_t*)inp)[size-1-i];
-            ((uint8_t*)inp)[size-1-i] = ((uint8_t*)inp)[i];
-            ((uint8_t*)inp)[i] = t;
-        }
-    }
+    #define _cshllink_edblkmember(type, member) {offsetof(struct _cshllink_extdatablk, member), sizeof(type)}
+    static const struct _cshllink_edblkmember _cshllink_edblkmembers[16] = {
+        [_CSHLLINK_EDBLK_EnvironmentVariableDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_envdblk, EnvironmentVariableDataBlock),
+        [_CSHLLINK_EDBLK_ConsoleDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_consdblk, ConsoleDataBlock),
+        [_CSHLLINK_EDBLK_TrackerDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_trackdblk, TrackerDataBlock),
+        [_CSHLLINK_EDBLK_ConsoleFEDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_consfdblk, ConsoleFEDataBlock),
+        [_CSHLLINK_EDBLK_SpecialFolderDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_specfdblk, SpecialFolderDataBlock),
+        [_CSHLLINK_EDBLK_DarwinDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_darwdblk, DarwinDataBlock),
+        [_CSHLLINK_EDBLK_IconEnvironmentDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_icoenvdblk, IconEnvironmentDataBlock),
+        [_CSHLLINK_EDBLK_ShimDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_shimblk, ShimDataBlock),
+        [_CSHLLINK_EDBLK_PropertyStoreDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_propsdblk, PropertyStoreDataBlock),
+        [_CSHLLINK_EDBLK_KnownFolderDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_knownfdblk, KnownFolderDataBlock),
+        [_CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSig&0x0F] = _cshllink_edblkmember(struct _cshllink_extdatablk_viidldblk, VistaAndAboveIDListDataBlock),
+    };
+    #undef _cshllink_edblkmember
+    // block structure of a known BlockSignature in a struct _cshllink_extdatablk (every block starts with its struct _cshllink_extdatablk_blk_info)
+    #define _cshllink_edblkAt(ed, BlockSignature) ((struct _cshllink_extdatablk_blk_info *)((uint8_t *)(ed) + _cshllink_edblkmembers[(BlockSignature)&0x0F].offset))
 
     /*
-        read NULL terminated String
+        handlers of the known ExtraDataBlocks (cshllink_blockhandler around _cshllink_readE* / _cshllink_writeE*), size is the encoded size of the block in ed
     */
-    uint32_t cshllink_rNULLstr(char **dest, uint8_t errv1, uint8_t errv2, FILE *fp) {
-        char tmpC=1;
-        uint32_t tmpS=0;
-        while(tmpC!=0) {
-            *dest = realloc(*dest, tmpS+1);
-            if(*dest==NULL)
-                _cshllink_errint(errv1);
-            if(fread(&(*dest)[tmpS], 1, 1, fp) != 1)
-                _cshllink_errint(errv2);
-            tmpC = (*dest)[tmpS];
-            tmpS++;
+    #define _cshllink_edblkhandler(Block, bytes) \
+        static uint8_t _cshllink_handlerRead##Block(cshllink *inputStruct, struct _cshllink_edblkent *entry, struct _cshllink_cursor *cur) { \
+            const struct _cshllink_extdatablk_blk_info info = {entry->BlockSize, entry->BlockSignature}; \
+            if(_cshllink_readE##Block(&inputStruct, info, cur)) { \
+                inputStruct->cshllink_extdatablk.Block.info.BlockSignature=0; \
+                return -1; \
+            } \
+            entry->block = &inputStruct->cshllink_extdatablk.Block; \
+            return 0; \
+        } \
+        static uint8_t _cshllink_handlerWrite##Block(cshllink *inputStruct, struct _cshllink_edblkent *entry, struct _cshllink_ocursor *cur) { \
+            (void)entry; \
+            return _cshllink_writeE##Block(&inputStruct, cur); \
+        } \
+        static size_t _cshllink_handlerSize##Block(const cshllink *inputStruct, const struct _cshllink_edblkent *entry) { \
+            const struct _cshllink_extdatablk *ed = &inputStruct->cshllink_extdatablk; \
+            (void)entry; (void)ed; \
+            return (bytes); \
         }
-        return 0;
+
+    _cshllink_edblkhandler(ConsoleDataBlock, _CSHLLINK_EDBLK_ConsoleDataBlockSiz)
+    _cshllink_edblkhandler(ConsoleFEDataBlock, _CSHLLINK_EDBLK_ConsoleFEDataBlockSiz)
+    _cshllink_edblkhandler(DarwinDataBlock, _CSHLLINK_EDBLK_DarwinDataBlockSiz)
+    _cshllink_edblkhandler(EnvironmentVariableDataBlock, _CSHLLINK_EDBLK_EnvironmentVariableDataBlockSiz)
+    _cshllink_edblkhandler(IconEnvironmentDataBlock, _CSHLLINK_EDBLK_IconEnvironmentDataBlockSiz)
+    _cshllink_edblkhandler(KnownFolderDataBlock, _CSHLLINK_EDBLK_KnownFolderDataBlockSiz)
+    _cshllink_edblkhandler(PropertyStoreDataBlock, ed->PropertyStoreDataBlock.info.BlockSize)
+    _cshllink_edblkhandler(ShimDataBlock, 8 + (ed->ShimDataBlock.info.BlockSize-8)/2*sizeof(char16_t))
+    _cshllink_edblkhandler(SpecialFolderDataBlock, _CSHLLINK_EDBLK_SpecialFolderDataBlockSiz)
+    _cshllink_edblkhandler(TrackerDataBlock, _CSHLLINK_EDBLK_TrackerDataBlockSiz)
+    _cshllink_edblkhandler(VistaAndAboveIDListDataBlock, 8 + _cshllink_sizeIDList(&ed->VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl))
+
+    #undef _cshllink_edblkhandler
+
+    /*
+        ExtraDataBlock handlers, indexed by the low byte of the BlockSignature (0xA00000xx)
+        a table is never changed once published: cshllink_registerBlock publishes a modified copy, replaced tables are kept (prev) as loads may still use them
+    */
+    struct _cshllink_edblktable{
+        const struct _cshllink_edblktable *prev;
+        cshllink_blockhandler handler[256];
+    };
+    #define _cshllink_edblkhandler(Block) {_cshllink_handlerRead##Block, _cshllink_handlerWrite##Block, _cshllink_handlerSize##Block, NULL}
+    static const struct _cshllink_edblktable _cshllink_edblkbuiltin = {NULL, {
+        [_CSHLLINK_EDBLK_ConsoleDataBlockSig&0xFF] = _cshllink_edblkhandler(ConsoleDataBlock),
+        [_CSHLLINK_EDBLK_ConsoleFEDataBlockSig&0xFF] = _cshllink_edblkhandler(ConsoleFEDataBlock),
+        [_CSHLLINK_EDBLK_DarwinDataBlockSig&0xFF] = _cshllink_edblkhandler(DarwinDataBlock),
+        [_CSHLLINK_EDBLK_EnvironmentVariableDataBlockSig&0xFF] = _cshllink_edblkhandler(EnvironmentVariableDataBlock),
+        [_CSHLLINK_EDBLK_IconEnvironmentDataBlockSig&0xFF] = _cshllink_edblkhandler(IconEnvironmentDataBlock),
+        [_CSHLLINK_EDBLK_KnownFolderDataBlockSig&0xFF] = _cshllink_edblkhandler(KnownFolderDataBlock),
+        [_CSHLLINK_EDBLK_PropertyStoreDataBlockSig&0xFF] = _cshllink_edblkhandler(PropertyStoreDataBlock),
+        [_CSHLLINK_EDBLK_ShimDataBlockSig&0xFF] = _cshllink_edblkhandler(ShimDataBlock),
+        [_CSHLLINK_EDBLK_SpecialFolderDataBlockSig&0xFF] = _cshllink_edblkhandler(SpecialFolderDataBlock),
+        [_CSHLLINK_EDBLK_TrackerDataBlockSig&0xFF] = _cshllink_edblkhandler(TrackerDataBlock),
+        [_CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSig&0xFF] = _cshllink_edblkhandler(VistaAndAboveIDListDataBlock),
+    }};
+    #undef _cshllink_edblkhandler
+    // atomic access of the current table: loads acquire, cshllink_registerBlock publishes with compare-and-swap (true if ptr still held expected, expected may be overwritten)
+    #if defined(_MSC_VER)
+        #define _CSHLLINK_ATOMIC volatile
+        #define _cshllink_atomicLoad(ptr) _InterlockedCompareExchangePointer((void *volatile *)(ptr), NULL, NULL)
+        #define _cshllink_atomicCas(ptr, expected, desired) (_InterlockedCompareExchangePointer((void *volatile *)(ptr), (void *)(desired), (void *)(expected))==(void *)(expected))
+    #elif defined(__GNUC__)
+        #define _CSHLLINK_ATOMIC
+        #define _cshllink_atomicLoad(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+        #define _cshllink_atomicCas(ptr, expected, desired) __atomic_compare_exchange_n((ptr), &(expected), (desired), 0, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)
+    #else
+        #define _CSHLLINK_ATOMIC _Atomic
+        #define _cshllink_atomicLoad(ptr) atomic_load_explicit((ptr), memory_order_acquire)
+        #define _cshllink_atomicCas(ptr, expected, desired) atomic_compare_exchange_strong_explicit((ptr), &(expected), (desired), memory_order_release, memory_order_acquire)
+    #endif
+    static const struct _cshllink_edblktable *_CSHLLINK_ATOMIC _cshllink_edblkhandlers = &_cshllink_edblkbuiltin;
+
+    /*
+        handler of BlockSignature, NULL if there is none (the block is copied verbatim)
+    */
+    const cshllink_blockhandler *_cshllink_edblkHandler(uint32_t BlockSignature) {
+        if((BlockSignature&0xFFFFFF00u)!=0xA0000000u)
+            return NULL;
+        const struct _cshllink_edblktable *table = _cshllink_atomicLoad(&_cshllink_edblkhandlers);
+        const cshllink_blockhandler *handler = &table->handler[BlockSignature&0xFF];
+        return handler->read!=NULL ? handler : NULL;
     }
-    uint32_t cshllink_rNULLwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, FILE *fp) {
-        char16_t tmpC=1;
-        uint32_t tmpS=0;
-        while(tmpC!=0) {
-            *dest = realloc(*dest, (tmpS+1)*sizeof(char16_t));
-            if(*dest==NULL)
-                _cshllink_errint(errv1);
-            if(fread(&(*dest)[tmpS], sizeof(char16_t), 1, fp) != 1)
-                _cshllink_errint(errv2);
-            tmpC = (*dest)[tmpS];
-            tmpS++;
+    // known ExtraDataBlocks in the order written for a new structure
+    static const uint32_t _cshllink_edblkorder[_CSHLLINK_EDBLK_NUM] = {_CSHLLINK_EDBLK_ConsoleDataBlockSig, _CSHLLINK_EDBLK_ConsoleFEDataBlockSig, _CSHLLINK_EDBLK_DarwinDataBlockSig, _CSHLLINK_EDBLK_EnvironmentVariableDataBlockSig, _CSHLLINK_EDBLK_IconEnvironmentDataBlockSig, _CSHLLINK_EDBLK_KnownFolderDataBlockSig, _CSHLLINK_EDBLK_PropertyStoreDataBlockSig, _CSHLLINK_EDBLK_ShimDataBlockSig, _CSHLLINK_EDBLK_SpecialFolderDataBlockSig, _CSHLLINK_EDBLK_TrackerDataBlockSig, _CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSig};
+
+    uint8_t _cshllink_readExtraData(cshllink *inputStruct, struct _cshllink_cursor *cur) {
+        for(;;) {
+            //missing TerminalBlock
+            if(cur->pos+4>cur->size) break;
+
+            size_t start = cur->pos;
+            struct _cshllink_extdatablk_blk_info info={0};
+            if(_cshllink_cread(cur, &info.BlockSize, 4))
+                return -1;
+            //TerminalBlock (BlockSize < 4)
+            if(info.BlockSize<4) break;
+            if(_cshllink_cread(cur, &info.BlockSignature, 4))
+                return -1;
+            _cshllink_indexSection(inputStruct, _CSHLLINK_EDBLK_KNOWN(info.BlockSignature) ? CSHLLINK_SEC_EDBLK(info.BlockSignature) : 0, info.BlockSignature, cur->base+start, info.BlockSize);
+            struct _cshllink_edblkent *entry = _cshllink_listBlock(inputStruct, cur, start, info);
+            if(entry==NULL)
+                return -1;
+
+            //block without handler (kept in raw, written back verbatim)
+            const cshllink_blockhandler *handler = _cshllink_edblkHandler(info.BlockSignature);
+            if(handler==NULL) {
+                if(_cshllink_cskip(cur, info.BlockSize-8))
+                    return -1;
+                continue;
+            }
+
+            //registered block (decoded from raw, bounded to the block)
+            if(!_CSHLLINK_EDBLK_KNOWN(info.BlockSignature)) {
+                if(_cshllink_cskip(cur, info.BlockSize-8))
+                    return -1;
+                if(_cshllink_readRawBlock(inputStruct, entry, cur))
+                    return -1;
+                continue;
+            }
+
+            //skipped block (decoded from raw by cshllink_getBlock if the input is kept)
+            if(cur->skip&CSHLLINK_SEC_EDBLK(info.BlockSignature)) {
+                if(_cshllink_cskip(cur, info.BlockSize-8))
+                    return -1;
+                inputStruct->cshllink_skipped |= CSHLLINK_SEC_EDBLK(info.BlockSignature);
+                continue;
+            }
+
+            if(handler->read(inputStruct, entry, cur))
+                return -1;
         }
+
         return 0;
     }
 
     /*
-        read String
+        append the ExtraDataBlock starting at "start" to cshllink_edblklist, growing it (raw is referenced if the cursor borrows ExtraData, copied for blocks not known to this library otherwise)
     */
-    uint32_t cshllink_rstr(char **dest, uint8_t errv1, uint8_t errv2, FILE *fp, size_t size) {
-        if(size==0) _cshllink_errint(errv1);
-        *dest = malloc(size);
-        if(*dest==NULL)
-            _cshllink_errint(errv1);
-        if(fread(*dest, 1, size, fp) != size)
-            _cshllink_errint(errv2);
-        return 0;
-    }
-    uint32_t cshllink_rwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, FILE *fp, size_t size) {
-        size/=2;
-        if(size==0) _cshllink_errint(errv1);
-        *dest = malloc(size*sizeof(char16_t));
-        if(*dest==NULL)
-            _cshllink_errint(errv1);
-        if(fread(*dest, sizeof(char16_t), size, fp) != size)
-            _cshllink_errint(errv2);
-        return 0;
+    struct _cshllink_edblkent *_cshllink_listBlock(cshllink *inputStruct, struct _cshllink_cursor *cur, size_t start, const struct _cshllink_extdatablk_blk_info info) {
+        if(inputStruct->cshllink_edblklistnum>=inputStruct->cshllink_edblklistcap) {
+            if(inputStruct->cshllink_edblklistcap==UINT16_MAX) {
+                _cshllink_seterr(_CSHLLINK_ERR_EDBLKNUM);
+                return NULL;
+            }
+            size_t cap = inputStruct->cshllink_edblklistcap==0 ? _CSHLLINK_EDBLKLIST_INIT : inputStruct->cshllink_edblklistcap*2;
+            if(cap>UINT16_MAX)
+                cap = UINT16_MAX;
+            struct _cshllink_edblkent *list = inputStruct->cshllink_edblklist==NULL ? _cshllink_curAlloc(cur, cap * sizeof *list) : _cshllink_realloc(cur->alloc, inputStruct->cshllink_edblklist, cap * sizeof *list);
+            if(list==NULL) {
+                _cshllink_seterr(_CSHLLINK_ERR_NULLPEXTD);
+                return NULL;
+            }
+            inputStruct->cshllink_edblklist = list;
+            inputStruct->cshllink_edblklistcap = cap;
+        }
+        if(info.BlockSize<8) {
+            _cshllink_seterr(_CSHLLINK_ERRX_WRONGSIZE);
+            return NULL;
+        }
+        if(info.BlockSize>cur->size-start) {
+            _cshllink_seterr(_CSHLLINK_ERR_FIO);
+            return NULL;
+        }
+        struct _cshllink_edblkent *entry = &inputStruct->cshllink_edblklist[inputStruct->cshllink_edblklistnum];
+        entry->BlockSignature = info.BlockSignature;
+        entry->BlockSize = info.BlockSize;
+        entry->offset = cur->base+start;
+        entry->block = NULL;
+        entry->raw = (cur->borrow&cur->section) || !_CSHLLINK_EDBLK_KNOWN(info.BlockSignature) ? _cshllink_decodeBuf(cur->data+start, info.BlockSize, cur) : NULL;
+        if(entry->raw==NULL && !_CSHLLINK_EDBLK_KNOWN(info.BlockSignature)) {
+            _cshllink_seterr(_CSHLLINK_ERR_NULLPEXTD);
+            return NULL;
+        }
+        inputStruct->cshllink_edblklistnum++;
+        return entry;
     }
 
     /*
-        Extra Data Block read functions
+        decode an ExtraDataBlock of cshllink_edblklist from its raw bytes with its handler (parent: cursor of the load, NULL on first access)
     */
-    uint8_t _cshllink_readEConsoleDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
-        if((*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSignature!=0)
-            _cshllink_errint(_CSHLLINK_DUPEEX_ConsoleDataBlock);
+    uint8_t _cshllink_readRawBlock(cshllink *inputStruct, struct _cshllink_edblkent *entry, const struct _cshllink_cursor *parent) {
+        const cshllink_blockhandler *handler = _cshllink_edblkHandler(entry->BlockSignature);
+        if(handler==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_UNKEDBSIG);
+        struct _cshllink_cursor cur = {0};
+        cur.data = entry->raw;
+        cur.size = entry->BlockSize;
+        cur.pos = 8;
+        // registered handlers always copy: raw may point into a view that goes away
+        cur.borrow = _CSHLLINK_EDBLK_KNOWN(entry->BlockSignature) ? inputStruct->cshllink_borrowed : 0;
+        cur.section = CSHLLINK_SEC_EXTRADATA;
+        cur.base = entry->offset;
+        if(parent!=NULL) {
+            cur.ctx = parent->ctx;
+            cur.alloc = parent->alloc;
+            cur.pool = parent->pool;
+        }
+        else
+            cur.alloc = inputStruct->cshllink_allocator!=NULL ? inputStruct->cshllink_allocator : cshllink_getAllocator();
+        return handler->read(inputStruct, entry, &cur);
+    }
 
-        (*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSignature = _CSHLLINK_EDBLK_ConsoleDataBlockSig;
+    /*
+        -> cshllink structure pointer (loaded)
+        -> BlockSignature of a known or registered ExtraDataBlock (_CSHLLINK_EDBLK_*Sig, cshllink_registerBlock)
+        -- returns the decoded block; a block skipped by cshllink_loadViewSkip / cshllink_loadMappedSkip (keep) or loaded before its handler was registered is decoded from the kept input on first access
+        <- block structure (e.g. struct _cshllink_extdatablk_trackdblk * for _CSHLLINK_EDBLK_TrackerDataBlockSig, entry->block of the handler otherwise), NULL on error or if the block is not present
+
+        no load decodes lazily by default: without a skip mask the block was decoded while loading and is only looked up
+        with cshllink_trackDirty, changes made through the block need cshllink_setDirty(inputStruct, CSHLLINK_SEC_EXTRADATA) to be written
+        exact error codes are stored in cshllink_error (0 if the block is not present)
+    */
+    void *cshllink_getBlock(cshllink *inputStruct, uint32_t BlockSignature) {
+        _cshllink_seterr(0);
+        if(inputStruct==NULL) {
+            _cshllink_seterr(_CSHLLINK_ERR_NULLPA);
+            return NULL;
+        }
+        if(_cshllink_edblkHandler(BlockSignature)==NULL) {
+            _cshllink_seterr(_CSHLLINK_ERR_UNKEDBSIG);
+            return NULL;
+        }
+        //registered block: first one of the list
+        if(!_CSHLLINK_EDBLK_KNOWN(BlockSignature)) {
+            for(int i=0; i<inputStruct->cshllink_edblklistnum; i++) {
+                struct _cshllink_edblkent *entry = &inputStruct->cshllink_edblklist[i];
+                if(entry->BlockSignature!=BlockSignature)
+                    continue;
+                if(entry->block==NULL && entry->raw!=NULL && _cshllink_readRawBlock(inputStruct, entry, NULL))
+                    return NULL;
+                return entry->block;
+            }
+            return NULL;
+        }
+        struct _cshllink_extdatablk_blk_info *block = _cshllink_edblkAt(&inputStruct->cshllink_extdatablk, BlockSignature);
+        if(block->BlockSignature==BlockSignature)
+            return block;
+        if(!(inputStruct->cshllink_skipped&CSHLLINK_SEC_EDBLK(BlockSignature)))
+            return NULL;
+
+        //skipped block: decode from the kept input
+        for(int i=0; i<inputStruct->cshllink_edblklistnum; i++) {
+            struct _cshllink_edblkent *entry = &inputStruct->cshllink_edblklist[i];
+            if(entry->BlockSignature!=BlockSignature || entry->raw==NULL)
+                continue;
+            if(_cshllink_readRawBlock(inputStruct, entry, NULL))
+                return NULL;
+            inputStruct->cshllink_skipped &= ~CSHLLINK_SEC_EDBLK(BlockSignature);
+            return block;
+        }
+        return NULL;
+    }
 
-        if(info.BlockSize!=_CSHLLINK_EDBLK_ConsoleDataBlockSiz)
-            _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
-        (*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSize=info.BlockSize;
+    /*
+        -> BlockSignature 0xA00000xx not known to this library
+        -> handler (copied, read, write and size are required), NULL removes the handler
+        -- blocks of this signature are decoded by handler->read on load and encoded by handler->write, instead of being copied verbatim
+        <- on error this function will return -1, on success 0
 
-        //FillAttributes
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FillAttributes, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        the table is shared by all threads and may be changed while other threads load: loads already running keep the handlers they started with
+        every call allocates a copy of the table (8 KB, never released), keep the handler as long as structures decoded with it exist
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_registerBlock(uint32_t BlockSignature, const cshllink_blockhandler *handler) {
+        if((BlockSignature&0xFFFFFF00u)!=0xA0000000u || _CSHLLINK_EDBLK_KNOWN(BlockSignature))
+            _cshllink_errint(_CSHLLINK_ERR_EDBLKHDL);
+        if(handler!=NULL && (handler->read==NULL || handler->write==NULL || handler->size==NULL))
+            _cshllink_errint(_CSHLLINK_ERR_EDBLKHDL);
+        struct _cshllink_edblktable *table = _cshllink_alloc(NULL, sizeof *table);
+        if(table==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+
+        // copy the current table and publish the copy, retried if another thread registered in between
+        const struct _cshllink_edblktable *current;
+        do {
+            current = _cshllink_atomicLoad(&_cshllink_edblkhandlers);
+            table->prev = current;
+            memcpy(table->handler, current->handler, sizeof table->handler);
+            if(handler!=NULL)
+                table->handler[BlockSignature&0xFF] = *handler;
+            else
+                memset(&table->handler[BlockSignature&0xFF], 0, sizeof *table->handler);
+        } while(!_cshllink_atomicCas(&_cshllink_edblkhandlers, current, table));
+        return 0;
+    }
 
-        //PopupFillAttributes
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.PopupFillAttributes, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        read IDList ("size" in bytes without the TerminalBlock)
+    */
+    uint8_t _cshllink_readIDList(struct _cshllink_lnktidl_idl *list, int size, struct _cshllink_cursor *cur) {
+        list->idl_inum=0;
+        list->idl_blobcap=0;
+        list->idl_offcap=0;
+        list->idl_allocator=cur->alloc;
+        if(size<0)
+            _cshllink_errint(_CSHLLINK_ERR_INVIDL);
+        list->idl_bloblen=size;
+
+        //ItemIDs (one blob, as stored in the file)
+        if(cur->borrow&cur->section) {
+            if(_cshllink_cref(cur, (const void **)&list->idl_blob, size))
+                return -1;
+        }
+        else {
+            list->idl_blob = _cshllink_curAlloc(cur, size ? size : 1);
+            if(list->idl_blob==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPIDLM);
+            list->idl_blobcap = size ? size : 1;
+            if(_cshllink_cread(cur, list->idl_blob, size))
+                return -1;
+        }
 
-        //ScreenBufferSizeX
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.ScreenBufferSizeX, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        //count items (walk the size fields), the items must fill the blob exactly
+        size_t num=0;
+        for(uint32_t p=0; p<list->idl_bloblen;) {
+            uint16_t isize;
+            if(p+2>list->idl_bloblen)
+                _cshllink_errint(_CSHLLINK_ERR_INVIDL);
+            memcpy(&isize, list->idl_blob+p, 2);
+            if(isize<2 || p+isize>list->idl_bloblen)
+                _cshllink_errint(_CSHLLINK_ERR_INVIDL);
+            p+=isize;
+            num++;
+        }
+        if(num>UINT16_MAX)
+            _cshllink_errint(_CSHLLINK_ERR_INVIDL);
 
-        //ScreenBufferSizeY
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.ScreenBufferSizeY, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-        
-        //WindowSizeX
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.WindowSizeX, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-        
-        //WindowSizeY
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.WindowSizeY, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        //offsets
+        list->idl_off = _cshllink_curAlloc(cur, (num ? num : 1)* sizeof *list->idl_off);
+        if(list->idl_off==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+        list->idl_offcap = num ? num : 1;
+        for(uint32_t p=0; p<list->idl_bloblen;) {
+            uint16_t isize;
+            memcpy(&isize, list->idl_blob+p, 2);
+            list->idl_off[list->idl_inum++] = p;
+            p+=isize;
+        }
 
-        //WindowOriginX
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.WindowOriginX, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        uint16_t nullb;
+        if(_cshllink_cread(cur, &nullb, 2))
+            return -1;
+        if(nullb!=0)
+            _cshllink_errint(_CSHLLINK_ERR_INVIDL);
 
-        //WindowOriginY
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.WindowOriginY, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-    
-        fseek(fp, 8, SEEK_CUR);
+        return 0;
+    }
 
-        //FontSize
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FontSize, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-    
-        //FontFamily
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FontFamily, 4, 1, fp)!=1)
+    /*
+        read "size" bytes from the cursor (bounds-checked)
+    */
+    uint8_t _cshllink_cread(struct _cshllink_cursor *cur, void *dest, size_t size) {
+        if(size>cur->size-cur->pos)
             _cshllink_errint(_CSHLLINK_ERR_FIO);
+        if(size==0)
+            return 0;
+        memcpy(dest, cur->data+cur->pos, size);
+        cur->pos+=size;
+        return 0;
+    }
 
-        //FontWeight
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FontWeight, 4, 1, fp)!=1)
+    /*
+        skip "size" bytes of the cursor (bounds-checked)
+    */
+    uint8_t _cshllink_cskip(struct _cshllink_cursor *cur, size_t size) {
+        if(size>cur->size-cur->pos)
             _cshllink_errint(_CSHLLINK_ERR_FIO);
+        cur->pos+=size;
+        return 0;
+    }
 
-        //FaceName
-        if(cshllink_rwstr(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FaceName, _CSHLLINK_ERRX_NULLPSTRFNAME, _CSHLLINK_ERR_FIO, fp, 32))
-            return -1;
-
-        //CursorSize
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.CursorSize, 4, 1, fp)!=1)
+    /*
+        reference "size" bytes of the cursor without copying (bounds-checked)
+    */
+    uint8_t _cshllink_cref(struct _cshllink_cursor *cur, const void **dest, size_t size) {
+        if(size>cur->size-cur->pos)
             _cshllink_errint(_CSHLLINK_ERR_FIO);
+        *dest = cur->data+cur->pos;
+        cur->pos+=size;
+        return 0;
+    }
 
-        //FullScreen
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FullScreen, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-        
-        //QuickEdit
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.QuickEdit, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        Converts little Endian to big Endian and vice versa (size in bytes)
+    */
+    void cshllink_sEndian(void *inp, size_t size) {
+        for(int i=0; i<size/2; i++) {
+            uint8_t t = ((uint8_t*)inp)[size-1-i];
+            ((uint8_t*)inp)[size-1-i] = ((uint8_t*)inp)[i];
+            ((uint8_t*)inp)[i] = t;
+        }
+    }
 
-        //InsertMode
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.InsertMode, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        read NULL terminated String
+    */
+    uint32_t cshllink_rNULLstr(char **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_cursor *cur) {
+        // length including the terminator, the string is allocated once
+        const uint8_t *end = memchr(cur->data+cur->pos, 0, cur->size-cur->pos);
+        if(end==NULL)
+            _cshllink_errint(errv2);
+        size_t len = end-(cur->data+cur->pos)+1;
+        if(cur->borrow&cur->section) {
+            if(_cshllink_cref(cur, (const void **)dest, len))
+                _cshllink_errint(errv2);
+            return 0;
+        }
+        *dest = _cshllink_curAlloc(cur, len);
+        if(*dest==NULL)
+            _cshllink_errint(errv1);
+        if(_cshllink_cread(cur, *dest, len))
+            _cshllink_errint(errv2);
+        return 0;
+    }
+    uint32_t cshllink_rNULLwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_cursor *cur) {
+        // length including the terminator, the string is allocated once
+        size_t len = _cshllink_scan16(cur->data+cur->pos, cur->size-cur->pos);
+        if(len+2>cur->size-cur->pos)
+            _cshllink_errint(errv2);
+        len += 2;
+        if(cur->borrow&cur->section) {
+            if(_cshllink_cref(cur, (const void **)dest, len))
+                _cshllink_errint(errv2);
+            return 0;
+        }
+        *dest = _cshllink_curAlloc(cur, len);
+        if(*dest==NULL)
+            _cshllink_errint(errv1);
+        if(_cshllink_cread(cur, *dest, len))
+            _cshllink_errint(errv2);
+        return 0;
+    }
 
-        //AutoPosition
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.AutoPosition, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        read String
+    */
+    uint32_t cshllink_rstr(char **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_cursor *cur, size_t size) {
+        if(size==0) _cshllink_errint(errv1);
+        if(cur->borrow&cur->section) {
+            if(_cshllink_cref(cur, (const void **)dest, size))
+                _cshllink_errint(errv2);
+            return 0;
+        }
+        *dest = _cshllink_curAlloc(cur, size);
+        if(*dest==NULL)
+            _cshllink_errint(errv1);
+        if(_cshllink_cread(cur, *dest, size))
+            _cshllink_errint(errv2);
+        return 0;
+    }
+    uint32_t cshllink_rwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_cursor *cur, size_t size) {
+        size/=2;
+        if(size==0) _cshllink_errint(errv1);
+        if(cur->borrow&cur->section) {
+            if(_cshllink_cref(cur, (const void **)dest, size*sizeof(char16_t)))
+                _cshllink_errint(errv2);
+            return 0;
+        }
+        *dest = _cshllink_curAlloc(cur, size*sizeof(char16_t));
+        if(*dest==NULL)
+            _cshllink_errint(errv1);
+        if(_cshllink_cread(cur, *dest, size*sizeof(char16_t)))
+            _cshllink_errint(errv2);
+        return 0;
+    }
 
-        //HistoryBufferSize
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.HistoryBufferSize, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        read the body of an ExtraDataBlock with a fixed layout (BlockSize: layout->size + 8)
+    */
+    uint8_t _cshllink_readFixedBlock(const struct _cshllink_layout *layout, void *block, struct _cshllink_cursor *cur) {
+        const void *raw;
+        if(_cshllink_cref(cur, &raw, layout->size))
+            return -1;
+        return layout->decode(raw, layout->size, block, cur);
+    }
 
-        //NumberOfHistoryBuffers
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.NumberOfHistoryBuffers, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        Extra Data Block read functions
+    */
+    uint8_t _cshllink_readEConsoleDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
+        if((*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSignature!=0)
+            _cshllink_errint(_CSHLLINK_DUPEEX_ConsoleDataBlock);
 
-        //HistoryNoDup
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.HistoryNoDup, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        (*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSignature = _CSHLLINK_EDBLK_ConsoleDataBlockSig;
 
-        //AutoPosition
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.AutoPosition, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-       
-        //ColorTable
-        for(int i=0; i<16; i++)
-            if(fread(&(*input)->cshllink_extdatablk.ConsoleDataBlock.ColorTable[i], 4, 1, fp)!=1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        if(info.BlockSize!=_CSHLLINK_EDBLK_ConsoleDataBlockSiz)
+            _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
+        (*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSize=info.BlockSize;
 
-        return 0;
+        //FillAttributes to ColorTable
+        return _cshllink_readFixedBlock(&_cshllink_layoutConsole, &(*input)->cshllink_extdatablk.ConsoleDataBlock, cur);
     }
 
-    uint8_t _cshllink_readEConsoleFEDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readEConsoleFEDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.ConsoleFEDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_ConsoleFEDataBlock);
         
@@ -643,13 +1949,10 @@
         (*input)->cshllink_extdatablk.ConsoleFEDataBlock.info.BlockSize=info.BlockSize;
 
         //CodePage
-        if(fread(&(*input)->cshllink_extdatablk.ConsoleFEDataBlock.CodePage, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        return 0;
+        return _cshllink_readFixedBlock(&_cshllink_layoutConsoleFE, &(*input)->cshllink_extdatablk.ConsoleFEDataBlock, cur);
     }
 
-    uint8_t _cshllink_readEDarwinDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readEDarwinDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.DarwinDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_DarwinDataBlock);
         
@@ -659,18 +1962,11 @@
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
         (*input)->cshllink_extdatablk.DarwinDataBlock.info.BlockSize=info.BlockSize;
 
-        //DarwinDataAnsi
-        if(cshllink_rstr(&(*input)->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi, _CSHLLINK_ERRX_NULLPSTRDARDA, _CSHLLINK_ERR_FIO, fp, 260))
-            return -1;
-        
-        //DarwinDataUnicode
-        if(cshllink_rwstr(&(*input)->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode, _CSHLLINK_ERRX_NULLPSTRDARDU, _CSHLLINK_ERR_FIO, fp, 520))
-            return -1;
-
-        return 0;
+        //DarwinDataAnsi, DarwinDataUnicode
+        return _cshllink_readFixedBlock(&_cshllink_layoutDarwin, &(*input)->cshllink_extdatablk.DarwinDataBlock, cur);
     }
 
-    uint8_t _cshllink_readEEnvironmentVariableDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readEEnvironmentVariableDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_EnvironmentVariableDataBlock);
         
@@ -680,18 +1976,11 @@
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
         (*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.info.BlockSize=info.BlockSize;
 
-        //EnvironmentVariableDataAnsi
-        if(cshllink_rstr(&(*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi, _CSHLLINK_ERRX_NULLPSTRENVDA, _CSHLLINK_ERR_FIO, fp, 260))
-            return -1;
-        
-        //EnvironmentVariableDataUnicode
-        if(cshllink_rwstr(&(*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode, _CSHLLINK_ERRX_NULLPSTRENVDU, _CSHLLINK_ERR_FIO, fp, 520))
-            return -1;
-
-        return 0;
+        //EnvironmentVariableDataAnsi, EnvironmentVariableDataUnicode
+        return _cshllink_readFixedBlock(&_cshllink_layoutEnvironment, &(*input)->cshllink_extdatablk.EnvironmentVariableDataBlock, cur);
     }
 
-    uint8_t _cshllink_readEIconEnvironmentDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readEIconEnvironmentDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.IconEnvironmentDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_IconEnvironmentDataBlock);
         
@@ -700,18 +1989,12 @@
         if(info.BlockSize!=_CSHLLINK_EDBLK_IconEnvironmentDataBlockSiz)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
         (*input)->cshllink_extdatablk.IconEnvironmentDataBlock.info.BlockSize=info.BlockSize;
-        //IconEnvironmentDataAnsi
-        if(cshllink_rstr(&(*input)->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi, _CSHLLINK_ERRX_NULLPSTRIENVDA, _CSHLLINK_ERR_FIO, fp, 260))
-            return -1;
-
-        //IconEnvironmentDataUnicode
-        if(cshllink_rwstr(&(*input)->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode, _CSHLLINK_ERRX_NULLPSTRIENVDU, _CSHLLINK_ERR_FIO, fp, 520))
-            return -1;
 
-        return 0;
+        //IconEnvironmentDataAnsi, IconEnvironmentDataUnicode
+        return _cshllink_readFixedBlock(&_cshllink_layoutIconEnvironment, &(*input)->cshllink_extdatablk.IconEnvironmentDataBlock, cur);
     }
 
-    uint8_t _cshllink_readEKnownFolderDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readEKnownFolderDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.KnownFolderDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_KnownFolderDataBlock);
         
@@ -721,18 +2004,11 @@
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
         (*input)->cshllink_extdatablk.KnownFolderDataBlock.info.BlockSize=info.BlockSize;
 
-        //KnownFolderID
-        if(cshllink_rstr((char **)&(*input)->cshllink_extdatablk.KnownFolderDataBlock.KnownFolderID, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, 16))
-            return -1;
-        
-        //Offset
-        if(fread(&(*input)->cshllink_extdatablk.KnownFolderDataBlock.Offset, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        return 0;
+        //KnownFolderID, Offset
+        return _cshllink_readFixedBlock(&_cshllink_layoutKnownFolder, &(*input)->cshllink_extdatablk.KnownFolderDataBlock, cur);
     }
 
-    uint8_t _cshllink_readEPropertyStoreDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readEPropertyStoreDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_PropertyStoreDataBlock);
         
@@ -743,13 +2019,13 @@
         (*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSize=info.BlockSize;
 
         //PropertyStore
-        if(cshllink_rstr((char **)&(*input)->cshllink_extdatablk.KnownFolderDataBlock.KnownFolderID, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, (*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSize-8))
+        if(cshllink_rstr((char **)&(*input)->cshllink_extdatablk.PropertyStoreDataBlock.PropertyStore, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, cur, (*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSize-8))
             return -1;
 
         return 0;
     }
 
-    uint8_t _cshllink_readEShimDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readEShimDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_ShimDataBlock);
         
@@ -760,13 +2036,13 @@
         (*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSize=info.BlockSize;
 
         //LayerName
-        if(cshllink_rwstr(&(*input)->cshllink_extdatablk.ShimDataBlock.LayerName, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, (*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSize-8))
+        if(cshllink_rwstr(&(*input)->cshllink_extdatablk.ShimDataBlock.LayerName, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, cur, (*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSize-8))
             return -1;
 
         return 0;
     }
 
-    uint8_t _cshllink_readESpecialFolderDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readESpecialFolderDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.SpecialFolderDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_SpecialFolderDataBlock);
         
@@ -776,18 +2052,11 @@
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
         (*input)->cshllink_extdatablk.SpecialFolderDataBlock.info.BlockSize=info.BlockSize;
 
-        //SpecialFolderID
-        if(fread(&(*input)->cshllink_extdatablk.SpecialFolderDataBlock.SpecialFolderID, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //Offset
-        if(fread(&(*input)->cshllink_extdatablk.SpecialFolderDataBlock.Offset, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        return 0;
+        //SpecialFolderID, Offset
+        return _cshllink_readFixedBlock(&_cshllink_layoutSpecialFolder, &(*input)->cshllink_extdatablk.SpecialFolderDataBlock, cur);
     }
 
-    uint8_t _cshllink_readETrackerDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readETrackerDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.TrackerDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_TrackerDataBlock);
         (*input)->cshllink_extdatablk.TrackerDataBlock.info.BlockSignature = _CSHLLINK_EDBLK_TrackerDataBlockSig;
@@ -796,35 +2065,18 @@
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
         (*input)->cshllink_extdatablk.TrackerDataBlock.info.BlockSize=info.BlockSize;
 
-        //Length
-        if(fread(&(*input)->cshllink_extdatablk.TrackerDataBlock.Length, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        //Length, Version, MachineID, Droid, DroidBirth
+        if(_cshllink_readFixedBlock(&_cshllink_layoutTracker, &(*input)->cshllink_extdatablk.TrackerDataBlock, cur))
+            return -1;
         if((*input)->cshllink_extdatablk.TrackerDataBlock.Length!=_CSHLLINK_EDBLK_TrackerDataBlockLen)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
-
-        //Version
-        if(fread(&(*input)->cshllink_extdatablk.TrackerDataBlock.Version, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
         if((*input)->cshllink_extdatablk.TrackerDataBlock.Version!=0)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGVERSION);
-        
-        //MachineID
-        if(cshllink_rstr(&(*input)->cshllink_extdatablk.TrackerDataBlock.MachineID, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, 16))
-            return -1;
-
-        //Droid
-        if(cshllink_rstr((char **)&(*input)->cshllink_extdatablk.TrackerDataBlock.Droid, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, 32))
-            return -1;
-
-        //DroidBirth
-        if(cshllink_rstr((char **)&(*input)->cshllink_extdatablk.TrackerDataBlock.DroidBirth, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, 32))
-            return -1;
-
 
         return 0;
     }
 
-    uint8_t _cshllink_readEVistaAndAboveIDListDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp) {
+    uint8_t _cshllink_readEVistaAndAboveIDListDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur) {
         if((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.info.BlockSignature!=0)
             _cshllink_errint(_CSHLLINK_DUPEEX_VistaAndAboveIDListDataBlock);
         
@@ -834,38 +2086,9 @@
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
         (*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.info.BlockSize=info.BlockSize;
 
-        int tmpS=(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.info.BlockSize=info.BlockSize-10;
-
-        //realloc enough mem
-        (*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item = realloc((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item, (tmpS)* sizeof *(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item);
-        if((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item==NULL) 
-            _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
-
-        while(tmpS>0) {
-            
-            //Element size
-            if(fread(&(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum].item_size, 2, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            //Element (size -2 as struct contains one 2byte var)
-            (*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum].item = malloc(((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum].item_size-2) * sizeof *(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum].item);
-            if((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum].item==NULL)
-                _cshllink_errint(_CSHLLINK_ERR_NULLPIDLM);
-            if(fread((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum].item, (*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum].item_size-2, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            tmpS-=(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum].item_size;
-            (*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum++;
-        }
-        //free unneccessary mem
-        (*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item = realloc((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item, ((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum)* sizeof *(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item);
-        if((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item==NULL) 
-            _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
-
-        uint16_t nullb;
-        if(fread(&nullb, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(tmpS<0||nullb!=0)
-            _cshllink_errint(_CSHLLINK_ERR_INVIDL);  
+        //IDList
+        if(_cshllink_readIDList(&(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl, info.BlockSize-10, cur))
+            return -1;
 
         return 0;
     }
@@ -880,9 +2103,25 @@
         -- writes content to file
         <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
 
+        all sections are encoded from the structure; after cshllink_trackDirty the sections not modified since loading are copied from the input byte for byte
         exact error codes are stored in cshllink_error
     */
     uint8_t cshllink_writeFile(FILE *fp, cshllink *inputStruct) {
+        return cshllink_writeFileCtx(fp, inputStruct, NULL);
+    }
+
+    /*
+        same as cshllink_writeFile, the error code and position are also stored in ctx (may be NULL)
+    */
+    uint8_t cshllink_writeFileCtx(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx) {
+        _cshllink_ctxBegin(ctx);
+        return _cshllink_ctxEnd(ctx, _cshllink_writeFileChecked(fp, inputStruct, ctx));
+    }
+
+    /*
+        argument checks of cshllink_writeFile
+    */
+    uint8_t _cshllink_writeFileChecked(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx) {
 
         // test if FILE is open
         if(fp==NULL) 
@@ -897,608 +2136,895 @@
         }
 
         // write FILE
-        return cshllink_writeFile_i(fp, inputStruct);
+        return _cshllink_writeFile(fp, inputStruct, ctx);
     }
 
     /*
-        Processes outputFile
+        Processes outputFile (serializes into one buffer and writes it with a single fwrite)
     */
     uint8_t cshllink_writeFile_i(FILE *fp, cshllink *inputStruct) {
-        
-        fseek(fp, 0, SEEK_SET);
+        return _cshllink_writeFile(fp, inputStruct, NULL);
+    }
+    uint8_t _cshllink_writeFile(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx) {
+
+        size_t size = cshllink_serializedSize(inputStruct);
+        if(size==0)
+            return -1;
+
+        // shell links are small, most fit into the stack buffer
+        uint8_t stackbuf[_CSHLLINK_LOADBUF_STACK];
+        uint8_t *buf = stackbuf;
+        if(size>_CSHLLINK_LOADBUF_STACK) {
+            buf = _cshllink_alloc(inputStruct->cshllink_allocator, size);
+            if(buf==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        }
+
+        uint8_t ret = _cshllink_writeBufferChecked(inputStruct, buf, size, NULL, ctx);
+        if(ret==0) {
+            fseek(fp, 0, SEEK_SET);
+            if(fwrite(buf, 1, size, fp)!=size) {
+                _cshllink_seterr(_CSHLLINK_ERR_FIO);
+                ret = -1;
+            }
+        }
+
+        if(buf!=stackbuf)
+            _cshllink_dealloc(inputStruct->cshllink_allocator, buf);
+        return ret;
+    }
+
+    /*
+        -> open file descriptor (write access, regular file)
+        -> cshllink structure pointer
+        -- writes content to the start of the file with a single pwritev (heap buffers of inputStruct are not copied) and truncates the file to the written length
+        <- on error this function will return -1 (the content of the file is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_writeFd(int fd, cshllink *inputStruct) {
+
+        if(fd<0)
+            _cshllink_errint(_CSHLLINK_ERR_FCL);
+
+        size_t size = cshllink_serializedSize(inputStruct);
+        if(size==0)
+            return -1;
+
+        // buffer for the copied parts (header fields, sizes, ...), never more than the whole output
+        uint8_t stackbuf[_CSHLLINK_LOADBUF_STACK];
+        uint8_t *buf = stackbuf;
+        if(size>_CSHLLINK_LOADBUF_STACK) {
+            buf = _cshllink_alloc(inputStruct->cshllink_allocator, size);
+            if(buf==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        }
+
+        uint8_t ret = 0;
+        #ifndef _WIN32
+        struct iovec iov[_CSHLLINK_WRITEV_IOV];
+        struct _cshllink_ocursor cur = {0};
+        cur.data = buf;
+        cur.size = size;
+        cur.iov = iov;
+        cur.iovmax = _CSHLLINK_WRITEV_IOV;
+
+        if(_cshllink_serialize(&cur, inputStruct))
+            ret = -1;
+        else {
+            // single positioned writev, continued only if the kernel accepted a partial write
+            struct iovec *v = iov;
+            int vcnt = cur.iovcnt;
+            off_t off = 0;
+            while(vcnt>0) {
+                ssize_t n = pwritev(fd, v, vcnt, off);
+                if(n<=0) {
+                    _cshllink_seterr(_CSHLLINK_ERR_FIO);
+                    ret = -1;
+                    break;
+                }
+                off+=n;
+                while(vcnt>0 && (size_t)n>=v->iov_len) {
+                    n-=v->iov_len;
+                    v++;
+                    vcnt--;
+                }
+                if(vcnt>0) {
+                    v->iov_base = (uint8_t *)v->iov_base+n;
+                    v->iov_len-=n;
+                }
+            }
+            // drop stale bytes of a previously longer file
+            if(ret==0 && ftruncate(fd, size)!=0) {
+                _cshllink_seterr(_CSHLLINK_ERR_FIO);
+                ret = -1;
+            }
+        }
+        #else
+        if(cshllink_writeBuffer(inputStruct, buf, size, NULL))
+            ret = -1;
+        else if(_lseek(fd, 0, SEEK_SET)!=0 || _write(fd, buf, (unsigned int)size)!=(int)size || _chsize_s(fd, size)!=0) {
+            _cshllink_seterr(_CSHLLINK_ERR_FIO);
+            ret = -1;
+        }
+        #endif
+
+        if(buf!=stackbuf)
+            _cshllink_dealloc(inputStruct->cshllink_allocator, buf);
+        return ret;
+    }
+
+    /*
+        -> cshllink structure pointer
+        -- computes the exact number of bytes cshllink_writeBuffer / cshllink_writeFile emit for inputStruct (from the header flags, IDList items, LinkInfo, StringData and ExtraDataBlocks, the input size of sections copied verbatim)
+        <- size in bytes, 0 on error
+
+        exact error codes are stored in cshllink_error
+    */
+    size_t cshllink_serializedSize(const cshllink *inputStruct) {
+        if(inputStruct==NULL) {
+            _cshllink_seterr(_CSHLLINK_ERR_NULLPA);
+            return 0;
+        }
+        if(_cshllink_unwritable(inputStruct)) {
+            _cshllink_seterr(_CSHLLINK_ERR_SKIPPED);
+            return 0;
+        }
+
+        //HEADER
+        size_t size = _CSHLLINK_HEADERSIZE;
+
+        //sections copied from the input (size from the section index)
+        uint32_t verbatim = _cshllink_verbatim(inputStruct);
+        #define _cshllink_sizeVerbatim(section) (cshllink_findSection(inputStruct, section)->size)
+
+        //LinkTargetIDList (IDList size, items, TerminalBlock)
+        if(verbatim&CSHLLINK_SEC_LINKTARGETIDLIST)
+            size += _cshllink_sizeVerbatim(CSHLLINK_SEC_LINKTARGETIDLIST);
+        else if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkTargetIDList)
+            size += 2 + _cshllink_sizeIDList(&inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl);
+
+        //LinkInfo
+        if(verbatim&CSHLLINK_SEC_LINKINFO)
+            size += _cshllink_sizeVerbatim(CSHLLINK_SEC_LINKINFO);
+        else if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkInfo) {
+            const struct _cshllink_lnkinfo *li = &inputStruct->cshllink_lnkinfo;
+            size += 28;
+            if(li->LinkInfoHeaderSize>=0x00000024)
+                size += 8;
+            if(li->LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) {
+                int VtmpSize = li->cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014 ? 20 : 16;
+                size += VtmpSize;
+                if(li->cshllink_lnkinfo_volid.VolumeIDSize>VtmpSize) {
+                    if(li->cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014)
+                        size += (li->cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize)/2*sizeof(char16_t);
+                    else
+                        size += li->cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize;
+                }
+                size += _cshllink_sizeNULLstr(li->LocalBasePath);
+            }
+            if(li->LinkInfoFlags&CSHLLINK_LIF_CommonNetworkRelativeLinkAndPathSuffix) {
+                size += 20;
+                size += _cshllink_sizeNULLstr(li->cshllink_lnkinfo_cnetrlnk.NetName);
+                size += _cshllink_sizeNULLstr(li->cshllink_lnkinfo_cnetrlnk.DeviceName);
+                if(li->cshllink_lnkinfo_cnetrlnk.NetNameOffset>0x00000014) {
+                    size += 8;
+                    size += _cshllink_sizeNULLstr(li->cshllink_lnkinfo_cnetrlnk.NetNameUnicode);
+                    size += _cshllink_sizeNULLstr(li->cshllink_lnkinfo_cnetrlnk.DeviceNameUnicode);
+                }
+            }
+            size += _cshllink_sizeNULLstr(li->CommonPathSuffix);
+            if(li->LinkInfoHeaderSize>=0x00000024) {
+                if(li->LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath)
+                    size += _cshllink_sizeNULLwstr(li->LocalBasePathUnicode);
+                size += _cshllink_sizeNULLwstr(li->CommonPathSuffixUnicode);
+            }
+        }
+
+        //StringData (CountCharacters, UString)
+        if(verbatim&CSHLLINK_SEC_STRINGDATA)
+            size += _cshllink_sizeVerbatim(CSHLLINK_SEC_STRINGDATA);
+        else {
+            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasName)
+                size += 2 + inputStruct->cshllink_strdata.NameString.CountCharacters*sizeof(char16_t);
+            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasRelativePath)
+                size += 2 + inputStruct->cshllink_strdata.RelativePath.CountCharacters*sizeof(char16_t);
+            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasWorkingDir)
+                size += 2 + inputStruct->cshllink_strdata.WorkingDir.CountCharacters*sizeof(char16_t);
+            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasArguments)
+                size += 2 + inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters*sizeof(char16_t);
+            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasIconLocation)
+                size += 2 + inputStruct->cshllink_strdata.IconLocation.CountCharacters*sizeof(char16_t);
+        }
+
+        //ExtraData (TerminalBlock included)
+        if(verbatim&CSHLLINK_SEC_EXTRADATA)
+            return size + _cshllink_sizeVerbatim(CSHLLINK_SEC_EXTRADATA);
+        #undef _cshllink_sizeVerbatim
+
+        //known ExtraDataBlocks, direct calls of their size handlers (fixed size blocks are checked against their BlockSize by the writer)
+        const struct _cshllink_extdatablk *ed = &inputStruct->cshllink_extdatablk;
+        #define _cshllink_sizeBlock(Block) \
+            if(ed->Block.info.BlockSignature==_CSHLLINK_EDBLK_##Block##Sig) \
+                size += _cshllink_handlerSize##Block(inputStruct, NULL);
+        _cshllink_sizeBlock(ConsoleDataBlock)
+        _cshllink_sizeBlock(ConsoleFEDataBlock)
+        _cshllink_sizeBlock(DarwinDataBlock)
+        _cshllink_sizeBlock(EnvironmentVariableDataBlock)
+        _cshllink_sizeBlock(IconEnvironmentDataBlock)
+        _cshllink_sizeBlock(KnownFolderDataBlock)
+        _cshllink_sizeBlock(PropertyStoreDataBlock)
+        _cshllink_sizeBlock(ShimDataBlock)
+        _cshllink_sizeBlock(SpecialFolderDataBlock)
+        _cshllink_sizeBlock(TrackerDataBlock)
+        _cshllink_sizeBlock(VistaAndAboveIDListDataBlock)
+        #undef _cshllink_sizeBlock
+
+        //registered blocks, unknown and not yet decoded blocks (copied verbatim)
+        for(int i=0; i<inputStruct->cshllink_edblklistnum; i++) {
+            const struct _cshllink_edblkent *entry = &inputStruct->cshllink_edblklist[i];
+            // known block decoded from a copied input
+            if(entry->raw==NULL)
+                continue;
+            if(_cshllink_rawBlock(inputStruct, entry))
+                size += entry->BlockSize;
+            else if(!_CSHLLINK_EDBLK_KNOWN(entry->BlockSignature))
+                size += _cshllink_edblkHandler(entry->BlockSignature)->size(inputStruct, entry);
+        }
+
+        //TerminalBlock
+        size += 4;
+
+        return size;
+    }
+
+    /*
+        size helpers for cshllink_serializedSize (IDList items + TerminalBlock, NULL terminated strings)
+    */
+    size_t _cshllink_sizeIDList(const struct _cshllink_lnktidl_idl *list) {
+        size_t size = 2;
+        size += list->idl_bloblen;
+        return size;
+    }
+    size_t _cshllink_sizeNULLstr(const char *str) {
+        return str==NULL ? 0 : strlen(str)+1;
+    }
+    size_t _cshllink_sizeNULLwstr(const char16_t *str) {
+        return str==NULL ? 0 : (cshllink_strlen16((char16_t *)str)+1)*sizeof(char16_t);
+    }
+
+    /*
+        -> cshllink structure pointer
+        -> output buffer
+        -> size of the output buffer in bytes (at least cshllink_serializedSize(inputStruct))
+        -> optional pointer receiving the number of bytes written (may be NULL)
+        -- serializes inputStruct into the buffer in one pass (no stdio involved)
+        <- on error this function will return -1 (the content of the buffer is undefined), on success 0
+
+        after cshllink_trackDirty the sections not modified since loading are copied from the input, see cshllink_writeFile
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_writeBuffer(cshllink *inputStruct, uint8_t *data, size_t size, size_t *written) {
+        return _cshllink_writeBufferChecked(inputStruct, data, size, written, NULL);
+    }
+
+    /*
+        same as cshllink_writeBuffer, the error code and position are also stored in ctx (may be NULL)
+    */
+    uint8_t cshllink_writeBufferCtx(cshllink *inputStruct, uint8_t *data, size_t size, size_t *written, cshllink_ctx *ctx) {
+        _cshllink_ctxBegin(ctx);
+        return _cshllink_ctxEnd(ctx, _cshllink_writeBufferChecked(inputStruct, data, size, written, ctx));
+    }
+
+    /*
+        argument checks of cshllink_writeBuffer
+    */
+    uint8_t _cshllink_writeBufferChecked(cshllink *inputStruct, uint8_t *data, size_t size, size_t *written, cshllink_ctx *ctx) {
+
+        if(inputStruct==NULL || data==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+
+        struct _cshllink_ocursor cur = {0};
+        cur.data = data;
+        cur.size = size;
+        cur.ctx = ctx;
+        if(_cshllink_serialize(&cur, inputStruct))
+            return -1;
+
+        if(written!=NULL)
+            *written = cur.pos;
+        return 0;
+    }
+
+    /*
+        Processes output cursor (shared by all write functions)
+    */
+    uint8_t _cshllink_serialize(struct _cshllink_ocursor *cur, cshllink *inputStruct) {
+        if(_cshllink_serializeSections(cur, inputStruct)) {
+            _cshllink_errpos(cur->ctx, cur->pos, cur->section);
+            return -1;
+        }
+        return 0;
+    }
+    uint8_t _cshllink_serializeSections(struct _cshllink_ocursor *cur, cshllink *inputStruct) {
+
+        // sections skipped while loading cannot be written back
+        if(_cshllink_unwritable(inputStruct))
+            _cshllink_errint(_CSHLLINK_ERR_SKIPPED);
+        // sections not modified since loading are copied
+        uint32_t verbatim = _cshllink_verbatim(inputStruct);
 
         /*
             HEADER
         */
-       {
-            //HeaderSize
-            if(inputStruct->cshllink_header.HeaderSize!=0x4c)
-                _cshllink_errint(_CSHLLINK_ERR_WHEADS);
-            if(fwrite(&inputStruct->cshllink_header.HeaderSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //LinkCLSID
-            if(inputStruct->cshllink_header.LinkCLSID_H!=0x0114020000000000)
-                _cshllink_errint(_CSHLLINK_ERR_WCLSIDS);
-            if(inputStruct->cshllink_header.LinkCLSID_L!=0xC000000000000046)
-                _cshllink_errint(_CSHLLINK_ERR_WCLSIDS);
-            cshllink_sEndian(&inputStruct->cshllink_header.LinkCLSID_L, 16);
-            if(fwrite(&inputStruct->cshllink_header.LinkCLSID_L, 16, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        cur->section = CSHLLINK_SEC_HEADER;
+        if(verbatim&CSHLLINK_SEC_HEADER ? _cshllink_writeVerbatim(inputStruct, cur) : _cshllink_writeHeader(inputStruct, cur))
+            return -1;
 
-            //LinkFlags
-            if(fwrite(&inputStruct->cshllink_header.LinkFlags, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //FileAttributes
-            if(fwrite(&inputStruct->cshllink_header.FileAttributes, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //CreationTime
-            if(fwrite(&inputStruct->cshllink_header.CreationTime, 8, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            //AccessTime
-            if(fwrite(&inputStruct->cshllink_header.AccessTime, 8, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            //WriteTime
-            if(fwrite(&inputStruct->cshllink_header.WriteTime, 8, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        /*
+            LinkTargetIDList
+        */
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkTargetIDList) {
+            cur->section = CSHLLINK_SEC_LINKTARGETIDLIST;
+            if(verbatim&CSHLLINK_SEC_LINKTARGETIDLIST ? _cshllink_writeVerbatim(inputStruct, cur) : _cshllink_writeLinkTargetIDList(inputStruct, cur))
+                return -1;
+        }
+        /*
+            LinkInfo
+        */
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkInfo) {
+            cur->section = CSHLLINK_SEC_LINKINFO;
+            if(verbatim&CSHLLINK_SEC_LINKINFO ? _cshllink_writeVerbatim(inputStruct, cur) : _cshllink_writeLinkInfo(inputStruct, cur))
+                return -1;
+        }
+        /*
+            StringData (all unicode 2 bytes)
+        */
+        cur->section = CSHLLINK_SEC_STRINGDATA;
+        if(verbatim&CSHLLINK_SEC_STRINGDATA ? _cshllink_writeVerbatim(inputStruct, cur) : _cshllink_writeStringData(inputStruct, cur))
+            return -1;
+        /*
+            ExtraDataBlock
+        */
+        cur->section = CSHLLINK_SEC_EXTRADATA;
+        if(verbatim&CSHLLINK_SEC_EXTRADATA ? _cshllink_writeVerbatim(inputStruct, cur) : _cshllink_writeExtraData(inputStruct, cur))
+            return -1;
 
-            //FileSize
-            if(fwrite(&inputStruct->cshllink_header.FileSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        return 0;
+    }
 
-            //IconIndex
-            if(fwrite(&inputStruct->cshllink_header.IconIndex, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //ShowCommand
-            if(fwrite(&inputStruct->cshllink_header.ShowCommand, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        write the current section (cur->section) from cshllink_input
+    */
+    uint8_t _cshllink_writeVerbatim(cshllink *inputStruct, struct _cshllink_ocursor *cur) {
+        const struct _cshllink_secidx *entry = cshllink_findSection(inputStruct, cur->section);
+        if(_cshllink_cwriteRef(cur, inputStruct->cshllink_input+entry->offset, entry->size))
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        return 0;
+    }
 
-            //HotKey
-            if(fwrite(&inputStruct->cshllink_header.HotKey, 2, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        Section write functions
+    */
+    uint8_t _cshllink_writeHeader(cshllink *inputStruct, struct _cshllink_ocursor *cur) {
+        //HeaderSize
+        if(inputStruct->cshllink_header.HeaderSize!=0x4c)
+            _cshllink_errint(_CSHLLINK_ERR_WHEADS);
+        //LinkCLSID
+        if(inputStruct->cshllink_header.LinkCLSID_H!=0x0114020000000000)
+            _cshllink_errint(_CSHLLINK_ERR_WCLSIDS);
+        if(inputStruct->cshllink_header.LinkCLSID_L!=0xC000000000000046)
+            _cshllink_errint(_CSHLLINK_ERR_WCLSIDS);
+
+        //LinkFlags to HotKey, 10 bytes NULL
+        uint8_t raw[_CSHLLINK_HEADERSIZE];
+        if(_cshllink_layoutHeader.encode(&inputStruct->cshllink_header, raw, sizeof raw))
+            return -1;
+        memcpy(raw, _cshllink_headerSig, sizeof _cshllink_headerSig);
+        if(_cshllink_cwrite(cur, raw, sizeof raw))
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+
+        return 0;
+    }
+
+    uint8_t _cshllink_writeLinkTargetIDList(cshllink *inputStruct, struct _cshllink_ocursor *cur) {
+        //IDList size (derived from the items, TerminalBlock included)
+        if(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_bloblen+2>UINT16_MAX)
+            _cshllink_errint(_CSHLLINK_ERR_INVIDL);
+        uint16_t idl_size = inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_bloblen+2;
+        if(_cshllink_cwrite(cur, &idl_size, 2))
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+
+        //Elements (one write of the blob)
+        if(_cshllink_writeIDList(&inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl, cur))
+            return -1;
+        //TerminalBlock
+        uint16_t nullb=0;
+        if(_cshllink_cwrite(cur, &nullb, 2))
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+
+        return 0;
+    }
 
-            //10 bytes null
-            char tmp[]="\0\0\0\0\0\0\0\0\0\0";
-            if(fwrite(&tmp, 1, 10, fp) != 10)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        }
+    uint8_t _cshllink_writeLinkInfo(cshllink *inputStruct, struct _cshllink_ocursor *cur) {
+        //LinkInfoSize to CommonPathSuffixOffset, LocalBasePathOffsetUnicode and CommonPathSuffixOffsetUnicode if LinkInfoHeaderSize >= 0x00000024
+        if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize!=0x0000001C && inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize<0x00000024)
+            _cshllink_errint(_CSHLLINK_ERR_INVLIHS);
+        uint8_t raw[0x24];
+        size_t rawSize = inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize>=0x00000024 ? 0x24 : 0x1C;
+        if(_cshllink_layoutLinkInfo.encode(&inputStruct->cshllink_lnkinfo, raw, rawSize))
+            return -1;
+        if(_cshllink_cwrite(cur, raw, rawSize))
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
 
         /*
-            LinkTargetIDList
+            VolumeID
         */
-        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkTargetIDList) {
-            //IDList size
-            if(fwrite(&inputStruct->cshllink_lnktidl.idl_size, 2, 1, fp) != 1)
+        if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) {
+            //VolumeIDSize to VolumeLabelOffset, VolumeLabelOffsetUnicode if VolumeLabelOffset == 0x00000014
+            int VtmpSize = inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014 ? 20 : 16;
+            if(_cshllink_layoutVolumeID.encode(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid, raw, VtmpSize))
+                return -1;
+            if(_cshllink_cwrite(cur, raw, VtmpSize))
                 _cshllink_errint(_CSHLLINK_ERR_FIO);
 
-            if(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item==NULL) 
-                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
-            for(int i=0; i<inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum; i++) {
-                //Element size
-                if(fwrite(&inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[i].item_size, 2, 1, fp) != 1)
+            //DATA
+            if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize<=VtmpSize)
+                _cshllink_errint(_CSHLLINK_ERR_VIDSLOW);
+            if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPVIDD);
+            //Data
+            if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014) {
+                if(_cshllink_cwriteRef(cur, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, ((inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize)/2)*sizeof(char16_t)))
                     _cshllink_errint(_CSHLLINK_ERR_FIO);
-                //Element (size -2 as struct contains one 2byte var)
-                if(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[i].item==NULL)
-                    _cshllink_errint(_CSHLLINK_ERR_NULLPIDLM);
-                if(fwrite(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[i].item, inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[i].item_size-2, 1, fp) != 1)
+            }
+            else {
+                if(_cshllink_cwriteRef(cur, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, (inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize)*sizeof(char)))
                     _cshllink_errint(_CSHLLINK_ERR_FIO);
             }
-            //TerminalBlock
-            uint16_t nullb=0;
-            if(fwrite(&nullb, 2, 1, fp)!=1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        }
 
+            //LocalBasePath
+            if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.LocalBasePath, _CSHLLINK_ERR_NULLPLBP, _CSHLLINK_ERR_FIO, cur))
+                return -1;
+        }
         /*
-            LinkInfo
+            CommonNetworkRelativeLink
         */
-        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasLinkInfo) {
-            //LinkInfoSize
-            if(fwrite(&inputStruct->cshllink_lnkinfo.LinkInfoSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //LinkInfoHeaderSize
-            if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize!=0x0000001C && inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize<0x00000024)
-                _cshllink_errint(_CSHLLINK_ERR_INVLIHS);
-            if(fwrite(&inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            
-            //LinkInfoFlags
-            if(fwrite(&inputStruct->cshllink_lnkinfo.LinkInfoFlags, 4, 1, fp) != 1)
+        if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_CommonNetworkRelativeLinkAndPathSuffix) {
+            //CommonNetworkRelativeSize to NetworkProviderType, NetNameOffsetUnicode and DeviceNameOffsetUnicode if NetNameOffset > 0x00000014
+            rawSize = inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffset>0x00000014 ? 0x1C : 0x14;
+            if(_cshllink_layoutCNetRLnk.encode(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk, raw, rawSize))
+                return -1;
+            if(_cshllink_cwrite(cur, raw, rawSize))
                 _cshllink_errint(_CSHLLINK_ERR_FIO);
 
-            //VolumeIDOffset
-            if(fwrite(&inputStruct->cshllink_lnkinfo.VolumeIDOffset, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+            //NetName
+            if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetName, _CSHLLINK_ERR_NULLPNETN, _CSHLLINK_ERR_FIO, cur))
+                    return -1;
             
-            //LocalBasePathOffset
-            if(fwrite(&inputStruct->cshllink_lnkinfo.LocalBasePathOffset, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-            //CommonNetworkRelativeLinkOffset
-            if(fwrite(&inputStruct->cshllink_lnkinfo.CommonNetworkRelativeLinkOffset, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-            //CommonPathSuffixOffset
-            if(fwrite(&inputStruct->cshllink_lnkinfo.CommonPathSuffixOffset, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+            //DeviceName
+            if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceName, _CSHLLINK_ERR_NULLPDEVN, _CSHLLINK_ERR_FIO, cur))
+                    return -1;
 
-            //only present if LinkInfoHeaderSize >= 0x00000024
-            if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize>=0x00000024) {
-                //LocalBasePathOffsetUnicode
-                if(fwrite(&inputStruct->cshllink_lnkinfo.LocalBasePathOffsetUnicode, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+            if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffset>0x00000014) {
+                //NetNameUnicode
+                if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameUnicode, _CSHLLINK_ERR_NULLPNNU, _CSHLLINK_ERR_FIO, cur))
+                        return -1;
 
-                //CommonPathSuffixOffsetUnicode
-                if(fwrite(&inputStruct->cshllink_lnkinfo.CommonPathSuffixOffsetUnicode, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+                //DeviceNameUnicode
+                if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceNameUnicode, _CSHLLINK_ERR_NULLPDNU, _CSHLLINK_ERR_FIO, cur))
+                        return -1;
             }
+        }
 
-            /*
-                VolumeID
-            */
+        //CommonPathSuffix
+        if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.CommonPathSuffix, _CSHLLINK_ERR_NULLPCPS, _CSHLLINK_ERR_FIO, cur))
+                return -1;
+
+        if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize>=0x00000024) {
+            //LocalBasePathUnicode
             if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) {
-                int VtmpSize=16;
-                //VolumeIDSize
-                if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+                if(cshllink_wNULLwstr(&inputStruct->cshllink_lnkinfo.LocalBasePathUnicode, _CSHLLINK_ERR_NULLPLBPU, _CSHLLINK_ERR_FIO, cur))
+                    return -1;
+            }
+            //CommonPathSuffixUnicode
+            if(cshllink_wNULLwstr(&inputStruct->cshllink_lnkinfo.CommonPathSuffixUnicode, _CSHLLINK_ERR_NULLPCPSU, _CSHLLINK_ERR_FIO, cur))
+                return -1;
+        }
 
-                //DriveType
-                if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.DriveType, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                
-                //DriveSerialNumber
-                if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.DriveSerialNumber, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+        return 0;
+    }
 
-                //VolumeLabelOffset
-                if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                
-                //only present if VolumeLabelOffset == 0x00000014
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014) {
-                    //VolumeLabelOffsetUnicode
-                    if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffsetUnicode, 4, 1, fp) != 1)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
-                    VtmpSize+=4;
-                }
+    uint8_t _cshllink_writeStringData(cshllink *inputStruct, struct _cshllink_ocursor *cur) {
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasName) {
+            //NameString
+            if(_cshllink_cwrite(cur, &inputStruct->cshllink_strdata.NameString.CountCharacters, 2))
+                _cshllink_errint(_CSHLLINK_ERR_FIO);
+            if(cshllink_wwstr(&inputStruct->cshllink_strdata.NameString.UString, _CSHLLINK_ERR_NULLPSTRDNAME, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.NameString.CountCharacters*2))
+                return -1;
+        }
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasRelativePath) {
+            //RelativePath
+            if(_cshllink_cwrite(cur, &inputStruct->cshllink_strdata.RelativePath.CountCharacters, 2))
+                _cshllink_errint(_CSHLLINK_ERR_FIO);
+            if(cshllink_wwstr(&inputStruct->cshllink_strdata.RelativePath.UString, _CSHLLINK_ERR_NULLPSTRDRPATH, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.RelativePath.CountCharacters*2))
+                return -1;
+        }
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasWorkingDir) {
+            //WorkingDir
+            if(_cshllink_cwrite(cur, &inputStruct->cshllink_strdata.WorkingDir.CountCharacters, 2))
+                _cshllink_errint(_CSHLLINK_ERR_FIO);
+            if(cshllink_wwstr(&inputStruct->cshllink_strdata.WorkingDir.UString, _CSHLLINK_ERR_NULLPSTRDWDIR, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.WorkingDir.CountCharacters*2))
+                return -1;
+        }
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasArguments) {
+            //CommandLineArguments
+            if(_cshllink_cwrite(cur, &inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters, 2))
+                _cshllink_errint(_CSHLLINK_ERR_FIO);
+            if(cshllink_wwstr(&inputStruct->cshllink_strdata.CommandLineArguments.UString, _CSHLLINK_ERR_NULLPSTRDARG, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters*2))
+                return -1;
+        }
+        if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasIconLocation) {
+            //IconLocation
+            if(_cshllink_cwrite(cur, &inputStruct->cshllink_strdata.IconLocation.CountCharacters, 2))
+                _cshllink_errint(_CSHLLINK_ERR_FIO);
+            if(cshllink_wwstr(&inputStruct->cshllink_strdata.IconLocation.UString, _CSHLLINK_ERR_NULLPSTRDICO, _CSHLLINK_ERR_FIO, cur, inputStruct->cshllink_strdata.IconLocation.CountCharacters*2))
+                return -1;
+        }
 
-                //DATA
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize<=VtmpSize)
-                    _cshllink_errint(_CSHLLINK_ERR_VIDSLOW);
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data==NULL)
-                    _cshllink_errint(_CSHLLINK_ERR_NULLPVIDD);
-                //Data
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014) {
-                    if(fwrite(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, sizeof(char16_t), (inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize)/2, fp) != (inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize)/2)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
-                }
-                else {
-                    if(fwrite(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, sizeof(char), inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize, fp) != inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize-VtmpSize)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
-                }
+        return 0;
+    }
 
-                //LocalBasePath
-                if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.LocalBasePath, _CSHLLINK_ERR_NULLPLBP, _CSHLLINK_ERR_FIO, fp))
-                    return -1;
-            }
-            /*
-                CommonNetworkRelativeLink
-            */
-            if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_CommonNetworkRelativeLinkAndPathSuffix) {
-                //CommonNetworkRelativeSize
-                if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.CommonNetworkRelativeSize, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+    uint8_t _cshllink_writeExtraData(cshllink *inputStruct, struct _cshllink_ocursor *cur) {
+        //input order equals the fixed order (the usual case): direct calls
+        if(_cshllink_fixedOrder(inputStruct)) {
+            if(_cshllink_writeEConsoleDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeEConsoleFEDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeEDarwinDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeEEnvironmentVariableDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeEIconEnvironmentDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeEKnownFolderDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeEPropertyStoreDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeEShimDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeESpecialFolderDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeETrackerDataBlock(&inputStruct, cur)) return -1;
+            if(_cshllink_writeEVistaAndAboveIDListDataBlock(&inputStruct, cur)) return -1;
+        }
+        else if(_cshllink_writeListed(inputStruct, cur))
+            return -1;
 
-                //CommonNetworkRelativeLinkFlags
-                if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.CommonNetworkRelativeLinkFlags, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+        //TerminalBlock
+        char tmp[]="\0\0\0\0";
+        if(_cshllink_cwrite(cur, &tmp, 4))
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
 
-                //NetNameOffset
-                if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffset, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+        return 0;
+    }
 
-                //DeviceNameOffset
-                if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceNameOffset, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                
-                //NetworkProviderType
-                if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetworkProviderType, 4, 1, fp) != 1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffset>0x00000014) {
-                    //NetNameOffsetUnicode
-                    if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffsetUnicode, 4, 1, fp) != 1)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
+    // position of a known ExtraDataBlock in the fixed order of _cshllink_writeExtraData, indexed by the low nibble of its BlockSignature
+    static const uint8_t _cshllink_edblkrank[16] = {
+        [_CSHLLINK_EDBLK_ConsoleDataBlockSig&0x0F] = 0,
+        [_CSHLLINK_EDBLK_ConsoleFEDataBlockSig&0x0F] = 1,
+        [_CSHLLINK_EDBLK_DarwinDataBlockSig&0x0F] = 2,
+        [_CSHLLINK_EDBLK_EnvironmentVariableDataBlockSig&0x0F] = 3,
+        [_CSHLLINK_EDBLK_IconEnvironmentDataBlockSig&0x0F] = 4,
+        [_CSHLLINK_EDBLK_KnownFolderDataBlockSig&0x0F] = 5,
+        [_CSHLLINK_EDBLK_PropertyStoreDataBlockSig&0x0F] = 6,
+        [_CSHLLINK_EDBLK_ShimDataBlockSig&0x0F] = 7,
+        [_CSHLLINK_EDBLK_SpecialFolderDataBlockSig&0x0F] = 8,
+        [_CSHLLINK_EDBLK_TrackerDataBlockSig&0x0F] = 9,
+        [_CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSig&0x0F] = 10,
+    };
 
-                    //DeviceNameOffsetUnicode
-                    if(fwrite(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceNameOffsetUnicode, 4, 1, fp) != 1)
-                        _cshllink_errint(_CSHLLINK_ERR_FIO);
-                }
+    /*
+        true if writing cshllink_edblklist in order gives the fixed order (known blocks only, none from raw, ascending positions, no block added by the setters)
+    */
+    int _cshllink_fixedOrder(const cshllink *inputStruct) {
+        uint32_t listed = 0;
+        int last = -1;
+        for(int i=0; i<inputStruct->cshllink_edblklistnum; i++) {
+            const struct _cshllink_edblkent *entry = &inputStruct->cshllink_edblklist[i];
+            if(!_CSHLLINK_EDBLK_KNOWN(entry->BlockSignature) || (entry->raw!=NULL && _cshllink_rawBlock(inputStruct, entry)))
+                return 0;
+            if(_cshllink_edblkrank[entry->BlockSignature&0x0F]<=last)
+                return 0;
+            last = _cshllink_edblkrank[entry->BlockSignature&0x0F];
+            listed |= CSHLLINK_SEC_EDBLK(entry->BlockSignature);
+        }
+        // a block added by a setter is appended by _cshllink_writeListed (branch-free presence mask)
+        const struct _cshllink_extdatablk *ed = &inputStruct->cshllink_extdatablk;
+        #define _cshllink_present(block, Sig) ((uint32_t)(ed->block.info.BlockSignature==Sig)*CSHLLINK_SEC_EDBLK(Sig))
+        uint32_t present = _cshllink_present(ConsoleDataBlock, _CSHLLINK_EDBLK_ConsoleDataBlockSig)
+            | _cshllink_present(ConsoleFEDataBlock, _CSHLLINK_EDBLK_ConsoleFEDataBlockSig)
+            | _cshllink_present(DarwinDataBlock, _CSHLLINK_EDBLK_DarwinDataBlockSig)
+            | _cshllink_present(EnvironmentVariableDataBlock, _CSHLLINK_EDBLK_EnvironmentVariableDataBlockSig)
+            | _cshllink_present(IconEnvironmentDataBlock, _CSHLLINK_EDBLK_IconEnvironmentDataBlockSig)
+            | _cshllink_present(KnownFolderDataBlock, _CSHLLINK_EDBLK_KnownFolderDataBlockSig)
+            | _cshllink_present(PropertyStoreDataBlock, _CSHLLINK_EDBLK_PropertyStoreDataBlockSig)
+            | _cshllink_present(ShimDataBlock, _CSHLLINK_EDBLK_ShimDataBlockSig)
+            | _cshllink_present(SpecialFolderDataBlock, _CSHLLINK_EDBLK_SpecialFolderDataBlockSig)
+            | _cshllink_present(TrackerDataBlock, _CSHLLINK_EDBLK_TrackerDataBlockSig)
+            | _cshllink_present(VistaAndAboveIDListDataBlock, _CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSig);
+        #undef _cshllink_present
+        return (present&~listed)==0;
+    }
 
-                //NetName
-                if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetName, _CSHLLINK_ERR_NULLPNETN, _CSHLLINK_ERR_FIO, fp))
-                        return -1;
-                
-                //DeviceName
-                if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceName, _CSHLLINK_ERR_NULLPDEVN, _CSHLLINK_ERR_FIO, fp))
-                        return -1;
+    /*
+        write the ExtraDataBlocks of cshllink_edblklist in input order, then the blocks added by the setters in the fixed order
+    */
+    uint8_t _cshllink_writeListed(cshllink *inputStruct, struct _cshllink_ocursor *cur) {
+        //blocks of the input in their original order
+        uint32_t listed = 0;
+        for(int i=0; i<inputStruct->cshllink_edblklistnum; i++) {
+            struct _cshllink_edblkent *entry = &inputStruct->cshllink_edblklist[i];
+            if(_cshllink_rawBlock(inputStruct, entry)) {
+                if(_cshllink_cwriteRef(cur, entry->raw, entry->BlockSize))
+                    _cshllink_errint(_CSHLLINK_ERR_FIO);
+                continue;
+            }
+            // removed blocks are not written
+            if(_CSHLLINK_EDBLK_KNOWN(entry->BlockSignature))
+                listed |= CSHLLINK_SEC_EDBLK(entry->BlockSignature);
+            if(_cshllink_writeBlock(inputStruct, entry, entry->BlockSignature, cur))
+                return -1;
+        }
+        //blocks added by the setters
+        for(int i=0; i<_CSHLLINK_EDBLK_NUM; i++) {
+            if(!(listed&CSHLLINK_SEC_EDBLK(_cshllink_edblkorder[i])) && _cshllink_writeBlock(inputStruct, NULL, _cshllink_edblkorder[i], cur))
+                return -1;
+        }
+        return 0;
+    }
 
-                if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameOffset>0x00000014) {
-                    //NetNameUnicode
-                    if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameUnicode, _CSHLLINK_ERR_NULLPNNU, _CSHLLINK_ERR_FIO, fp))
-                            return -1;
+    /*
+        encode an ExtraDataBlock with its handler (entry is NULL for a known block added by the setters, nothing is written for a known block that is not present)
+    */
+    uint8_t _cshllink_writeBlock(cshllink *inputStruct, struct _cshllink_edblkent *entry, uint32_t BlockSignature, struct _cshllink_ocursor *cur) {
+        const cshllink_blockhandler *handler = _cshllink_edblkHandler(BlockSignature);
+        if(handler==NULL)
+            return 0;
+        return handler->write(inputStruct, entry, cur);
+    }
 
-                    //DeviceNameUnicode
-                    if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceNameUnicode, _CSHLLINK_ERR_NULLPDNU, _CSHLLINK_ERR_FIO, fp))
-                            return -1;
-                }
-            }
+    /*
+        true if the block of cshllink_edblklist is written from raw (no handler, or skipped and not decoded yet)
+    */
+    int _cshllink_rawBlock(const cshllink *inputStruct, const struct _cshllink_edblkent *entry) {
+        if(entry->raw==NULL)
+            return 0;
+        if(!_CSHLLINK_EDBLK_KNOWN(entry->BlockSignature))
+            return entry->block==NULL || _cshllink_edblkHandler(entry->BlockSignature)==NULL;
+        return (inputStruct->cshllink_skipped&CSHLLINK_SEC_EDBLK(entry->BlockSignature)) && _cshllink_edblkAt(&inputStruct->cshllink_extdatablk, entry->BlockSignature)->BlockSignature==0;
+    }
 
-            //CommonPathSuffix
-            if(cshllink_wNULLstr(&inputStruct->cshllink_lnkinfo.CommonPathSuffix, _CSHLLINK_ERR_NULLPCPS, _CSHLLINK_ERR_FIO, fp))
-                    return -1;
+    /*
+        skipped sections (cshllink_skipped) that cannot be written back (skipped blocks with kept raw bytes and unmodified sections are copied)
+    */
+    uint32_t _cshllink_unwritable(const cshllink *inputStruct) {
+        if(inputStruct->cshllink_skipped==0)
+            return 0;
+        return _cshllink_unwritableWith(inputStruct, _cshllink_verbatim(inputStruct));
+    }
+    /*
+        skipped sections that cannot be written back if the sections "verbatim" (CSHLLINK_SEC_*) are copied from the input
+    */
+    uint32_t _cshllink_unwritableWith(const cshllink *inputStruct, uint32_t verbatim) {
+        uint32_t skipped = inputStruct->cshllink_skipped;
+        if(verbatim&CSHLLINK_SEC_EXTRADATA)
+            verbatim |= CSHLLINK_SEC_EDBLKS;
+        skipped &= ~verbatim;
+        for(int i=0; skipped!=0 && i<inputStruct->cshllink_edblklistnum; i++) {
+            if(_cshllink_rawBlock(inputStruct, &inputStruct->cshllink_edblklist[i]))
+                skipped &= ~CSHLLINK_SEC_EDBLK(inputStruct->cshllink_edblklist[i].BlockSignature);
+        }
+        return skipped;
+    }
 
-            if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize>=0x00000024) {
-                //LocalBasePathUnicode
-                if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) {
-                    if(cshllink_wNULLwstr(&inputStruct->cshllink_lnkinfo.LocalBasePathUnicode, _CSHLLINK_ERR_NULLPLBPU, _CSHLLINK_ERR_FIO, fp))
-                        return -1;
-                }
-                //CommonPathSuffixUnicode
-                if(cshllink_wNULLwstr(&inputStruct->cshllink_lnkinfo.CommonPathSuffixUnicode, _CSHLLINK_ERR_NULLPCPSU, _CSHLLINK_ERR_FIO, fp))
-                    return -1;
-            }
-        
+    /*
+        sections (CSHLLINK_SEC_*) copied from cshllink_input by the writers (cshllink_trackDirty only): indexed and not modified since loading (cshllink_dirty, idl_dirty)
+        the header is copied while its fields encode to the input bytes, the other sections also need the LinkFlags bits that decide their presence and strings unchanged
+    */
+    uint32_t _cshllink_verbatim(const cshllink *inputStruct) {
+        if(!inputStruct->cshllink_tracked)
+            return 0;
+        uint32_t sections = 0;
+        for(int i=0; i<inputStruct->cshllink_indexnum; i++) {
+            if(inputStruct->cshllink_index[i].BlockSignature==0)
+                sections |= inputStruct->cshllink_index[i].section;
         }
+        sections &= ~inputStruct->cshllink_dirty;
+        if(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_dirty)
+            sections &= ~CSHLLINK_SEC_LINKTARGETIDLIST;
+        if(inputStruct->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_dirty)
+            sections &= ~CSHLLINK_SEC_EXTRADATA;
+
+        // header: LinkFlags to HotKey as encoded (the reserved bytes after HotKey are kept from the input)
+        const struct _cshllink_header *header = &inputStruct->cshllink_header;
+        uint8_t raw[_CSHLLINK_HEADERSIZE];
+        _cshllink_layoutHeader.encode(header, raw, sizeof raw);
+        if(header->HeaderSize!=_CSHLLINK_HEADERSIZE || header->LinkCLSID_H!=0x0114020000000000 || header->LinkCLSID_L!=0xC000000000000046 || memcmp(raw+20, inputStruct->cshllink_input+20, 0x42-20))
+            sections &= ~CSHLLINK_SEC_HEADER;
+
+        // LinkFlags decide which sections and strings are present
+        uint32_t LinkFlags;
+        memcpy(&LinkFlags, inputStruct->cshllink_input+20, 4);
+        LinkFlags ^= header->LinkFlags;
+        if(LinkFlags&CSHLLINK_LF_HasLinkTargetIDList)
+            sections &= ~CSHLLINK_SEC_LINKTARGETIDLIST;
+        if(LinkFlags&CSHLLINK_LF_HasLinkInfo)
+            sections &= ~CSHLLINK_SEC_LINKINFO;
+        if(LinkFlags&(CSHLLINK_LF_HasName|CSHLLINK_LF_HasRelativePath|CSHLLINK_LF_HasWorkingDir|CSHLLINK_LF_HasArguments|CSHLLINK_LF_HasIconLocation))
+            sections &= ~CSHLLINK_SEC_STRINGDATA;
+        return sections;
+    }
 
-        /*
-            StringData (all unicode 2 bytes)
-        */
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasName) {
-                //NameString
-                if(fwrite(&inputStruct->cshllink_strdata.NameString.CountCharacters, 2, 1, fp)!=1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_wwstr(&inputStruct->cshllink_strdata.NameString.UString, _CSHLLINK_ERR_NULLPSTRDNAME, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.NameString.CountCharacters*2))
-                    return -1;
-            }
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasRelativePath) {
-                //RelativePath
-                if(fwrite(&inputStruct->cshllink_strdata.RelativePath.CountCharacters, 2, 1, fp)!=1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_wwstr(&inputStruct->cshllink_strdata.RelativePath.UString, _CSHLLINK_ERR_NULLPSTRDRPATH, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.RelativePath.CountCharacters*2))
-                    return -1;
-            }
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasWorkingDir) {
-                //WorkingDir
-                if(fwrite(&inputStruct->cshllink_strdata.WorkingDir.CountCharacters, 2, 1, fp)!=1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_wwstr(&inputStruct->cshllink_strdata.WorkingDir.UString, _CSHLLINK_ERR_NULLPSTRDWDIR, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.WorkingDir.CountCharacters*2))
-                    return -1;
-            }
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasArguments) {
-                //CommandLineArguments
-                if(fwrite(&inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters, 2, 1, fp)!=1)
-                    _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_wwstr(&inputStruct->cshllink_strdata.CommandLineArguments.UString, _CSHLLINK_ERR_NULLPSTRDARG, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters*2))
-                    return -1;
-            }
-            if(inputStruct->cshllink_header.LinkFlags&CSHLLINK_LF_HasIconLocation) {
-                //IconLocation
-                if(fwrite(&inputStruct->cshllink_strdata.IconLocation.CountCharacters, 2, 1, fp)!=1)
+    /*
+        write "size" bytes to the cursor (bounds-checked)
+    */
+    uint8_t _cshllink_cwrite(struct _cshllink_ocursor *cur, const void *src, size_t size) {
+        if(size>cur->size-cur->pos)
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        if(size==0)
+            return 0;
+        memcpy(cur->data+cur->pos, src, size);
+        #ifndef _WIN32
+        if(cur->iov!=NULL) {
+            // extend the last segment if it ends at the copy, otherwise start a new one
+            struct iovec *last = cur->iovcnt ? &cur->iov[cur->iovcnt-1] : NULL;
+            if(last!=NULL && (uint8_t *)last->iov_base+last->iov_len==cur->data+cur->pos)
+                last->iov_len+=size;
+            else {
+                if(cur->iovcnt==cur->iovmax)
                     _cshllink_errint(_CSHLLINK_ERR_FIO);
-                if(cshllink_wwstr(&inputStruct->cshllink_strdata.IconLocation.UString, _CSHLLINK_ERR_NULLPSTRDICO, _CSHLLINK_ERR_FIO, fp, inputStruct->cshllink_strdata.IconLocation.CountCharacters*2))
-                    return -1;
+                cur->iov[cur->iovcnt].iov_base = cur->data+cur->pos;
+                cur->iov[cur->iovcnt++].iov_len = size;
             }
-        /*
-            ExtraDataBlock
-        */
-        {
-
-            if(_cshllink_writeEConsoleDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeEConsoleFEDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeEDarwinDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeEEnvironmentVariableDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeEIconEnvironmentDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeEKnownFolderDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeEPropertyStoreDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeEShimDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeESpecialFolderDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeETrackerDataBlock(&inputStruct, fp)) return -1;
-            if(_cshllink_writeEVistaAndAboveIDListDataBlock(&inputStruct, fp)) return -1;
-
-            //TerminalBlock
-            char tmp[]="\0\0\0\0";
-            if(fwrite(&tmp, 1, 4, fp) != 4)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
         }
-
+        #endif
+        cur->pos+=size;
         return 0;
     }
 
     /*
-        write NULL terminated String
+        write "size" bytes of a buffer that outlives the cursor (referenced instead of copied in gather mode)
     */
-    uint32_t cshllink_wNULLstr(char **dest, uint8_t errv1, uint8_t errv2, FILE *fp) {
-        char tmpC=1;
-        uint32_t index=0;
-        while(tmpC!=0) {
-            if(*dest==NULL)
-                _cshllink_errint(errv1);
-            if(fwrite(&(*dest)[index], 1, 1, fp) != 1)
-                _cshllink_errint(errv2);
-            tmpC = (*dest)[index];
-            index++;
+    uint8_t _cshllink_cwriteRef(struct _cshllink_ocursor *cur, const void *src, size_t size) {
+        #ifndef _WIN32
+        // keep one segment free for the copied bytes following the reference, copy once iov is (almost) full
+        if(cur->iov!=NULL && size!=0 && cur->iovcnt+2<=cur->iovmax) {
+            cur->iov[cur->iovcnt].iov_base = (void *)src;
+            cur->iov[cur->iovcnt++].iov_len = size;
+            return 0;
         }
+        #endif
+        return _cshllink_cwrite(cur, src, size);
+    }
+
+    /*
+        write NULL terminated String
+    */
+    uint32_t cshllink_wNULLstr(char **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_ocursor *cur) {
+        if(*dest==NULL)
+            _cshllink_errint(errv1);
+        if(_cshllink_cwriteRef(cur, *dest, strlen(*dest)+1))
+            _cshllink_errint(errv2);
         return 0;
     }
-    uint32_t cshllink_wNULLwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, FILE *fp) {
-        char16_t tmpC=1;
-        uint32_t index=0;
-        while(tmpC!=0) {
-            if(*dest==NULL)
-                _cshllink_errint(errv1);
-            if(fwrite(&(*dest)[index], sizeof(char16_t), 1, fp) != 1)
-                _cshllink_errint(errv2);
-            tmpC = (*dest)[index];
-            index++;
-        }
+    uint32_t cshllink_wNULLwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_ocursor *cur) {
+        if(*dest==NULL)
+            _cshllink_errint(errv1);
+        if(_cshllink_cwriteRef(cur, *dest, (cshllink_strlen16(*dest)+1)*sizeof(char16_t)))
+            _cshllink_errint(errv2);
         return 0;
     }
 
     /*
         write String
     */
-    uint32_t cshllink_wstr(char **dest, uint8_t errv1, uint8_t errv2, FILE *fp, size_t size) {
+    uint32_t cshllink_wstr(char **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_ocursor *cur, size_t size) {
         if(size==0) _cshllink_errint(errv1);
         if(*dest==NULL)
             _cshllink_errint(errv1);
-        if(fwrite(*dest, 1, size, fp) != size)
+        if(_cshllink_cwriteRef(cur, *dest, size))
             _cshllink_errint(errv2);
         return 0;
     }
-    uint32_t cshllink_wwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, FILE *fp, size_t size) {
+    uint32_t cshllink_wwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_ocursor *cur, size_t size) {
         size/=2;
         if(size==0) _cshllink_errint(errv1);
         if(*dest==NULL)
             _cshllink_errint(errv1);
-        if(fwrite(*dest, sizeof(char16_t), size, fp) != size)
+        if(_cshllink_cwriteRef(cur, *dest, size*sizeof(char16_t)))
             _cshllink_errint(errv2);
         return 0;
     }
 
     /*
-        Extra Data Block write functions
+        write an ExtraDataBlock with a fixed layout: BlockSize, BlockSignature and the body with one write
     */
-    uint8_t _cshllink_writeEConsoleDataBlock(cshllink **input, FILE *fp) {
-        if((*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_ConsoleDataBlockSig) return 0;
-
-        if((*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSize!=_CSHLLINK_EDBLK_ConsoleDataBlockSiz)
+    uint8_t _cshllink_writeFixedBlock(const struct _cshllink_layout *layout, const struct _cshllink_extdatablk_blk_info *info, const void *block, struct _cshllink_ocursor *cur) {
+        // largest fixed blocks (Darwin, EnvironmentVariable, IconEnvironment)
+        uint8_t raw[_CSHLLINK_EDBLK_DarwinDataBlockSiz];
+        if(layout->size+8>sizeof raw)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
-
-        //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSignature, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //FillAttributes
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FillAttributes, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //PopupFillAttributes
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.PopupFillAttributes, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //ScreenBufferSizeX
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.ScreenBufferSizeX, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //ScreenBufferSizeY
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.ScreenBufferSizeY, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-        
-        //WindowSizeX
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.WindowSizeX, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-        
-        //WindowSizeY
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.WindowSizeY, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //WindowOriginX
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.WindowOriginX, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //WindowOriginY
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.WindowOriginY, 2, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-    
-        //8 bytes NULL
-            char tmp[]="\0\0\0\0\0\0\0\0";
-            if(fwrite(&tmp, 1, 8, fp) != 8)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //FontSize
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FontSize, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-    
-        //FontFamily
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FontFamily, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //FontWeight
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FontWeight, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //FaceName
-        if(cshllink_wwstr(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FaceName, _CSHLLINK_ERRX_NULLPSTRFNAME, _CSHLLINK_ERR_FIO, fp, 32))
+        memcpy(raw, &info->BlockSize, 4);
+        memcpy(raw+4, &info->BlockSignature, 4);
+        if(layout->encode(block, raw+8, layout->size))
             return -1;
-
-        //CursorSize
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.CursorSize, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //FullScreen
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.FullScreen, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-        
-        //QuickEdit
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.QuickEdit, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //InsertMode
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.InsertMode, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //AutoPosition
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.AutoPosition, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //HistoryBufferSize
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.HistoryBufferSize, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //NumberOfHistoryBuffers
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.NumberOfHistoryBuffers, 4, 1, fp)!=1)
+        if(_cshllink_cwrite(cur, raw, layout->size+8))
             _cshllink_errint(_CSHLLINK_ERR_FIO);
+        return 0;
+    }
 
-        //HistoryNoDup
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.HistoryNoDup, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
+    /*
+        Extra Data Block write functions
+    */
+    uint8_t _cshllink_writeEConsoleDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
+        if((*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_ConsoleDataBlockSig) return 0;
 
-        //AutoPosition
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.AutoPosition, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-       
-        //ColorTable
-        for(int i=0; i<16; i++)
-            if(fwrite(&(*input)->cshllink_extdatablk.ConsoleDataBlock.ColorTable[i], 4, 1, fp)!=1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
+        if((*input)->cshllink_extdatablk.ConsoleDataBlock.info.BlockSize!=_CSHLLINK_EDBLK_ConsoleDataBlockSiz)
+            _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
 
-        return 0;
+        //Size and Signature, FillAttributes to ColorTable
+        return _cshllink_writeFixedBlock(&_cshllink_layoutConsole, &(*input)->cshllink_extdatablk.ConsoleDataBlock.info, &(*input)->cshllink_extdatablk.ConsoleDataBlock, cur);
     }
 
-    uint8_t _cshllink_writeEConsoleFEDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeEConsoleFEDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.ConsoleFEDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_ConsoleFEDataBlockSig)
             return 0;
         
         if((*input)->cshllink_extdatablk.ConsoleFEDataBlock.info.BlockSize!=_CSHLLINK_EDBLK_ConsoleFEDataBlockSiz)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
 
-        //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleFEDataBlock.info.BlockSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleFEDataBlock.info.BlockSignature, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //CodePage
-        if(fwrite(&(*input)->cshllink_extdatablk.ConsoleFEDataBlock.CodePage, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        return 0;
+        //Size and Signature, CodePage
+        return _cshllink_writeFixedBlock(&_cshllink_layoutConsoleFE, &(*input)->cshllink_extdatablk.ConsoleFEDataBlock.info, &(*input)->cshllink_extdatablk.ConsoleFEDataBlock, cur);
     }
 
-    uint8_t _cshllink_writeEDarwinDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeEDarwinDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.DarwinDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_DarwinDataBlockSig)
             return 0;
         
         if((*input)->cshllink_extdatablk.DarwinDataBlock.info.BlockSize!=_CSHLLINK_EDBLK_DarwinDataBlockSiz)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
 
-        //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.DarwinDataBlock.info.BlockSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.DarwinDataBlock.info.BlockSignature, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //DarwinDataAnsi
-        if(cshllink_wstr(&(*input)->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi, _CSHLLINK_ERRX_NULLPSTRDARDA, _CSHLLINK_ERR_FIO, fp, 260))
-            return -1;
-        
-        //DarwinDataUnicode
-        if(cshllink_wwstr(&(*input)->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode, _CSHLLINK_ERRX_NULLPSTRDARDU, _CSHLLINK_ERR_FIO, fp, 520))
-            return -1;
-
-        return 0;
+        //Size and Signature, DarwinDataAnsi, DarwinDataUnicode
+        return _cshllink_writeFixedBlock(&_cshllink_layoutDarwin, &(*input)->cshllink_extdatablk.DarwinDataBlock.info, &(*input)->cshllink_extdatablk.DarwinDataBlock, cur);
     }
 
-    uint8_t _cshllink_writeEEnvironmentVariableDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeEEnvironmentVariableDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_EnvironmentVariableDataBlockSig)
             return 0;
         
         if((*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.info.BlockSize!=_CSHLLINK_EDBLK_EnvironmentVariableDataBlockSiz)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
 
-        //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.info.BlockSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.info.BlockSignature, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //EnvironmentVariableDataAnsi
-        if(cshllink_wstr(&(*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi, _CSHLLINK_ERRX_NULLPSTRENVDA, _CSHLLINK_ERR_FIO, fp, 260))
-            return -1;
-        
-        //EnvironmentVariableDataUnicode
-        if(cshllink_wwstr(&(*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode, _CSHLLINK_ERRX_NULLPSTRENVDU, _CSHLLINK_ERR_FIO, fp, 520))
-            return -1;
-
-        return 0;
+        //Size and Signature, EnvironmentVariableDataAnsi, EnvironmentVariableDataUnicode
+        return _cshllink_writeFixedBlock(&_cshllink_layoutEnvironment, &(*input)->cshllink_extdatablk.EnvironmentVariableDataBlock.info, &(*input)->cshllink_extdatablk.EnvironmentVariableDataBlock, cur);
     }
 
-    uint8_t _cshllink_writeEIconEnvironmentDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeEIconEnvironmentDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.IconEnvironmentDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_IconEnvironmentDataBlockSig)
             return 0;
         
         if((*input)->cshllink_extdatablk.IconEnvironmentDataBlock.info.BlockSize!=_CSHLLINK_EDBLK_IconEnvironmentDataBlockSiz)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
-        
-        //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.IconEnvironmentDataBlock.info.BlockSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.IconEnvironmentDataBlock.info.BlockSignature, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //IconEnvironmentDataAnsi
-        if(cshllink_wstr(&(*input)->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi, _CSHLLINK_ERRX_NULLPSTRIENVDA, _CSHLLINK_ERR_FIO, fp, 260))
-            return -1;
 
-        //IconEnvironmentDataUnicode
-        if(cshllink_wwstr(&(*input)->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode, _CSHLLINK_ERRX_NULLPSTRIENVDU, _CSHLLINK_ERR_FIO, fp, 520))
-            return -1;
-
-        return 0;
+        //Size and Signature, IconEnvironmentDataAnsi, IconEnvironmentDataUnicode
+        return _cshllink_writeFixedBlock(&_cshllink_layoutIconEnvironment, &(*input)->cshllink_extdatablk.IconEnvironmentDataBlock.info, &(*input)->cshllink_extdatablk.IconEnvironmentDataBlock, cur);
     }
 
-    uint8_t _cshllink_writeEKnownFolderDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeEKnownFolderDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.KnownFolderDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_KnownFolderDataBlockSig)
             return 0;
         
         if((*input)->cshllink_extdatablk.KnownFolderDataBlock.info.BlockSize!=_CSHLLINK_EDBLK_KnownFolderDataBlockSiz)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
 
-        //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.KnownFolderDataBlock.info.BlockSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.KnownFolderDataBlock.info.BlockSignature, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //KnownFolderID
-        if(cshllink_wstr((char **)&(*input)->cshllink_extdatablk.KnownFolderDataBlock.KnownFolderID, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, 16))
-            return -1;
-        
-        //Offset
-        if(fwrite(&(*input)->cshllink_extdatablk.KnownFolderDataBlock.Offset, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        return 0;
+        //Size and Signature, KnownFolderID, Offset
+        return _cshllink_writeFixedBlock(&_cshllink_layoutKnownFolder, &(*input)->cshllink_extdatablk.KnownFolderDataBlock.info, &(*input)->cshllink_extdatablk.KnownFolderDataBlock, cur);
     }
 
-    uint8_t _cshllink_writeEPropertyStoreDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeEPropertyStoreDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_PropertyStoreDataBlockSig)
             return 0;
         
@@ -1506,19 +3032,19 @@
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
 
         //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSize, 4, 1, fp) != 1)
+        if(_cshllink_cwrite(cur, &(*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSize, 4))
                 _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSignature, 4, 1, fp) != 1)
+        if(_cshllink_cwrite(cur, &(*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSignature, 4))
                 _cshllink_errint(_CSHLLINK_ERR_FIO);
 
         //PropertyStore
-        if(cshllink_wstr((char **)&(*input)->cshllink_extdatablk.KnownFolderDataBlock.KnownFolderID, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, (*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSize-8))
+        if(cshllink_wstr((char **)&(*input)->cshllink_extdatablk.PropertyStoreDataBlock.PropertyStore, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, cur, (*input)->cshllink_extdatablk.PropertyStoreDataBlock.info.BlockSize-8))
             return -1;
 
         return 0;
     }
 
-    uint8_t _cshllink_writeEShimDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeEShimDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_ShimDataBlockSig)
             return 0;
         
@@ -1526,118 +3052,80 @@
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
 
         //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSize, 4, 1, fp) != 1)
+        if(_cshllink_cwrite(cur, &(*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSize, 4))
                 _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSignature, 4, 1, fp) != 1)
+        if(_cshllink_cwrite(cur, &(*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSignature, 4))
                 _cshllink_errint(_CSHLLINK_ERR_FIO);
 
         //LayerName
-        if(cshllink_wwstr(&(*input)->cshllink_extdatablk.ShimDataBlock.LayerName, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, (*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSize-8))
+        if(cshllink_wwstr(&(*input)->cshllink_extdatablk.ShimDataBlock.LayerName, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, cur, (*input)->cshllink_extdatablk.ShimDataBlock.info.BlockSize-8))
             return -1;
 
         return 0;
     }
 
-    uint8_t _cshllink_writeESpecialFolderDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeESpecialFolderDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.SpecialFolderDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_SpecialFolderDataBlockSig)
             return 0;
         
         if((*input)->cshllink_extdatablk.SpecialFolderDataBlock.info.BlockSize!=_CSHLLINK_EDBLK_SpecialFolderDataBlockSiz)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
 
-        //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.SpecialFolderDataBlock.info.BlockSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.SpecialFolderDataBlock.info.BlockSignature, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //SpecialFolderID
-        if(fwrite(&(*input)->cshllink_extdatablk.SpecialFolderDataBlock.SpecialFolderID, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //Offset
-        if(fwrite(&(*input)->cshllink_extdatablk.SpecialFolderDataBlock.Offset, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        return 0;
+        //Size and Signature, SpecialFolderID, Offset
+        return _cshllink_writeFixedBlock(&_cshllink_layoutSpecialFolder, &(*input)->cshllink_extdatablk.SpecialFolderDataBlock.info, &(*input)->cshllink_extdatablk.SpecialFolderDataBlock, cur);
     }
 
-    uint8_t _cshllink_writeETrackerDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeETrackerDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.TrackerDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_TrackerDataBlockSig)
             return 0;
 
         if((*input)->cshllink_extdatablk.TrackerDataBlock.info.BlockSize!=_CSHLLINK_EDBLK_TrackerDataBlockSiz)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
-
-
-
-        //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.TrackerDataBlock.info.BlockSize, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.TrackerDataBlock.info.BlockSignature, 4, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //Length
         if((*input)->cshllink_extdatablk.TrackerDataBlock.Length!=_CSHLLINK_EDBLK_TrackerDataBlockLen)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
-        if(fwrite(&(*input)->cshllink_extdatablk.TrackerDataBlock.Length, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-
-        //Version
         if((*input)->cshllink_extdatablk.TrackerDataBlock.Version!=0)
             _cshllink_errint(_CSHLLINK_ERRX_WRONGVERSION);
-        if(fwrite(&(*input)->cshllink_extdatablk.TrackerDataBlock.Version, 4, 1, fp)!=1)
-            _cshllink_errint(_CSHLLINK_ERR_FIO);
-        
-        //MachineID
-        if(cshllink_wstr(&(*input)->cshllink_extdatablk.TrackerDataBlock.MachineID, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, 16))
-            return -1;
-
-        //Droid
-        if(cshllink_wstr((char **)&(*input)->cshllink_extdatablk.TrackerDataBlock.Droid, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, 32))
-            return -1;
-
-        //DroidBirth
-        if(cshllink_wstr((char **)&(*input)->cshllink_extdatablk.TrackerDataBlock.DroidBirth, _CSHLLINK_ERR_NULLPEXTD, _CSHLLINK_ERR_FIO, fp, 32))
-            return -1;
 
-        return 0;
+        //Size and Signature, Length, Version, MachineID, Droid, DroidBirth
+        return _cshllink_writeFixedBlock(&_cshllink_layoutTracker, &(*input)->cshllink_extdatablk.TrackerDataBlock.info, &(*input)->cshllink_extdatablk.TrackerDataBlock, cur);
     }
 
-    uint8_t _cshllink_writeEVistaAndAboveIDListDataBlock(cshllink **input, FILE *fp) {
+    uint8_t _cshllink_writeEVistaAndAboveIDListDataBlock(cshllink **input, struct _cshllink_ocursor *cur) {
         if((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSig)
             return 0;
         
-        if((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.info.BlockSize<_CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSiz)
-            _cshllink_errint(_CSHLLINK_ERRX_WRONGSIZE);
-
-        //Size and Signature
-        if(fwrite(&(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.info.BlockSize, 4, 1, fp) != 1)
+        //Size (derived from the items) and Signature
+        uint32_t BlockSize = (*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_bloblen + _CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSiz;
+        if(_cshllink_cwrite(cur, &BlockSize, 4))
                 _cshllink_errint(_CSHLLINK_ERR_FIO);
-        if(fwrite(&(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.info.BlockSignature, 4, 1, fp) != 1)
+        if(_cshllink_cwrite(cur, &(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.info.BlockSignature, 4))
                 _cshllink_errint(_CSHLLINK_ERR_FIO);
 
-        if((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item==NULL) 
-                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
-        for(int i=0; i<(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_inum; i++) {
-            //Element size
-            if(fwrite(&(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[i].item_size, 2, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-            //Element (size -2 as struct contains one 2byte var)
-            if((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[i].item==NULL)
-                _cshllink_errint(_CSHLLINK_ERR_NULLPIDLM);
-            if(fwrite((*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[i].item, (*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_item[i].item_size-2, 1, fp) != 1)
-                _cshllink_errint(_CSHLLINK_ERR_FIO);
-        }
+        //Elements (one write of the blob)
+        if(_cshllink_writeIDList(&(*input)->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl, cur))
+            return -1;
 
         //TerminalBlock
         uint16_t nullb=0;
-        if(fwrite(&nullb, 2, 1, fp)!=1)
+        if(_cshllink_cwrite(cur, &nullb, 2))
             _cshllink_errint(_CSHLLINK_ERR_FIO);
 
         return 0;
     }
 
+    /*
+        write the ItemIDs of an IDList (TerminalBlock excluded)
+    */
+    uint8_t _cshllink_writeIDList(const struct _cshllink_lnktidl_idl *list, struct _cshllink_ocursor *cur) {
+        if(list->idl_bloblen==0)
+            return 0;
+        if(list->idl_blob==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPIDLM);
+        if(_cshllink_cwriteRef(cur, list->idl_blob, list->idl_bloblen))
+            _cshllink_errint(_CSHLLINK_ERR_FIO);
+        return 0;
+    }
+
     #pragma endregion
 
     #pragma region util
@@ -1646,156 +3134,774 @@
         frees whole structure
     */
     void cshllink_free(cshllink *inputStruct) {      
-        free(inputStruct->cshllink_extdatablk.ConsoleDataBlock.FaceName);
-        free(inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi);
-        free(inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode);
-        free(inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi);
-        free(inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode);
-        free(inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi);
-        free(inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode);
-        free(inputStruct->cshllink_extdatablk.KnownFolderDataBlock.KnownFolderID);
-        free(inputStruct->cshllink_extdatablk.PropertyStoreDataBlock.PropertyStore);
-        free(inputStruct->cshllink_extdatablk.ShimDataBlock.LayerName);
-        free(inputStruct->cshllink_extdatablk.TrackerDataBlock.Droid);
-        free(inputStruct->cshllink_extdatablk.TrackerDataBlock.DroidBirth);
-        free(inputStruct->cshllink_extdatablk.TrackerDataBlock.MachineID);
-        free(inputStruct->cshllink_lnkinfo.CommonPathSuffix);
-        free(inputStruct->cshllink_lnkinfo.CommonPathSuffixUnicode);
-        free(inputStruct->cshllink_lnkinfo.LocalBasePath);
-        free(inputStruct->cshllink_lnkinfo.LocalBasePathUnicode);
-        for(int i=0; i<inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_inum; i++) {
-            if(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[i].item!=NULL)
-                free(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item[i].item);
-        }
-        free(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_item);
-        free(inputStruct->cshllink_strdata.CommandLineArguments.UString);
-        free(inputStruct->cshllink_strdata.IconLocation.UString);
-        free(inputStruct->cshllink_strdata.NameString.UString);
-        free(inputStruct->cshllink_strdata.RelativePath.UString);
-        free(inputStruct->cshllink_strdata.WorkingDir.UString);
-    }
-
-    //IDList (also for VistaAndAboveIDList -- param idl pointer)
+        const cshllink_allocator *alloc = inputStruct->cshllink_allocator!=NULL ? inputStruct->cshllink_allocator : cshllink_getAllocator();
+        _cshllink_freeBlocks(inputStruct);
+        // arena: the fields are released with the arena (cshllink_arena_reset)
+        if(alloc->free!=NULL)
+            _cshllink_freeFields(inputStruct);
+        if(inputStruct->cshllink_map!=NULL)
+            _cshllink_unmap(inputStruct->cshllink_map, inputStruct->cshllink_mapsize);
+        // cleared (but the allocator): the structure may be loaded or reloaded again
+        const cshllink_allocator *keep = inputStruct->cshllink_allocator;
+        memset(inputStruct, 0, sizeof *inputStruct);
+        inputStruct->cshllink_allocator = keep;
+    }
+
+    /*
+        frees all owned heap fields (borrowed fields are skipped)
+    */
+    void _cshllink_freeFields(cshllink *inputStruct) {
+        const cshllink_allocator *alloc = inputStruct->cshllink_allocator;
+        // borrowed fields point into the input (cshllink_loadView / cshllink_loadMapped)
+        if(!(inputStruct->cshllink_borrowed&CSHLLINK_SEC_EXTRADATA)) {
+        #ifndef CSHLLINK_INLINE_EXTRADATA
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.ConsoleDataBlock.FaceName);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.KnownFolderDataBlock.KnownFolderID);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.TrackerDataBlock.Droid);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.TrackerDataBlock.DroidBirth);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.TrackerDataBlock.MachineID);
+        #endif
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.PropertyStoreDataBlock.PropertyStore);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_extdatablk.ShimDataBlock.LayerName);
+            _cshllink_dealloc(inputStruct->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_allocator, inputStruct->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_blob);
+            for(int i=0; i<inputStruct->cshllink_edblklistnum; i++)
+                _cshllink_dealloc(alloc, (void *)inputStruct->cshllink_edblklist[i].raw);
+        }
+        _cshllink_dealloc(alloc, inputStruct->cshllink_edblklist);
+        _cshllink_dealloc(inputStruct->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_allocator, inputStruct->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl.idl_off);
+        if(!(inputStruct->cshllink_borrowed&CSHLLINK_SEC_LINKINFO)) {
+            _cshllink_dealloc(alloc, inputStruct->cshllink_lnkinfo.CommonPathSuffix);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_lnkinfo.CommonPathSuffixUnicode);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_lnkinfo.LocalBasePath);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_lnkinfo.LocalBasePathUnicode);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetName);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceName);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.NetNameUnicode);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_cnetrlnk.DeviceNameUnicode);
+        }
+        if(!(inputStruct->cshllink_borrowed&CSHLLINK_SEC_LINKTARGETIDLIST))
+            _cshllink_dealloc(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_allocator, inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_blob);
+        _cshllink_dealloc(inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_allocator, inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl.idl_off);
+        if(!(inputStruct->cshllink_borrowed&CSHLLINK_SEC_STRINGDATA)) {
+            _cshllink_dealloc(alloc, inputStruct->cshllink_strdata.CommandLineArguments.UString);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_strdata.IconLocation.UString);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_strdata.NameString.UString);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_strdata.RelativePath.UString);
+            _cshllink_dealloc(alloc, inputStruct->cshllink_strdata.WorkingDir.UString);
+        }
+        if(inputStruct->cshllink_borrowed==0)
+            _cshllink_dealloc(alloc, (void *)inputStruct->cshllink_input);
+    }
+
+    /*
+        releases the blocks decoded by registered handlers (cshllink_registerBlock)
+    */
+    void _cshllink_freeBlocks(cshllink *inputStruct) {
+        for(int i=0; i<inputStruct->cshllink_edblklistnum; i++) {
+            struct _cshllink_edblkent *entry = &inputStruct->cshllink_edblklist[i];
+            if(entry->block==NULL || _CSHLLINK_EDBLK_KNOWN(entry->BlockSignature))
+                continue;
+            const cshllink_blockhandler *handler = _cshllink_edblkHandler(entry->BlockSignature);
+            if(handler!=NULL && handler->free!=NULL)
+                handler->free(inputStruct, entry);
+            entry->block = NULL;
+        }
+    }
+
+    /*
+        -> cshllink structure pointer
+        -- copies all borrowed fields (cshllink_loadView / cshllink_loadMapped) into owned heap memory and releases a kept mapping
+        <- on error this function will return -1 (inputStruct is unchanged), on success 0
+
+        called by the setters. The IDList functions only receive the list, call cshllink_detach before using them on a view
+    */
+    uint8_t cshllink_detach(cshllink *inputStruct) {
+        if(inputStruct==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        if(inputStruct->cshllink_borrowed==0)
+            return 0;
+        const cshllink_allocator *alloc = inputStruct->cshllink_allocator;
+
+        // collect borrowed fields with their sizes
+        size_t num = _CSHLLINK_FIELD_NUM+inputStruct->cshllink_edblklistnum, n;
+        void ***fields = _cshllink_alloc(alloc, num * sizeof *fields);
+        size_t *sizes = _cshllink_alloc(alloc, num * sizeof *sizes);
+        void **copies = _cshllink_alloc(alloc, num * sizeof *copies);
+        if(fields==NULL || sizes==NULL || copies==NULL) {
+            _cshllink_dealloc(alloc, fields);
+            _cshllink_dealloc(alloc, sizes);
+            _cshllink_dealloc(alloc, copies);
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        }
+        struct _cshllink_fieldlist list = {fields, sizes, 0};
+        // the input is only needed (and copied) while changes are tracked
+        if(!inputStruct->cshllink_tracked) {
+            inputStruct->cshllink_input = NULL;
+            inputStruct->cshllink_inputsize = 0;
+        }
+        _cshllink_eachField(inputStruct, inputStruct->cshllink_borrowed, _cshllink_collectField, &list);
+        n = list.n;
+
+        // copy all fields first, so inputStruct stays untouched on error
+        for(size_t i=0; i<n; i++) {
+            copies[i] = NULL;
+            if(*fields[i]==NULL)
+                continue;
+            copies[i] = _cshllink_alloc(alloc, sizes[i] ? sizes[i] : 1);
+            if(copies[i]==NULL) {
+                while(i-->0)
+                    _cshllink_dealloc(alloc, copies[i]);
+                _cshllink_dealloc(alloc, fields);
+                _cshllink_dealloc(alloc, sizes);
+                _cshllink_dealloc(alloc, copies);
+                _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+            }
+            memcpy(copies[i], *fields[i], sizes[i]);
+        }
+        for(size_t i=0; i<n; i++)
+            *fields[i] = copies[i];
+        // the IDList blobs are owned now and can grow
+        struct _cshllink_lnktidl_idl *idl = &inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl;
+        struct _cshllink_lnktidl_idl *vidl = &inputStruct->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl;
+        if(idl->idl_blob!=NULL && (inputStruct->cshllink_borrowed&CSHLLINK_SEC_LINKTARGETIDLIST))
+            idl->idl_blobcap = idl->idl_bloblen ? idl->idl_bloblen : 1;
+        if(vidl->idl_blob!=NULL && (inputStruct->cshllink_borrowed&CSHLLINK_SEC_EXTRADATA))
+            vidl->idl_blobcap = vidl->idl_bloblen ? vidl->idl_bloblen : 1;
+
+        _cshllink_dealloc(alloc, fields);
+        _cshllink_dealloc(alloc, sizes);
+        _cshllink_dealloc(alloc, copies);
+
+        inputStruct->cshllink_borrowed = 0;
+        if(inputStruct->cshllink_map!=NULL) {
+            _cshllink_unmap(inputStruct->cshllink_map, inputStruct->cshllink_mapsize);
+            inputStruct->cshllink_map = NULL;
+            inputStruct->cshllink_mapsize = 0;
+        }
+        return 0;
+    }
+
+    /*
+        -> cshllink structure pointer
+        -> sections (CSHLLINK_SEC_*) whose fields were changed directly
+        -- marks the sections as modified: the writers encode them from the structure instead of copying them from the loaded input (see cshllink_trackDirty)
+        <- on error this function will return -1, on success 0
+
+        the setters and the IDList functions mark their sections themselves. Header fields need no call, they are compared with the input
+    */
+    uint8_t cshllink_setDirty(cshllink *inputStruct, uint32_t sections) {
+        if(inputStruct==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        inputStruct->cshllink_dirty |= sections;
+        return 0;
+    }
+
+    /*
+        -> cshllink structure pointer (loaded with cshllink_loadView / cshllink_loadMapped keep and not detached yet, or with cshllink_ctx.track)
+        -- opt-in: from now on the writers copy the sections not modified by a setter, an IDList function or cshllink_setDirty from the input instead of encoding them (the input is copied once if the structure is detached later)
+        <- on error this function will return -1 (the input is not kept, e.g. after cshllink_loadBuffer without cshllink_ctx.track), on success 0
+
+        fields changed directly after this call are only written if their section is passed to cshllink_setDirty
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_trackDirty(cshllink *inputStruct) {
+        if(inputStruct==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        if(inputStruct->cshllink_input==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NOINPUT);
+        inputStruct->cshllink_tracked = 1;
+        return 0;
+    }
+
+    /*
+        calls fn for every heap field of sections (CSHLLINK_SEC_*) with its size in bytes (fields may be NULL)
+        IDList and VistaAndAboveIDList offset arrays are not included, cshllink_input only with all of _CSHLLINK_SEC_VIEW
+    */
+    void _cshllink_eachField(cshllink *inputStruct, uint32_t sections, void (*fn)(void **field, size_t size, void *user), void *user) {
+        struct _cshllink_lnkinfo *li = &inputStruct->cshllink_lnkinfo;
+        struct _cshllink_strdata *sd = &inputStruct->cshllink_strdata;
+        struct _cshllink_extdatablk *ed = &inputStruct->cshllink_extdatablk;
+        struct _cshllink_lnktidl_idl *idl = &inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl;
+        struct _cshllink_lnktidl_idl *vidl = &ed->VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl;
+
+        #define _cshllink_field(field, size) fn((void **)&(field), (size), user)
+
+        if(sections&CSHLLINK_SEC_LINKTARGETIDLIST) {
+            _cshllink_field(idl->idl_blob, idl->idl_bloblen);
+        }
+        if(sections&CSHLLINK_SEC_LINKINFO) {
+            size_t VdataSize = li->cshllink_lnkinfo_volid.VolumeIDSize - (li->cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014 ? 20 : 16);
+            if(li->cshllink_lnkinfo_volid.VolumeLabelOffset==0x00000014)
+                VdataSize = VdataSize/2*sizeof(char16_t);
+            _cshllink_field(li->cshllink_lnkinfo_volid.Data, VdataSize);
+            if(li->LocalBasePath!=NULL)
+                _cshllink_field(li->LocalBasePath, strlen(li->LocalBasePath)+1);
+            if(li->CommonPathSuffix!=NULL)
+                _cshllink_field(li->CommonPathSuffix, strlen(li->CommonPathSuffix)+1);
+            if(li->LocalBasePathUnicode!=NULL)
+                _cshllink_field(li->LocalBasePathUnicode, (cshllink_strlen16(li->LocalBasePathUnicode)+1)*sizeof(char16_t));
+            if(li->CommonPathSuffixUnicode!=NULL)
+                _cshllink_field(li->CommonPathSuffixUnicode, (cshllink_strlen16(li->CommonPathSuffixUnicode)+1)*sizeof(char16_t));
+            if(li->cshllink_lnkinfo_cnetrlnk.NetName!=NULL)
+                _cshllink_field(li->cshllink_lnkinfo_cnetrlnk.NetName, strlen(li->cshllink_lnkinfo_cnetrlnk.NetName)+1);
+            if(li->cshllink_lnkinfo_cnetrlnk.DeviceName!=NULL)
+                _cshllink_field(li->cshllink_lnkinfo_cnetrlnk.DeviceName, strlen(li->cshllink_lnkinfo_cnetrlnk.DeviceName)+1);
+            if(li->cshllink_lnkinfo_cnetrlnk.NetNameUnicode!=NULL)
+                _cshllink_field(li->cshllink_lnkinfo_cnetrlnk.NetNameUnicode, strlen(li->cshllink_lnkinfo_cnetrlnk.NetNameUnicode)+1);
+            if(li->cshllink_lnkinfo_cnetrlnk.DeviceNameUnicode!=NULL)
+                _cshllink_field(li->cshllink_lnkinfo_cnetrlnk.DeviceNameUnicode, strlen(li->cshllink_lnkinfo_cnetrlnk.DeviceNameUnicode)+1);
+        }
+        if(sections&CSHLLINK_SEC_STRINGDATA) {
+            _cshllink_field(sd->NameString.UString, sd->NameString.CountCharacters*sizeof(char16_t));
+            _cshllink_field(sd->RelativePath.UString, sd->RelativePath.CountCharacters*sizeof(char16_t));
+            _cshllink_field(sd->WorkingDir.UString, sd->WorkingDir.CountCharacters*sizeof(char16_t));
+            _cshllink_field(sd->CommandLineArguments.UString, sd->CommandLineArguments.CountCharacters*sizeof(char16_t));
+            _cshllink_field(sd->IconLocation.UString, sd->IconLocation.CountCharacters*sizeof(char16_t));
+        }
+        if(sections&CSHLLINK_SEC_EXTRADATA) {
+        #ifndef CSHLLINK_INLINE_EXTRADATA
+            _cshllink_field(ed->ConsoleDataBlock.FaceName, 64);
+            _cshllink_field(ed->DarwinDataBlock.DarwinDataAnsi, 260);
+            _cshllink_field(ed->DarwinDataBlock.DarwinDataUnicode, 520);
+            _cshllink_field(ed->EnvironmentVariableDataBlock.TargetAnsi, 260);
+            _cshllink_field(ed->EnvironmentVariableDataBlock.TargetUnicode, 520);
+            _cshllink_field(ed->IconEnvironmentDataBlock.TargetAnsi, 260);
+            _cshllink_field(ed->IconEnvironmentDataBlock.TargetUnicode, 520);
+            _cshllink_field(ed->KnownFolderDataBlock.KnownFolderID, 16);
+            _cshllink_field(ed->TrackerDataBlock.MachineID, 16);
+            _cshllink_field(ed->TrackerDataBlock.Droid, 32);
+            _cshllink_field(ed->TrackerDataBlock.DroidBirth, 32);
+        #endif
+            _cshllink_field(ed->PropertyStoreDataBlock.PropertyStore, ed->PropertyStoreDataBlock.info.BlockSize-8);
+            _cshllink_field(ed->ShimDataBlock.LayerName, (ed->ShimDataBlock.info.BlockSize-8)/2*sizeof(char16_t));
+            _cshllink_field(vidl->idl_blob, vidl->idl_bloblen);
+            for(int i=0; i<inputStruct->cshllink_edblklistnum; i++)
+                _cshllink_field(inputStruct->cshllink_edblklist[i].raw, inputStruct->cshllink_edblklist[i].BlockSize);
+        }
+        // the input spans all sections
+        if((sections&_CSHLLINK_SEC_VIEW)==_CSHLLINK_SEC_VIEW)
+            _cshllink_field(inputStruct->cshllink_input, inputStruct->cshllink_inputsize);
+        #undef _cshllink_field
+    }
+
+    /*
+        _cshllink_eachField callback of cshllink_detach (appends to a _cshllink_fieldlist)
+    */
+    void _cshllink_collectField(void **field, size_t size, void *user) {
+        struct _cshllink_fieldlist *list = user;
+        list->fields[list->n] = field;
+        list->sizes[list->n] = size;
+        list->n++;
+    }
+
+    /*
+        -> cshllink structure pointer (loaded or zeroed)
+        -> pool receiving the buffers (NULL: same as cshllink_free)
+        -- clears the content like cshllink_free, but keeps owned heap buffers (strings, blobs, IDList blobs and offset arrays) in pool for cshllink_reload
+        structures of an arena (cshllink_arena) and of another allocator than the buffers already in pool keep nothing
+    */
+    void cshllink_reset(cshllink *inputStruct, cshllink_pool *pool) {
+        if(inputStruct==NULL)
+            return;
+        const cshllink_allocator *alloc = inputStruct->cshllink_allocator!=NULL ? inputStruct->cshllink_allocator : cshllink_getAllocator();
+        // arena: the fields are released with the arena, a pool holds buffers of one allocator only
+        if(pool==NULL || alloc->free==NULL || (pool->num!=0 && pool->allocator!=alloc)) {
+            cshllink_free(inputStruct);
+            return;
+        }
+        pool->allocator = alloc;
+
+        _cshllink_freeBlocks(inputStruct);
+        struct _cshllink_lnktidl_idl *idl = &inputStruct->cshllink_lnktidl.cshllink_lnktidl_idl;
+        struct _cshllink_lnktidl_idl *vidl = &inputStruct->cshllink_extdatablk.VistaAndAboveIDListDataBlock.cshllink_lnktidl_idl;
+        _cshllink_eachField(inputStruct, _CSHLLINK_SEC_VIEW&~inputStruct->cshllink_borrowed, _cshllink_keepField, pool);
+        _cshllink_spareKeep(pool, idl->idl_off, idl->idl_offcap * sizeof *idl->idl_off);
+        _cshllink_spareKeep(pool, vidl->idl_off, vidl->idl_offcap * sizeof *vidl->idl_off);
+        _cshllink_spareKeep(pool, inputStruct->cshllink_edblklist, inputStruct->cshllink_edblklistcap * sizeof *inputStruct->cshllink_edblklist);
+        if(inputStruct->cshllink_map!=NULL)
+            _cshllink_unmap(inputStruct->cshllink_map, inputStruct->cshllink_mapsize);
+
+        // cleared (but the allocator) like by cshllink_free, the structure owns nothing
+        const cshllink_allocator *keep = inputStruct->cshllink_allocator;
+        memset(inputStruct, 0, sizeof *inputStruct);
+        inputStruct->cshllink_allocator = keep;
+    }
+
+    /*
+        _cshllink_eachField callback of cshllink_reset (keeps the field as spare buffer)
+    */
+    void _cshllink_keepField(void **field, size_t size, void *user) {
+        _cshllink_spareKeep(user, *field, size);
+    }
+
+    /*
+        -> open file descriptor of type FILE (R mode) / buffer and its size
+        -> cshllink structure pointer (loaded or zeroed, not freed before)
+        -> pool (initialized with {0} or used before)
+        -- same as cshllink_loadFile / cshllink_loadBuffer, but resets inputStruct into pool (cshllink_reset) instead of discarding it: fields are served from the pool when the new content fits
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_reload(FILE *fp, cshllink *inputStruct, cshllink_pool *pool) {
+        if(fp==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_FCL);
+        if(inputStruct==NULL || pool==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+
+        cshllink_reset(inputStruct, pool);
+        cshllink_ctx ctx = {0};
+        ctx.allocator = inputStruct->cshllink_allocator;
+        return _cshllink_loadFile(fp, inputStruct, &ctx, pool);
+    }
+    uint8_t cshllink_reloadBuffer(const uint8_t *data, size_t size, cshllink *inputStruct, cshllink_pool *pool) {
+        if(data==NULL || inputStruct==NULL || pool==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+
+        cshllink_reset(inputStruct, pool);
+        struct _cshllink_cursor cur = {0};
+        cur.data = data;
+        cur.size = size;
+        cur.alloc = inputStruct->cshllink_allocator;
+        cur.pool = pool;
+        return _cshllink_parse(&cur, inputStruct);
+    }
+
+    /*
+        spare buffers: keep (frees the buffer if the pool is full), take the smallest buffer of at least "size" bytes (NULL if none)
+    */
+    void _cshllink_spareKeep(cshllink_pool *pool, void *ptr, size_t size) {
+        if(ptr==NULL)
+            return;
+        if(size==0 || pool->num>=_CSHLLINK_SPARE_NUM) {
+            _cshllink_dealloc(pool->allocator, ptr);
+            return;
+        }
+        // insert sorted by size
+        int i = pool->num;
+        while(i>0 && pool->spare[i-1].size>size) {
+            pool->spare[i] = pool->spare[i-1];
+            i--;
+        }
+        pool->spare[i].ptr = ptr;
+        pool->spare[i].size = size;
+        pool->num++;
+    }
+    void *_cshllink_spareTake(cshllink_pool *pool, size_t size) {
+        // first entry of at least size bytes (binary search)
+        int lo = 0, hi = pool->num;
+        while(lo<hi) {
+            int mid = (lo+hi)/2;
+            if(pool->spare[mid].size<size)
+                lo = mid+1;
+            else
+                hi = mid;
+        }
+        if(lo==pool->num)
+            return NULL;
+
+        void *ptr = pool->spare[lo].ptr;
+        pool->num--;
+        memmove(&pool->spare[lo], &pool->spare[lo+1], (pool->num-lo) * sizeof *pool->spare);
+        return ptr;
+    }
+
+    /*
+        allocate "size" bytes for the structure read by cur (spare buffers first)
+    */
+    void *_cshllink_curAlloc(struct _cshllink_cursor *cur, size_t size) {
+        if(cur->pool!=NULL && cur->pool->num!=0) {
+            void *ptr = _cshllink_spareTake(cur->pool, size);
+            if(ptr!=NULL)
+                return ptr;
+        }
+        return _cshllink_alloc(cur->alloc, size);
+    }
+
+    /*
+        true if the "size" bytes at data are all 0
+    */
+    int _cshllink_isZero(const void *data, size_t size) {
+        const uint8_t *p = data;
+        // every byte equals its successor and the first is 0 (memcmp is vectorized, a byte loop with an early exit is not)
+        return size==0 || (p[0]==0 && memcmp(p, p+1, size-1)==0);
+    }
+
+    /*
+        -> cshllink structure pointer (loaded)
+        -> compact structure receiving the content
+        -- moves the content of inputStruct into out (heap fields are handed over, not copied), inputStruct is cleared like by cshllink_free and can be loaded again
+        <- on error this function will return -1 (inputStruct is unchanged), on success 0
+
+        the input and the changes tracked by cshllink_trackDirty are not kept (all sections are encoded after cshllink_fromCompact). Fails with 0x2F if skipped sections are only writable from the input
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_toCompact(cshllink *inputStruct, cshllink_compact *out) {
+        if(inputStruct==NULL || out==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        const cshllink_allocator *alloc = inputStruct->cshllink_allocator;
+        // skipped sections only written from the input (cshllink_trackDirty) would become unwritable, the compact form keeps no input
+        if(inputStruct->cshllink_skipped && (_cshllink_unwritableWith(inputStruct, 0)&~_cshllink_unwritable(inputStruct)))
+            _cshllink_errint(_CSHLLINK_ERR_SKIPPED);
+
+        // cold allocation: [LinkInfo][block list][blocks], each part 8-byte aligned
+        #define _cshllink_align8(x) (((x)+7)&~(size_t)7)
+        uint8_t haslnkinfo = !_cshllink_isZero(&inputStruct->cshllink_lnkinfo, sizeof inputStruct->cshllink_lnkinfo);
+        uint8_t num = 0;
+        uint16_t present = 0;
+        size_t blocksize = 0;
+        for(int i=0; i<16; i++) {
+            const struct _cshllink_edblkmember *m = &_cshllink_edblkmembers[i];
+            // a non-empty block is always kept (its heap fields move with it)
+            if(m->size==0 || _cshllink_isZero((const uint8_t *)&inputStruct->cshllink_extdatablk + m->offset, m->size))
+                continue;
+            present |= 1u<<i;
+            num++;
+            blocksize += _cshllink_align8(m->size);
+        }
+        size_t lnkinfosize = haslnkinfo ? _cshllink_align8(sizeof(struct _cshllink_lnkinfo)) : 0;
+        size_t listsize = _cshllink_align8(num * sizeof(struct _cshllink_compact_edblk));
+        size_t coldsize = lnkinfosize + listsize + blocksize;
+
+        uint8_t *cold = NULL;
+        if(coldsize!=0) {
+            cold = _cshllink_alloc(alloc, coldsize);
+            if(cold==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        }
+
+        memset(out, 0, sizeof *out);
+        out->cshllink_header = inputStruct->cshllink_header;
+        out->cshllink_lnktidl = inputStruct->cshllink_lnktidl;
+        out->cshllink_strdata = inputStruct->cshllink_strdata;
+        out->cshllink_borrowed = inputStruct->cshllink_borrowed;
+        out->cshllink_skipped = inputStruct->cshllink_skipped;
+        out->cshllink_map = inputStruct->cshllink_map;
+        out->cshllink_mapsize = inputStruct->cshllink_mapsize;
+        out->cshllink_allocator = alloc;
+        out->cshllink_cold = cold;
+        out->cshllink_coldsize = coldsize;
+        if(haslnkinfo) {
+            out->cshllink_lnkinfo = (struct _cshllink_lnkinfo *)cold;
+            *out->cshllink_lnkinfo = inputStruct->cshllink_lnkinfo;
+        }
+        if(num!=0) {
+            out->cshllink_edblk = (struct _cshllink_compact_edblk *)(cold + lnkinfosize);
+            uint8_t *block = cold + lnkinfosize + listsize;
+            // ascending low nibble == ascending BlockSignature
+            for(int i=0; i<16; i++) {
+                const struct _cshllink_edblkmember *m = &_cshllink_edblkmembers[i];
+                if(!(present&(1u<<i)))
+                    continue;
+                const uint8_t *src = (const uint8_t *)&inputStruct->cshllink_extdatablk + m->offset;
+                memcpy(block, src, m->size);
+                out->cshllink_edblk[out->cshllink_edblknum].BlockSignature = 0xA0000000u|(uint32_t)i;
+                out->cshllink_edblk[out->cshllink_edblknum].block = block;
+                out->cshllink_edblknum++;
+                block += _cshllink_align8(m->size);
+            }
+        }
+        // the ExtraDataBlock list is handed over as is
+        out->cshllink_edblklist = inputStruct->cshllink_edblklist;
+        out->cshllink_edblklistnum = inputStruct->cshllink_edblklistnum;
+        if(out->cshllink_edblklistnum!=0) {
+            // decoded known blocks: point to the copy in the cold allocation (blocks of registered handlers stay)
+            for(int i=0; i<out->cshllink_edblklistnum; i++) {
+                if(out->cshllink_edblklist[i].block!=NULL && _CSHLLINK_EDBLK_KNOWN(out->cshllink_edblklist[i].BlockSignature))
+                    out->cshllink_edblklist[i].block = cshllink_compactBlock(out, out->cshllink_edblklist[i].BlockSignature);
+            }
+        }
+        #undef _cshllink_align8
+
+        // the heap fields and the mapping belong to out now, the input is not kept (no section index)
+        if(inputStruct->cshllink_borrowed==0)
+            _cshllink_dealloc(alloc, (void *)inputStruct->cshllink_input);
+        memset(inputStruct, 0, sizeof *inputStruct);
+        inputStruct->cshllink_allocator = alloc;
+        return 0;
+    }
+
+    /*
+        -> compact structure pointer
+        -> cshllink structure receiving the content (not freed before)
+        -- moves the content of in back into out, in is cleared. Does not allocate
+        <- on error this function will return -1, on success 0
+    */
+    uint8_t cshllink_fromCompact(cshllink_compact *in, cshllink *out) {
+        if(in==NULL || out==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+
+        memset(out, 0, sizeof *out);
+        out->cshllink_header = in->cshllink_header;
+        out->cshllink_lnktidl = in->cshllink_lnktidl;
+        out->cshllink_strdata = in->cshllink_strdata;
+        if(in->cshllink_lnkinfo!=NULL)
+            out->cshllink_lnkinfo = *in->cshllink_lnkinfo;
+        for(int i=0; i<in->cshllink_edblknum; i++) {
+            const struct _cshllink_edblkmember *m = &_cshllink_edblkmembers[in->cshllink_edblk[i].BlockSignature&0x0F];
+            memcpy((uint8_t *)&out->cshllink_extdatablk + m->offset, in->cshllink_edblk[i].block, m->size);
+        }
+        out->cshllink_edblklist = in->cshllink_edblklist;
+        out->cshllink_edblklistnum = in->cshllink_edblklistnum;
+        out->cshllink_edblklistcap = in->cshllink_edblklistnum;
+        for(int i=0; i<out->cshllink_edblklistnum; i++) {
+            if(out->cshllink_edblklist[i].block!=NULL && _CSHLLINK_EDBLK_KNOWN(out->cshllink_edblklist[i].BlockSignature))
+                out->cshllink_edblklist[i].block = _cshllink_edblkAt(&out->cshllink_extdatablk, out->cshllink_edblklist[i].BlockSignature);
+        }
+        out->cshllink_borrowed = in->cshllink_borrowed;
+        out->cshllink_skipped = in->cshllink_skipped;
+        out->cshllink_map = in->cshllink_map;
+        out->cshllink_mapsize = in->cshllink_mapsize;
+        out->cshllink_allocator = in->cshllink_allocator;
+
+        _cshllink_dealloc(in->cshllink_allocator, in->cshllink_cold);
+        memset(in, 0, sizeof *in);
+        return 0;
+    }
+
+    /*
+        -> compact structure pointer
+        -- frees all owned heap fields and the cold allocation, in is cleared
+    */
+    void cshllink_freeCompact(cshllink_compact *in) {
+        if(in==NULL)
+            return;
+        cshllink tmp;
+        cshllink_fromCompact(in, &tmp);
+        cshllink_free(&tmp);
+        memset(in, 0, sizeof *in);
+    }
+
+    /*
+        -> compact structure pointer
+        -> BlockSignature of the ExtraDataBlock (_CSHLLINK_EDBLK_*Sig)
+        <- block structure (e.g. struct _cshllink_extdatablk_trackdblk * for _CSHLLINK_EDBLK_TrackerDataBlockSig), NULL if the block is not present
+    */
+    void *cshllink_compactBlock(const cshllink_compact *in, uint32_t BlockSignature) {
+        if(in==NULL)
+            return NULL;
+        // at most 11 entries: a linear scan beats a binary search
+        for(int i=0; i<in->cshllink_edblknum && in->cshllink_edblk[i].BlockSignature<=BlockSignature; i++)
+            if(in->cshllink_edblk[i].BlockSignature==BlockSignature)
+                return in->cshllink_edblk[i].block;
+        return NULL;
+    }
+
+    //IDList container (LinkTargetIDList and VistaAndAboveIDList -- param idl pointer)
         /*
-            set idl item
-            IN: pointer to IDL item; data for item; length in bytes of data;
+            get idl item
+            IN: pointer to IDList; index of the item; size (out, may be NULL): length in bytes of the data (ItemIDSize - 2)
+            OUT: pointer to the data of the item (inside idl_blob)
+                 NULL - Error
+        */
+        const uint8_t *cshllink_IDListItem(const struct _cshllink_lnktidl_idl *list, uint16_t index, uint16_t *size) {
+            if(list==NULL || index>=list->idl_inum) {
+                _cshllink_seterr(_CSHLLINK_ERR_NULLPIDL);
+                return NULL;
+            }
+            const uint8_t *item = list->idl_blob + list->idl_off[index];
+            if(size!=NULL) {
+                memcpy(size, item, 2);
+                *size -= 2;
+            }
+            return item+2;
+        }
+        /*
+            iterate idl items (cshllink_IDListIter, then cshllink_IDListNext until it returns 0)
+            IN: pointer to IDList; iterator / iterator; data (out); size (out): length in bytes of the data (ItemIDSize - 2)
+            OUT: 1 - next item stored in data and size
+                 0 - end of the list
+        */
+        void cshllink_IDListIter(const struct _cshllink_lnktidl_idl *list, cshllink_idl_iter *it) {
+            it->pos = list->idl_blob;
+            it->end = list->idl_blob + list->idl_bloblen;
+        }
+        uint8_t cshllink_IDListNext(cshllink_idl_iter *it, const uint8_t **data, uint16_t *size) {
+            uint16_t isize;
+            if(it->pos==NULL || it->end-it->pos<2)
+                return 0;
+            memcpy(&isize, it->pos, 2);
+            if(isize<2 || isize>it->end-it->pos)
+                return 0;
+            *data = it->pos+2;
+            *size = isize-2;
+            it->pos += isize;
+            return 1;
+        }
+        /*
+            reserve capacity
+            IN: pointer to IDList; number of items; size in bytes of all items (ItemIDSize included)
             OUT: 0 - Success
                  255 - Error
         */
-        uint8_t cshllink_setIDListItem(struct _cshllink_lnktidl *list, uint8_t *data, uint16_t size, uint8_t index) {
-            if(index>=list->cshllink_lnktidl_idl.idl_inum)
+        uint8_t cshllink_IDListReserve(struct _cshllink_lnktidl_idl *list, uint16_t items, uint32_t bytes) {
+            if(list==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
-            //set new size
-            if(list->cshllink_lnktidl_idl.idl_item[index].item_size>size)
-                list->idl_size-= (list->cshllink_lnktidl_idl.idl_item[index].item_size - size);
-            else if(list->cshllink_lnktidl_idl.idl_item[index].item_size<size)
-                list->idl_size-= (list->cshllink_lnktidl_idl.idl_item[index].item_size - size);
-            
-            if(_cshllink_setIDListItem(&list->cshllink_lnktidl_idl.idl_item[index], data, size))
-                return -1;
+            // borrowed blob (read-only input)
+            if(list->idl_blob!=NULL && list->idl_blobcap==0)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPIDLM);
 
+            if(bytes>list->idl_blobcap) {
+                uint8_t *blob = _cshllink_realloc(list->idl_allocator, list->idl_blob, bytes);
+                if(blob==NULL)
+                    _cshllink_errint(_CSHLLINK_ERR_NULLPIDLM);
+                list->idl_blob = blob;
+                list->idl_blobcap = bytes;
+            }
+            if(items>list->idl_offcap) {
+                uint32_t *off = _cshllink_realloc(list->idl_allocator, list->idl_off, items * sizeof *list->idl_off);
+                if(off==NULL)
+                    _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+                list->idl_off = off;
+                list->idl_offcap = items;
+            }
             return 0;
         }
         /*
-            add idl item
-            IN: pointer to List of IDL items; data for new item; length in bytes of data
+            replace items: removes "remove" items at index, inserts "num" items there (capacity grows geometrically)
+            IN: pointer to IDList; index; number of items to remove; items to insert (must not point into the list); number of items to insert
             OUT: 0 - Success
-                 255 - Error
+                 255 - Error (list unchanged)
         */
-        uint8_t cshllink_addIDListItem(struct _cshllink_lnktidl *list, uint8_t *data, uint16_t size) {
-            //set new size
-            list->idl_size += size + 2;
+        uint8_t cshllink_IDListSplice(struct _cshllink_lnktidl_idl *list, uint16_t index, uint16_t remove, const cshllink_idl_item *items, uint16_t num) {
+            if(list==NULL || (items==NULL && num!=0))
+                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+            size_t len = _cshllink_IDListSpliceSize(list, index, remove, items, num);
+            if(len==SIZE_MAX)
+                _cshllink_errint(_CSHLLINK_ERR_INVIDL);
+            uint16_t inum = list->idl_inum - remove + num;
+
+            //grow (doubling, so n appends cost O(n))
+            if(len>list->idl_blobcap || inum>list->idl_offcap) {
+                size_t bytes = list->idl_blobcap, cnt = list->idl_offcap;
+                if(len>bytes)
+                    bytes = len>bytes*2 ? (len>64 ? len : 64) : bytes*2;
+                if(inum>cnt)
+                    cnt = inum>cnt*2 ? (inum>8 ? inum : 8) : cnt*2;
+                if(bytes>UINT32_MAX)
+                    bytes = len;
+                if(cnt>UINT16_MAX)
+                    cnt = UINT16_MAX;
+                if(cshllink_IDListReserve(list, cnt, bytes))
+                    return -1;
+            }
 
-            if(_cshllink_addIDListItem(&list->cshllink_lnktidl_idl, data, size))
-                return -1;
+            uint32_t start = index<list->idl_inum ? list->idl_off[index] : list->idl_bloblen;
+            uint32_t end = index+remove<list->idl_inum ? list->idl_off[index+remove] : list->idl_bloblen;
+            uint32_t ins = len - (list->idl_bloblen - (end-start));
+
+            //move the following items and their offsets
+            if(list->idl_bloblen>end)
+                memmove(list->idl_blob+start+ins, list->idl_blob+end, list->idl_bloblen-end);
+            if(list->idl_inum>index+remove)
+                memmove(&list->idl_off[index+num], &list->idl_off[index+remove], (list->idl_inum-index-remove) * sizeof *list->idl_off);
+            for(int i=index+num; i<inum; i++)
+                list->idl_off[i] = list->idl_off[i] - end + start + ins;
+
+            //new items
+            uint32_t pos = start;
+            for(int i=0; i<num; i++) {
+                uint16_t isize = items[i].size+2;
+                list->idl_off[index+i] = pos;
+                memcpy(list->idl_blob+pos, &isize, 2);
+                if(items[i].size)
+                    memcpy(list->idl_blob+pos+2, items[i].data, items[i].size);
+                pos += isize;
+            }
 
+            list->idl_bloblen = len;
+            list->idl_inum = inum;
+            list->idl_dirty = 1;
             return 0;
         }
+        uint8_t cshllink_IDListInsert(struct _cshllink_lnktidl_idl *list, uint16_t index, const cshllink_idl_item *items, uint16_t num) {
+            return cshllink_IDListSplice(list, index, 0, items, num);
+        }
+        uint8_t cshllink_IDListAppend(struct _cshllink_lnktidl_idl *list, const cshllink_idl_item *items, uint16_t num) {
+            if(list==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+            return cshllink_IDListSplice(list, list->idl_inum, 0, items, num);
+        }
+        uint8_t cshllink_IDListErase(struct _cshllink_lnktidl_idl *list, uint16_t index, uint16_t num) {
+            return cshllink_IDListSplice(list, index, num, NULL, 0);
+        }
+            /*
+                size in bytes of idl_blob after cshllink_IDListSplice (SIZE_MAX if the arguments are invalid)
+            */
+            size_t _cshllink_IDListSpliceSize(const struct _cshllink_lnktidl_idl *list, uint16_t index, uint16_t remove, const cshllink_idl_item *items, uint16_t num) {
+                if(index>list->idl_inum || remove>list->idl_inum-index || (size_t)list->idl_inum-remove+num>UINT16_MAX)
+                    return SIZE_MAX;
+
+                uint32_t start = index<list->idl_inum ? list->idl_off[index] : list->idl_bloblen;
+                uint32_t end = index+remove<list->idl_inum ? list->idl_off[index+remove] : list->idl_bloblen;
+                size_t len = list->idl_bloblen - (end-start);
+                for(int i=0; i<num; i++) {
+                    if(items[i].size>UINT16_MAX-2 || (items[i].data==NULL && items[i].size!=0))
+                        return SIZE_MAX;
+                    len += items[i].size+2;
+                }
+                if(len>UINT32_MAX)
+                    return SIZE_MAX;
+                return len;
+            }
+
+    //IDList
+        /*
+            set idl item
+            IN: pointer to IDL item; data for item; length in bytes of data;
+            OUT: 0 - Success
+                 255 - Error
+        */
+        uint8_t cshllink_setIDListItem(struct _cshllink_lnktidl *list, uint8_t *data, uint16_t size, uint16_t index) {
+            cshllink_idl_item item = {data, size};
+            if(list==NULL || index>=list->cshllink_lnktidl_idl.idl_inum)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+            return _cshllink_spliceIDList(list, index, 1, &item, 1);
+        }
+        /*
+            add idl item
+            IN: pointer to List of IDL items; data for new item; length in bytes of data
+            OUT: 0 - Success
+                 255 - Error
+        */
+        uint8_t cshllink_addIDListItem(struct _cshllink_lnktidl *list, uint8_t *data, uint16_t size) {
+            cshllink_idl_item item = {data, size};
+            if(list==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+            return _cshllink_spliceIDList(list, list->cshllink_lnktidl_idl.idl_inum, 0, &item, 1);
+        }
         /*
             remove idl item
             IN: pointer to List of IDL items; index to be removed
             OUT: 0 - Success
                  255 - Error
         */
-        uint8_t cshllink_removeIDListItem(struct _cshllink_lnktidl *list, uint8_t index) {
-            if(index>=list->cshllink_lnktidl_idl.idl_inum)
-                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
-            
-            if(index>=list->cshllink_lnktidl_idl.idl_inum)
+        uint8_t cshllink_removeIDListItem(struct _cshllink_lnktidl *list, uint16_t index) {
+            if(list==NULL || index>=list->cshllink_lnktidl_idl.idl_inum)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
-
-            //set new size
-            list->idl_size -= (list->cshllink_lnktidl_idl.idl_item[index].item_size+2);
-
-            if(_cshllink_removeIDListItem(&list->cshllink_lnktidl_idl, index))
-                return -1;
-
-            return 0;
+            return _cshllink_spliceIDList(list, index, 1, NULL, 0);
         }
-
-            //IDList integ. (also for VistaAndAboveIDList -- param idl pointer)
-            /*
-                set idl item
-                IN: pointer to IDL item; data for item; length in bytes of data;
-                OUT: 0 - Success
-                    255 - Error
-            */
-            uint8_t _cshllink_setIDListItem(struct _cshllink_lnktidl_idl_item *item, uint8_t *data, uint16_t size) {
-                
-                item->item_size = size;
-                item->item=realloc(item->item, sizeof *item->item * size);
-                if(item->item==NULL) 
-                    _cshllink_errint(_CSHLLINK_ERR_NULLPIDLM);
-
-                memcpy(item->item, data, size);
-
-                return 0;
-
-            }
             /*
-                add idl item
-                IN: pointer to List of IDL items; data for new item; length in bytes of data
-                OUT: 0 - Success
-                    255 - Error
+                splice the list and update idl_size (the list must stay below 64 KiB)
             */
-            uint8_t _cshllink_addIDListItem(struct _cshllink_lnktidl_idl *list, uint8_t *data, uint16_t size) {
-
-                //realloc mem
-                list->idl_item = realloc(list->idl_item, (size+2)* sizeof *list->idl_item);
-                if(list->idl_item==NULL) 
-                    _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+            uint8_t _cshllink_spliceIDList(struct _cshllink_lnktidl *list, uint16_t index, uint16_t remove, const cshllink_idl_item *items, uint16_t num) {
+                //new size (TerminalBlock included) must fit idl_size
+                size_t len = _cshllink_IDListSpliceSize(&list->cshllink_lnktidl_idl, index, remove, items, num);
+                if(len==SIZE_MAX || len+2>UINT16_MAX)
+                    _cshllink_errint(_CSHLLINK_ERR_INVIDL);
 
-                if(_cshllink_setIDListItem(&list->idl_item[list->idl_inum], data, size))
+                if(cshllink_IDListSplice(&list->cshllink_lnktidl_idl, index, remove, items, num))
                     return -1;
 
-                list->idl_inum+=1;
-
-                return 0;
-            }
-            /*
-                remove idl item
-                IN: pointer to List of IDL items; index to be removed
-                OUT: 0 - Success
-                    255 - Error
-            */
-            uint8_t _cshllink_removeIDListItem(struct _cshllink_lnktidl_idl *list, uint8_t index) {
-                if(index>=list->idl_inum)
-                    _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
-
-                int size = list->idl_item[index].item_size+2;
-                free(list->idl_item[index].item);
-                
-                for(int i=index+1; i<list->idl_inum; i++) {
-                    list->idl_item[i-1] = list->idl_item[i];
-                }
-
-                //realloc mem
-                list->idl_item = realloc(list->idl_item, (size)* sizeof *list->idl_item);
-                if(list->idl_item==NULL) 
-                    _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
-                
-                list->idl_inum-=1;
-
+                //set new size
+                list->idl_size = list->cshllink_lnktidl_idl.idl_bloblen + 2;
                 return 0;
             }
 
@@ -1804,6 +3910,9 @@
             enable VolumeID and LocalBasePath
         */
         uint8_t cshllink_enableVolumeIDAndLocalBasePath(cshllink *inputStruct) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_LINKINFO;
             
             
             if(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath)
@@ -1825,7 +3934,7 @@
             inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset = 0x00000016;
 
             //DATA
-            inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data = realloc(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, 1);
+            inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data = _cshllink_realloc(inputStruct->cshllink_allocator, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, 1);
             if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPVIDD);
             //Data
@@ -1834,7 +3943,7 @@
             inputStruct->cshllink_lnkinfo.LocalBasePathOffset = inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize + inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize;
 
             //LocalBasePath
-            inputStruct->cshllink_lnkinfo.LocalBasePath = realloc(inputStruct->cshllink_lnkinfo.LocalBasePath, 1);
+            inputStruct->cshllink_lnkinfo.LocalBasePath = _cshllink_realloc(inputStruct->cshllink_allocator, inputStruct->cshllink_lnkinfo.LocalBasePath, 1);
             if(inputStruct->cshllink_lnkinfo.LocalBasePath==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPVIDD);
             //LocalBasePath
@@ -1850,12 +3959,15 @@
             disable VolumeID and LocalBasePath
         */
         uint8_t cshllink_disableVolumeIDAndLocalBasePath(cshllink *inputStruct) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_LINKINFO;
             if(!(inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath))
                 return 0;
             
             inputStruct->cshllink_lnkinfo.LinkInfoFlags&=~CSHLLINK_LIF_VolumeIDAndLocalBasePath;
 
-            free(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data);
+            _cshllink_dealloc(inputStruct->cshllink_allocator, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data);
 
             inputStruct->cshllink_lnkinfo.LocalBasePathOffset = 0;
             inputStruct->cshllink_lnkinfo.LinkInfoSize -= inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize + strlen(inputStruct->cshllink_lnkinfo.LocalBasePath) + 1;
@@ -1871,6 +3983,9 @@
             set VolumeIDData
         */  
         uint8_t cshllink_setVolumeIDDataAnsi(cshllink *inputStruct, char *data, uint32_t size) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_LINKINFO;
 
             inputStruct->cshllink_lnkinfo.LinkInfoSize += -inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize + 16 + size;
             inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize= 16 + size;
@@ -1880,7 +3995,7 @@
             }
             inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffset = 0x00000010;
 
-            inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data = realloc(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, sizeof *inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data * size);
+            inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data = _cshllink_realloc(inputStruct->cshllink_allocator, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, sizeof *inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data * size);
             if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPVIDD);
             
@@ -1889,6 +4004,9 @@
             return 0;
         }
         uint8_t cshllink_setVolumeIDDataUnicode(cshllink *inputStruct, char16_t *data, uint32_t size) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_LINKINFO;
 
             inputStruct->cshllink_lnkinfo.LinkInfoSize += -inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize + 20 + size;
             inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeIDSize= 20 + size;
@@ -1898,7 +4016,7 @@
             }
             inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.VolumeLabelOffsetUnicode = 0x00000014;
 
-            inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data = realloc(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, sizeof *inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data * size);
+            inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data = _cshllink_realloc(inputStruct->cshllink_allocator, inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data, sizeof *inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data * size);
             if(inputStruct->cshllink_lnkinfo.cshllink_lnkinfo_volid.Data==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPVIDD);
 
@@ -1910,6 +4028,9 @@
             set LocalBasePath
         */
         uint8_t cshllink_setLocalBasePath(cshllink *inputStruct, char *data) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_LINKINFO;
 
             if(!inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) return -1;
 
@@ -1926,6 +4047,9 @@
             set LocalBasePathUnicode
         */
         uint8_t cshllink_setLocalBasePathUnicode(cshllink *inputStruct, char16_t *data) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_LINKINFO;
             if(!inputStruct->cshllink_lnkinfo.LinkInfoFlags&CSHLLINK_LIF_VolumeIDAndLocalBasePath) return -1;
 
             if(inputStruct->cshllink_lnkinfo.LinkInfoHeaderSize<0x00000024) {
@@ -1985,12 +4109,15 @@
             set NameString
         */
         uint8_t cshllink_setNameString(cshllink *inputStruct, char16_t *data, uint16_t len) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_STRINGDATA;
             inputStruct->cshllink_strdata.NameString.CountCharacters=len;
             if(len==0) {
-                free(inputStruct->cshllink_strdata.NameString.UString);
+                _cshllink_dealloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.NameString.UString);
                 return 0;
             }
-            inputStruct->cshllink_strdata.NameString.UString = realloc(inputStruct->cshllink_strdata.NameString.UString, sizeof *inputStruct->cshllink_strdata.NameString.UString * len);
+            inputStruct->cshllink_strdata.NameString.UString = _cshllink_realloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.NameString.UString, sizeof *inputStruct->cshllink_strdata.NameString.UString * len);
             if(inputStruct->cshllink_strdata.NameString.UString==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPSTRDNAME);
             memcpy(inputStruct->cshllink_strdata.NameString.UString, data, len*sizeof(char16_t));
@@ -2001,12 +4128,15 @@
             set RelativePath
         */
         uint8_t cshllink_setRelativePath(cshllink *inputStruct, char16_t *data, uint16_t len) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_STRINGDATA;
             inputStruct->cshllink_strdata.RelativePath.CountCharacters=len;
             if(len==0) {
-                free(inputStruct->cshllink_strdata.RelativePath.UString);
+                _cshllink_dealloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.RelativePath.UString);
                 return 0;
             }
-            inputStruct->cshllink_strdata.RelativePath.UString = realloc(inputStruct->cshllink_strdata.RelativePath.UString, sizeof *inputStruct->cshllink_strdata.RelativePath.UString * len);
+            inputStruct->cshllink_strdata.RelativePath.UString = _cshllink_realloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.RelativePath.UString, sizeof *inputStruct->cshllink_strdata.RelativePath.UString * len);
             if(inputStruct->cshllink_strdata.RelativePath.UString==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPSTRDNAME);
             memcpy(inputStruct->cshllink_strdata.RelativePath.UString, data, len*sizeof(char16_t));
@@ -2017,12 +4147,15 @@
             set WorkingDir
         */
         uint8_t cshllink_setWorkingDir(cshllink *inputStruct, char16_t *data, uint16_t len) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_STRINGDATA;
             inputStruct->cshllink_strdata.WorkingDir.CountCharacters=len;
             if(len==0) {
-                free(inputStruct->cshllink_strdata.WorkingDir.UString);
+                _cshllink_dealloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.WorkingDir.UString);
                 return 0;
             }
-            inputStruct->cshllink_strdata.WorkingDir.UString = realloc(inputStruct->cshllink_strdata.WorkingDir.UString, sizeof *inputStruct->cshllink_strdata.WorkingDir.UString * len);
+            inputStruct->cshllink_strdata.WorkingDir.UString = _cshllink_realloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.WorkingDir.UString, sizeof *inputStruct->cshllink_strdata.WorkingDir.UString * len);
             if(inputStruct->cshllink_strdata.WorkingDir.UString==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPSTRDNAME);
             memcpy(inputStruct->cshllink_strdata.WorkingDir.UString, data, len*sizeof(char16_t));
@@ -2033,12 +4166,15 @@
             set CommandLineArguments
         */
         uint8_t cshllink_setCommandLineArguments(cshllink *inputStruct, char16_t *data, uint16_t len) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_STRINGDATA;
             inputStruct->cshllink_strdata.CommandLineArguments.CountCharacters=len;
             if(len==0) {
-                free(inputStruct->cshllink_strdata.CommandLineArguments.UString);
+                _cshllink_dealloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.CommandLineArguments.UString);
                 return 0;
             }
-            inputStruct->cshllink_strdata.CommandLineArguments.UString = realloc(inputStruct->cshllink_strdata.CommandLineArguments.UString, sizeof *inputStruct->cshllink_strdata.CommandLineArguments.UString * len);
+            inputStruct->cshllink_strdata.CommandLineArguments.UString = _cshllink_realloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.CommandLineArguments.UString, sizeof *inputStruct->cshllink_strdata.CommandLineArguments.UString * len);
             if(inputStruct->cshllink_strdata.CommandLineArguments.UString==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPSTRDNAME);
             memcpy(inputStruct->cshllink_strdata.CommandLineArguments.UString, data, len*sizeof(char16_t));
@@ -2049,14 +4185,17 @@
             set IconLocation
         */
         uint8_t cshllink_setIconLocation(cshllink *inputStruct, char16_t *data, uint16_t len) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_STRINGDATA;
             
 
             inputStruct->cshllink_strdata.IconLocation.CountCharacters=len;
             if(len==0) {
-                free(inputStruct->cshllink_strdata.IconLocation.UString);
+                _cshllink_dealloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.IconLocation.UString);
                 return 0;
             }
-            inputStruct->cshllink_strdata.IconLocation.UString = realloc(inputStruct->cshllink_strdata.IconLocation.UString, sizeof *inputStruct->cshllink_strdata.IconLocation.UString * len);
+            inputStruct->cshllink_strdata.IconLocation.UString = _cshllink_realloc(inputStruct->cshllink_allocator, inputStruct->cshllink_strdata.IconLocation.UString, sizeof *inputStruct->cshllink_strdata.IconLocation.UString * len);
             if(inputStruct->cshllink_strdata.IconLocation.UString==NULL)
                 _cshllink_errint(_CSHLLINK_ERR_NULLPSTRDNAME);
             memcpy(inputStruct->cshllink_strdata.IconLocation.UString, data, len*sizeof(char16_t));
@@ -2133,6 +4272,25 @@
             return 0;
         }
         
+        /*
+            fixed-size ExtraDataBlock field (re)allocated to "size" bytes, NULL on failure (the field is left unchanged)
+        */
+        void *_cshllink_reallocField(const cshllink_allocator *allocator, void **field, size_t size) {
+            void *ptr = _cshllink_realloc(allocator, *field, size);
+            if(ptr!=NULL)
+                *field = ptr;
+            return ptr;
+        }
+        /*
+            copies "len" units of "width" bytes from src into the fixed buffer dest of "count" units (truncated to keep the NULL terminator) and clears the rest
+        */
+        void _cshllink_setPadded(void *dest, const void *src, size_t len, size_t width, size_t count) {
+            if(len>count-1)
+                len = count-1;
+            memcpy(dest, src, len*width);
+            memset((uint8_t *)dest+len*width, 0, (count-len)*width);
+        }
+
         //ConsoleDB
         /*
             set FontFaceName (32 char)
@@ -2146,14 +4304,14 @@
             set DarwinDataAnsi (260 byte)
         */
         uint8_t cshllink_setDarwinDataAnsi(cshllink *inputStruct, char *data) {
-            
-            size_t len = strlen(data);
-            inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi = realloc(inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi, 260);
-            if(inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi==NULL)
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_EXTRADATA;
+
+            char *dest = _cshllink_fixedBuf(inputStruct, inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi, 260);
+            if(dest==NULL)
                 _cshllink_errint(_CSHLLINK_ERRX_NULLPSTRDARDA);
-            memcpy(inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi, data, len);
-            len--;
-            while(len++<259) inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataAnsi[len]=0;
+            _cshllink_setPadded(dest, data, strlen(data), 1, 260);
 
             return 0;
         }
@@ -2161,14 +4319,14 @@
             set DarwinDataUnicode (520 byte)
         */
         uint8_t cshllink_setDarwinDataUnicode(cshllink *inputStruct, char16_t *data) {
-            
-            size_t len = cshllink_strlen16(data);
-            inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode = realloc(inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode, 520);
-            if(inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode==NULL)
-                _cshllink_errint(_CSHLLINK_ERRX_NULLPSTRIENVDU);
-            memcpy(inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode, data, len*2);
-            len--;
-            while(len++<259) inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode[len]=0;
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_EXTRADATA;
+
+            char16_t *dest = _cshllink_fixedBuf(inputStruct, inputStruct->cshllink_extdatablk.DarwinDataBlock.DarwinDataUnicode, 520);
+            if(dest==NULL)
+                _cshllink_errint(_CSHLLINK_ERRX_NULLPSTRDARDU);
+            _cshllink_setPadded(dest, data, cshllink_strlen16(data), sizeof(char16_t), 260);
 
             return 0;
         }
@@ -2178,14 +4336,14 @@
             set TargetAnsi (260 byte)
         */
         uint8_t cshllink_setEnvironmentVariableTargetAnsi(cshllink *inputStruct, char *data) {
-            
-            size_t len = strlen(data);
-            inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi = realloc(inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi, 260);
-            if(inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi==NULL)
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_EXTRADATA;
+
+            char *dest = _cshllink_fixedBuf(inputStruct, inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi, 260);
+            if(dest==NULL)
                 _cshllink_errint(_CSHLLINK_ERRX_NULLPSTRENVDA);
-            memcpy(inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi, data, len);
-            len--;
-            while(len++<259) inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetAnsi[len]=0;
+            _cshllink_setPadded(dest, data, strlen(data), 1, 260);
 
             return 0;
         }
@@ -2193,14 +4351,14 @@
             set TargetUnicode (520 byte)
         */
         uint8_t cshllink_setEnvironmentVariableTargetUnicode(cshllink *inputStruct, char16_t *data) {
-            
-            size_t len = cshllink_strlen16(data);
-            inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode = realloc(inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode, 520);
-            if(inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode==NULL)
-                _cshllink_errint(_CSHLLINK_ERRX_NULLPSTRIENVDU);
-            memcpy(inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode, data, len*2);
-            len--;
-            while(len++<259) inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode[len]=0;
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_EXTRADATA;
+
+            char16_t *dest = _cshllink_fixedBuf(inputStruct, inputStruct->cshllink_extdatablk.EnvironmentVariableDataBlock.TargetUnicode, 520);
+            if(dest==NULL)
+                _cshllink_errint(_CSHLLINK_ERRX_NULLPSTRENVDU);
+            _cshllink_setPadded(dest, data, cshllink_strlen16(data), sizeof(char16_t), 260);
 
             return 0;
         }
@@ -2210,14 +4368,14 @@
             set TargetAnsi (260 byte)
         */
         uint8_t cshllink_setIconEnvironmentTargetAnsi(cshllink *inputStruct, char *data) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_EXTRADATA;
 
-            size_t len = strlen(data);
-            inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi = realloc(inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi, 260);
-            if(inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi==NULL)
+            char *dest = _cshllink_fixedBuf(inputStruct, inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi, 260);
+            if(dest==NULL)
                 _cshllink_errint(_CSHLLINK_ERRX_NULLPSTRIENVDA);
-            memcpy(inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi, data, len);
-            len--;
-            while(len++<259) inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetAnsi[len]=0;
+            _cshllink_setPadded(dest, data, strlen(data), 1, 260);
 
             return 0;
         }
@@ -2225,14 +4383,14 @@
             set TargetUnicode (520 byte)
         */
         uint8_t cshllink_setIconEnvironmentTargetUnicode(cshllink *inputStruct, char16_t *data) {
+            if(inputStruct->cshllink_borrowed && cshllink_detach(inputStruct))
+                return -1;
+            inputStruct->cshllink_dirty |= CSHLLINK_SEC_EXTRADATA;
 
-            size_t len = cshllink_strlen16(data);
-            inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode = realloc(inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode, 520);
-            if(inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode==NULL)
+            char16_t *dest = _cshllink_fixedBuf(inputStruct, inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode, 520);
+            if(dest==NULL)
                 _cshllink_errint(_CSHLLINK_ERRX_NULLPSTRIENVDU);
-            memcpy(inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode, data, len*2);
-            len--;
-            while(len++<259) inputStruct->cshllink_extdatablk.IconEnvironmentDataBlock.TargetUnicode[len]=0;
+            _cshllink_setPadded(dest, data, cshllink_strlen16(data), sizeof(char16_t), 260);
 
             return 0;
         }
@@ -2288,8 +4446,11 @@
             OUT: 0 - Success
                  255 - Error
         */
-        uint8_t cshllink_setVistaAndAboveIDListItem(struct _cshllink_extdatablk_viidldblk *viaail, uint8_t *data, uint16_t size, uint8_t index) {
-            return 0;
+        uint8_t cshllink_setVistaAndAboveIDListItem(struct _cshllink_extdatablk_viidldblk *viaail, uint8_t *data, uint16_t size, uint16_t index) {
+            cshllink_idl_item item = {data, size};
+            if(viaail==NULL || index>=viaail->cshllink_lnktidl_idl.idl_inum)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+            return _cshllink_spliceVistaAndAboveIDList(viaail, index, 1, &item, 1);
         }
         /*
             add idl item
@@ -2298,7 +4459,10 @@
                  255 - Error
         */
         uint8_t cshllink_addVistaAndAboveIDListItem(struct _cshllink_extdatablk_viidldblk *viaail, uint8_t *data, uint16_t size) {
-            return 0;
+            cshllink_idl_item item = {data, size};
+            if(viaail==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+            return _cshllink_spliceVistaAndAboveIDList(viaail, viaail->cshllink_lnktidl_idl.idl_inum, 0, &item, 1);
         }
         /*
             remove idl item
@@ -2306,9 +4470,27 @@
             OUT: 0 - Success
                  255 - Error
         */
-        uint8_t cshllink_removeVistaAndAboveIDListItem(struct _cshllink_extdatablk_viidldblk *viaail, uint8_t index) {
-            return 0;
+        uint8_t cshllink_removeVistaAndAboveIDListItem(struct _cshllink_extdatablk_viidldblk *viaail, uint16_t index) {
+            if(viaail==NULL || index>=viaail->cshllink_lnktidl_idl.idl_inum)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPIDL);
+            return _cshllink_spliceVistaAndAboveIDList(viaail, index, 1, NULL, 0);
         }
+            /*
+                splice the list and update BlockSize
+            */
+            uint8_t _cshllink_spliceVistaAndAboveIDList(struct _cshllink_extdatablk_viidldblk *viaail, uint16_t index, uint16_t remove, const cshllink_idl_item *items, uint16_t num) {
+                //new size (BlockSize, BlockSignature and TerminalBlock included) must fit BlockSize
+                size_t len = _cshllink_IDListSpliceSize(&viaail->cshllink_lnktidl_idl, index, remove, items, num);
+                if(len==SIZE_MAX || len>UINT32_MAX-_CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSiz)
+                    _cshllink_errint(_CSHLLINK_ERR_INVIDL);
+
+                if(cshllink_IDListSplice(&viaail->cshllink_lnktidl_idl, index, remove, items, num))
+                    return -1;
+
+                //set new size
+                viaail->info.BlockSize = viaail->cshllink_lnktidl_idl.idl_bloblen + _CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSiz;
+                return 0;
+            }
 
     /*
         converts ansi to unicode
@@ -2329,14 +4511,1518 @@
         strlen char16
     */
     size_t cshllink_strlen16(char16_t *src) {
-        size_t size=0;
+        #ifdef _CSHLLINK_SIMD_X86
+            int level = _cshllink_simdLevel();
+            if(level==2)
+                return _cshllink_strlen16AVX2(src);
+            if(level==1)
+                return _cshllink_strlen16SSE2(src);
+        #endif
+        return _cshllink_strlen16Scalar(src);
+    }
 
-        while(*src!=0) {
-            src++;
+    /*
+        string kernels (scalar, SSE2, AVX2)
+    */
+    size_t _cshllink_scan16(const uint8_t *data, size_t size) {
+        #ifdef _CSHLLINK_SIMD_X86
+            int level = _cshllink_simdLevel();
+            if(level==2)
+                return _cshllink_scan16AVX2(data, size);
+            if(level==1)
+                return _cshllink_scan16SSE2(data, size);
+        #endif
+        return _cshllink_scan16Scalar(data, size);
+    }
+    size_t _cshllink_scan16Scalar(const uint8_t *data, size_t size) {
+        size_t i=0;
+        while(i+1<size && (data[i]|data[i+1])!=0)
+            i+=2;
+        return i+1<size ? i : size&~(size_t)1;
+    }
+    size_t _cshllink_strlen16Scalar(const char16_t *src) {
+        // byte access: src may be misaligned
+        const uint8_t *p = (const uint8_t *)src;
+        size_t size=0;
+        while((p[2*size]|p[2*size+1])!=0)
             size++;
+        return size;
+    }
+
+    #ifdef _CSHLLINK_SIMD_X86
+        int _cshllink_simdLevel(void) {
+            if(__builtin_cpu_supports("avx2"))
+                return 2;
+            if(__builtin_cpu_supports("sse2"))
+                return 1;
+            return 0;
         }
 
-        return size;
+        // bounded scans: unaligned loads within data, scalar tail
+        __attribute__((target("sse2")))
+        size_t _cshllink_scan16SSE2(const uint8_t *data, size_t size) {
+            const __m128i zero = _mm_setzero_si128();
+            size_t i=0;
+            for(; i+16<=size; i+=16) {
+                uint32_t m = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(data+i)), zero));
+                if(m)
+                    return i + __builtin_ctz(m);
+            }
+            return i + _cshllink_scan16Scalar(data+i, size-i);
+        }
+        __attribute__((target("avx2")))
+        size_t _cshllink_scan16AVX2(const uint8_t *data, size_t size) {
+            const __m256i zero = _mm256_setzero_si256();
+            size_t i=0;
+            for(; i+32<=size; i+=32) {
+                uint32_t m = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i *)(data+i)), zero));
+                if(m)
+                    return i + __builtin_ctz(m);
+            }
+            return i + _cshllink_scan16Scalar(data+i, size-i);
+        }
+
+        /*
+            unbounded scans: aligned blocks (never cross a page past the terminator), NUL bytes are paired at the parity of src
+            so misaligned strings work too. carry: the low byte of a character at the last byte of the previous block is 0
+            the aligned block may start before src, which AddressSanitizer would report
+        */
+        __attribute__((target("sse2"), no_sanitize_address))
+        size_t _cshllink_strlen16SSE2(const char16_t *src) {
+            const __m128i zero = _mm_setzero_si128();
+            const uint8_t *p = (const uint8_t *)src;
+            const uint8_t *blk = (const uint8_t *)((uintptr_t)p & ~(uintptr_t)15);
+            uint32_t sel = ((uintptr_t)p&1) ? 0xAAAA : 0x5555;
+            uint32_t keep = 0xFFFFu << (p-blk), carry = 0;
+            for(;; blk+=16, keep=0xFFFF) {
+                uint32_t m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)blk), zero)) & keep;
+                if(carry && (m&1))
+                    return (blk-1-p)/2;
+                uint32_t z = m & (m>>1) & sel;
+                if(z)
+                    return (blk+__builtin_ctz(z)-p)/2;
+                carry = m & sel & 0x8000;
+            }
+        }
+        __attribute__((target("avx2"), no_sanitize_address))
+        size_t _cshllink_strlen16AVX2(const char16_t *src) {
+            const __m256i zero = _mm256_setzero_si256();
+            const uint8_t *p = (const uint8_t *)src;
+            const uint8_t *blk = (const uint8_t *)((uintptr_t)p & ~(uintptr_t)31);
+            uint32_t sel = ((uintptr_t)p&1) ? 0xAAAAAAAA : 0x55555555;
+            uint32_t keep = 0xFFFFFFFFu << (p-blk), carry = 0;
+            for(;; blk+=32, keep=0xFFFFFFFF) {
+                uint32_t m = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)blk), zero)) & keep;
+                if(carry && (m&1))
+                    return (blk-1-p)/2;
+                uint32_t z = m & (m>>1) & sel;
+                if(z)
+                    return (blk+__builtin_ctz(z)-p)/2;
+                carry = m & sel & 0x80000000u;
+            }
+        }
+    #endif
+
+    /*
+        -> UTF-16LE string (may be misaligned) and its length in characters
+        -> output buffer and its size in bytes (NULL: only computes the length)
+        -> optional pointer receiving the length in bytes of the UTF-8 string, without the terminator (may be NULL)
+        -- transcodes src to a NUL terminated UTF-8 string, surrogates must form valid pairs. ASCII runs are converted 8 (SSE2) or 16 (AVX2) characters at a time
+        <- on error this function will return -1 (0x30: invalid UTF-16, 0x31: dest too small), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_utf16ToUtf8(const char16_t *src, size_t len, char *dest, size_t size, size_t *written) {
+        #ifdef _CSHLLINK_SIMD_X86
+            return _cshllink_utf16ToUtf8Level(src, len, dest, size, written, _cshllink_simdLevel());
+        #else
+            return _cshllink_utf16ToUtf8Level(src, len, dest, size, written, 0);
+        #endif
+    }
+    uint8_t _cshllink_utf16ToUtf8Level(const char16_t *src, size_t len, char *dest, size_t size, size_t *written, int level) {
+        if(src==NULL && len!=0)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        const uint8_t *p = (const uint8_t *)src;
+        size_t i=0, o=0;
+
+        while(i<len) {
+            #ifdef _CSHLLINK_SIMD_X86
+                if(level>0) {
+                    size_t n = level==2 ? _cshllink_asciiAVX2(p+2*i, len-i, dest!=NULL ? dest+o : NULL, dest!=NULL ? size-o : SIZE_MAX)
+                                        : _cshllink_asciiSSE2(p+2*i, len-i, dest!=NULL ? dest+o : NULL, dest!=NULL ? size-o : SIZE_MAX);
+                    i += n;
+                    o += n;
+                }
+            #endif
+            // ASCII inline up to the next other character, which goes through _cshllink_utf8Char (then back to the vector kernel)
+            while(i<len && p[2*i+1]==0 && p[2*i]<0x80 && (dest==NULL || o<size)) {
+                if(dest!=NULL)
+                    dest[o] = p[2*i];
+                i++;
+                o++;
+            }
+            if(i<len) {
+                uint8_t err = _cshllink_utf8Char(p, len, &i, dest, size, &o);
+                if(err)
+                    _cshllink_errint(err);
+            }
+        }
+
+        //terminator
+        if(dest!=NULL) {
+            if(o>=size)
+                _cshllink_errint(_CSHLLINK_ERR_BUFSIZE);
+            dest[o] = 0;
+        }
+        if(written!=NULL)
+            *written = o;
+        return 0;
+    }
+        /*
+            transcodes the character at src[*i] (a surrogate pair takes two), advances *i and *o (dest NULL: counts only)
+            <- 0, _CSHLLINK_ERR_UTF16 or _CSHLLINK_ERR_BUFSIZE
+        */
+        uint8_t _cshllink_utf8Char(const uint8_t *src, size_t len, size_t *i, char *dest, size_t size, size_t *o) {
+            uint32_t c = src[2**i] | src[2**i+1]<<8;
+            size_t n = 1;
+            if(c>=0xD800 && c<=0xDFFF) {
+                // high surrogate followed by a low surrogate
+                if(c>=0xDC00 || *i+1>=len)
+                    return _CSHLLINK_ERR_UTF16;
+                uint32_t low = src[2**i+2] | src[2**i+3]<<8;
+                if(low<0xDC00 || low>0xDFFF)
+                    return _CSHLLINK_ERR_UTF16;
+                c = 0x10000 + ((c-0xD800)<<10) + (low-0xDC00);
+                n = 2;
+            }
+            size_t bytes = c<0x80 ? 1 : c<0x800 ? 2 : c<0x10000 ? 3 : 4;
+
+            if(dest!=NULL) {
+                if(size-*o<bytes)
+                    return _CSHLLINK_ERR_BUFSIZE;
+                uint8_t *d = (uint8_t *)dest+*o;
+                switch(bytes) {
+                    case 1:
+                        d[0] = c;
+                        break;
+                    case 2:
+                        d[0] = 0xC0 | c>>6;
+                        d[1] = 0x80 | (c&0x3F);
+                        break;
+                    case 3:
+                        d[0] = 0xE0 | c>>12;
+                        d[1] = 0x80 | (c>>6&0x3F);
+                        d[2] = 0x80 | (c&0x3F);
+                        break;
+                    default:
+                        d[0] = 0xF0 | c>>18;
+                        d[1] = 0x80 | (c>>12&0x3F);
+                        d[2] = 0x80 | (c>>6&0x3F);
+                        d[3] = 0x80 | (c&0x3F);
+                }
+            }
+            *i += n;
+            *o += bytes;
+            return 0;
+        }
+
+    #ifdef _CSHLLINK_SIMD_X86
+        /*
+            converts the leading all-ASCII blocks of src (8 / 16 characters) into dest (NULL: counts only, room: bytes available)
+            <- number of characters converted
+        */
+        __attribute__((target("sse2")))
+        size_t _cshllink_asciiSSE2(const uint8_t *src, size_t len, char *dest, size_t room) {
+            const __m128i high = _mm_set1_epi16((short)0xFF80), zero = _mm_setzero_si128();
+            size_t i=0;
+            for(; i+8<=len && i+8<=room; i+=8) {
+                __m128i v = _mm_loadu_si128((const __m128i *)(src+2*i));
+                if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, high), zero))!=0xFFFF)
+                    break;
+                if(dest!=NULL)
+                    _mm_storel_epi64((__m128i *)(dest+i), _mm_packus_epi16(v, v));
+            }
+            return i;
+        }
+        __attribute__((target("avx2")))
+        size_t _cshllink_asciiAVX2(const uint8_t *src, size_t len, char *dest, size_t room) {
+            const __m256i high = _mm256_set1_epi16((short)0xFF80);
+            size_t i=0;
+            for(; i+16<=len && i+16<=room; i+=16) {
+                __m256i v = _mm256_loadu_si256((const __m256i *)(src+2*i));
+                if(!_mm256_testz_si256(v, high))
+                    break;
+                // packus works per 128-bit lane: gather both low halves
+                if(dest!=NULL)
+                    _mm_storeu_si128((__m128i *)(dest+i), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(v, v), 0xD8)));
+            }
+            // half block
+            if(i+8<=len && i+8<=room) {
+                __m128i v = _mm_loadu_si128((const __m128i *)(src+2*i));
+                if(_mm_testz_si128(v, _mm256_castsi256_si128(high))) {
+                    if(dest!=NULL)
+                        _mm_storel_epi64((__m128i *)(dest+i), _mm_packus_epi16(v, v));
+                    i+=8;
+                }
+            }
+            return i;
+        }
+    #endif
+
+    /*
+        -> cshllink structure pointer
+        -> output structure (pointers to the UTF-8 strings)
+        -> optional buffer for all strings and its size in bytes (NULL: one buffer is allocated with the allocator of inputStruct, release it with cshllink_freeUtf8)
+        -> optional pointer receiving the number of bytes needed for all strings (may be NULL)
+        -- transcodes every Unicode field (StringData, LocalBasePathUnicode, CommonPathSuffixUnicode, ExtraData strings) to a NUL terminated UTF-8 string,
+           the ANSI fields are decoded with the code page of the link (cshllink_codePage, default CSHLLINK_CP_DEFAULT)
+        <- on error this function will return -1 (0x31: buf too small, see needed), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_toUtf8(const cshllink *inputStruct, cshllink_utf8 *out, char *buf, size_t size, size_t *needed) {
+        return cshllink_toUtf8CodePage(inputStruct, cshllink_codePage(inputStruct, CSHLLINK_CP_DEFAULT), out, buf, size, needed);
+    }
+    /*
+        cshllink_toUtf8 with the code page of the ANSI fields given by the caller (0: CSHLLINK_CP_DEFAULT)
+        <- on error this function will return -1 (0x31: buf too small, see needed, 0x32: unsupported code page), on success 0
+    */
+    uint8_t cshllink_toUtf8CodePage(const cshllink *inputStruct, uint32_t codePage, cshllink_utf8 *out, char *buf, size_t size, size_t *needed) {
+        if(inputStruct==NULL || out==NULL)
+            _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+        memset(out, 0, sizeof *out);
+        struct _cshllink_strfield fields[_CSHLLINK_UTF8_NUM];
+        int n = _cshllink_strFields(inputStruct, out, fields);
+
+        // sizes (validates all fields before anything is written)
+        size_t total = 0, len;
+        for(int i=0; i<n; i++) {
+            if(fields[i].ansi ? cshllink_ansiToUtf8(fields[i].src, fields[i].len, codePage, NULL, 0, &len)
+                              : cshllink_utf16ToUtf8(fields[i].src, fields[i].len, NULL, 0, &len))
+                return -1;
+            total += len+1;
+        }
+        if(needed!=NULL)
+            *needed = total;
+
+        if(buf==NULL) {
+            out->allocator = inputStruct->cshllink_allocator;
+            buf = out->buffer = _cshllink_alloc(out->allocator, total ? total : 1);
+            if(buf==NULL)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+            size = total;
+        }
+        else if(size<total)
+            _cshllink_errint(_CSHLLINK_ERR_BUFSIZE);
+
+        size_t pos = 0;
+        for(int i=0; i<n; i++) {
+            *fields[i].dest = buf+pos;
+            if(fields[i].ansi ? cshllink_ansiToUtf8(fields[i].src, fields[i].len, codePage, buf+pos, size-pos, &len)
+                              : cshllink_utf16ToUtf8(fields[i].src, fields[i].len, buf+pos, size-pos, &len))
+                return -1;
+            pos += len+1;
+        }
+        return 0;
+    }
+    /*
+        -> output structure of cshllink_toUtf8
+        -- releases the buffer allocated by cshllink_toUtf8 and clears out
+    */
+    void cshllink_freeUtf8(cshllink_utf8 *out) {
+        if(out==NULL)
+            return;
+        _cshllink_dealloc(out->allocator, out->buffer);
+        memset(out, 0, sizeof *out);
+    }
+        /*
+            string fields of inputStruct and their length in characters, dest: field of out, ansi: src is in the code page of the link
+        */
+        int _cshllink_strFields(const cshllink *inputStruct, cshllink_utf8 *out, struct _cshllink_strfield *fields) {
+            const struct _cshllink_strdata *sd = &inputStruct->cshllink_strdata;
+            const struct _cshllink_lnkinfo *li = &inputStruct->cshllink_lnkinfo;
+            const struct _cshllink_extdatablk *ed = &inputStruct->cshllink_extdatablk;
+            const struct _cshllink_lnkinfo_volid *vi = &li->cshllink_lnkinfo_volid;
+            int n = 0;
+
+            // counted (StringData), NULL terminated and NULL terminated within a fixed size (ExtraData)
+            #define _cshllink_u16(field, length, out) if((field)!=NULL) fields[n++] = (struct _cshllink_strfield){(field), (length), &(out), 0}
+            #define _cshllink_u16fixed(field, chars, out) { \
+                const char16_t *str = (field); \
+                _cshllink_u16(str, _cshllink_scan16((const uint8_t *)str, (chars)*sizeof(char16_t))/sizeof(char16_t), out); \
+            }
+            #define _cshllink_ansi(field, length, out) if((field)!=NULL) fields[n++] = (struct _cshllink_strfield){(field), (length), &(out), 1}
+            #define _cshllink_ansifixed(field, bytes, out) { \
+                const char *str = (field); \
+                const char *end = str!=NULL ? memchr(str, 0, (bytes)) : NULL; \
+                _cshllink_ansi(str, end!=NULL ? (size_t)(end-str) : (size_t)(bytes), out); \
+            }
+        #ifdef CSHLLINK_INLINE_EXTRADATA
+            // inline fields are always there, NULL if the block is not present
+            #define _cshllink_inline(block, field) ((block).info.BlockSignature!=0 ? (block).field : NULL)
+        #else
+            #define _cshllink_inline(block, field) ((block).field)
+        #endif
+
+            _cshllink_u16(sd->NameString.UString, sd->NameString.CountCharacters, out->NameString);
+            _cshllink_u16(sd->RelativePath.UString, sd->RelativePath.CountCharacters, out->RelativePath);
+            _cshllink_u16(sd->WorkingDir.UString, sd->WorkingDir.CountCharacters, out->WorkingDir);
+            _cshllink_u16(sd->CommandLineArguments.UString, sd->CommandLineArguments.CountCharacters, out->CommandLineArguments);
+            _cshllink_u16(sd->IconLocation.UString, sd->IconLocation.CountCharacters, out->IconLocation);
+            _cshllink_u16(li->LocalBasePathUnicode, cshllink_strlen16(li->LocalBasePathUnicode), out->LocalBasePathUnicode);
+            _cshllink_u16(li->CommonPathSuffixUnicode, cshllink_strlen16(li->CommonPathSuffixUnicode), out->CommonPathSuffixUnicode);
+            _cshllink_u16fixed(_cshllink_inline(ed->ConsoleDataBlock, FaceName), 32, out->FaceName);
+            _cshllink_u16fixed(_cshllink_inline(ed->DarwinDataBlock, DarwinDataUnicode), 260, out->DarwinDataUnicode);
+            _cshllink_u16fixed(_cshllink_inline(ed->EnvironmentVariableDataBlock, TargetUnicode), 260, out->EnvironmentVariableTargetUnicode);
+            _cshllink_u16fixed(_cshllink_inline(ed->IconEnvironmentDataBlock, TargetUnicode), 260, out->IconEnvironmentTargetUnicode);
+            _cshllink_u16fixed(ed->ShimDataBlock.LayerName, ed->ShimDataBlock.info.BlockSize>8 ? (ed->ShimDataBlock.info.BlockSize-8)/2 : 0, out->LayerName);
+
+            _cshllink_ansi(li->LocalBasePath, strlen(li->LocalBasePath), out->LocalBasePath);
+            _cshllink_ansi(li->CommonPathSuffix, strlen(li->CommonPathSuffix), out->CommonPathSuffix);
+            // ANSI label in Data (VolumeLabelOffset counts from the start of the VolumeID structure, Data from 0x10)
+            if(vi->VolumeLabelOffset!=0x00000014 && vi->VolumeLabelOffset>=0x10 && vi->VolumeLabelOffset<vi->VolumeIDSize) {
+                const char *label = vi->Data!=NULL ? vi->Data+(vi->VolumeLabelOffset-0x10) : NULL;
+                _cshllink_ansifixed(label, vi->VolumeIDSize-vi->VolumeLabelOffset, out->VolumeLabel);
+            }
+            _cshllink_ansi(li->cshllink_lnkinfo_cnetrlnk.NetName, strlen(li->cshllink_lnkinfo_cnetrlnk.NetName), out->NetName);
+            _cshllink_ansi(li->cshllink_lnkinfo_cnetrlnk.DeviceName, strlen(li->cshllink_lnkinfo_cnetrlnk.DeviceName), out->DeviceName);
+            _cshllink_ansifixed(_cshllink_inline(ed->DarwinDataBlock, DarwinDataAnsi), 260, out->DarwinDataAnsi);
+            _cshllink_ansifixed(_cshllink_inline(ed->EnvironmentVariableDataBlock, TargetAnsi), 260, out->EnvironmentVariableTargetAnsi);
+            _cshllink_ansifixed(_cshllink_inline(ed->IconEnvironmentDataBlock, TargetAnsi), 260, out->IconEnvironmentTargetAnsi);
+
+            #undef _cshllink_inline
+            #undef _cshllink_ansifixed
+            #undef _cshllink_ansi
+            #undef _cshllink_u16fixed
+            #undef _cshllink_u16
+            return n;
+        }
+
+    #pragma endregion
+
+    #pragma region codepage
+
+    /*
+        code page tables (generated from the Microsoft mappings published by the Unicode Consortium, bytes not defined in the code page map to U+FFFD)
+        - single-byte code pages: UTF-16 code unit of the bytes 0x80-0xFF
+        - 932: one row of trail bytes 0x40-0xFC per lead byte (_cshllink_cp932lead: row + 1, 0: single byte), the user-defined lead bytes 0xF0-0xF9 map linearly to U+E000
+    */
+    // 437 (OEM United States)
+    static const uint16_t _cshllink_cp437[128] = {
+        0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+        0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+        0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+        0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+        0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+        0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+        0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+        0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
+    };
+    // 850 (OEM Multilingual Latin 1)
+    static const uint16_t _cshllink_cp850[128] = {
+        0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+        0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x0192,
+        0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+        0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0, 0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510,
+        0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4,
+        0x00F0, 0x00D0, 0x00CA, 0x00CB, 0x00C8, 0x0131, 0x00CD, 0x00CE, 0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580,
+        0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE, 0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4,
+        0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0
+    };
+    // 852 (OEM Latin 2)
+    static const uint16_t _cshllink_cp852[128] = {
+        0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x016F, 0x0107, 0x00E7, 0x0142, 0x00EB, 0x0150, 0x0151, 0x00EE, 0x0179, 0x00C4, 0x0106,
+        0x00C9, 0x0139, 0x013A, 0x00F4, 0x00F6, 0x013D, 0x013E, 0x015A, 0x015B, 0x00D6, 0x00DC, 0x0164, 0x0165, 0x0141, 0x00D7, 0x010D,
+        0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x0104, 0x0105, 0x017D, 0x017E, 0x0118, 0x0119, 0x00AC, 0x017A, 0x010C, 0x015F, 0x00AB, 0x00BB,
+        0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x011A, 0x015E, 0x2563, 0x2551, 0x2557, 0x255D, 0x017B, 0x017C, 0x2510,
+        0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x0102, 0x0103, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4,
+        0x0111, 0x0110, 0x010E, 0x00CB, 0x010F, 0x0147, 0x00CD, 0x00CE, 0x011B, 0x2518, 0x250C, 0x2588, 0x2584, 0x0162, 0x016E, 0x2580,
+        0x00D3, 0x00DF, 0x00D4, 0x0143, 0x0144, 0x0148, 0x0160, 0x0161, 0x0154, 0x00DA, 0x0155, 0x0170, 0x00FD, 0x00DD, 0x0163, 0x00B4,
+        0x00AD, 0x02DD, 0x02DB, 0x02C7, 0x02D8, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x02D9, 0x0171, 0x0158, 0x0159, 0x25A0, 0x00A0
+    };
+    // 866 (OEM Russian)
+    static const uint16_t _cshllink_cp866[128] = {
+        0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+        0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+        0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+        0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+        0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+        0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+        0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+        0x0401, 0x0451, 0x0404, 0x0454, 0x0407, 0x0457, 0x040E, 0x045E, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x2116, 0x00A4, 0x25A0, 0x00A0
+    };
+    // 874 (Thai)
+    static const uint16_t _cshllink_cp874[128] = {
+        0x20AC, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x2026, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        0x00A0, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F,
+        0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F,
+        0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F,
+        0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37, 0x0E38, 0x0E39, 0x0E3A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x0E3F,
+        0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F,
+        0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57, 0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD
+    };
+    // 1250 (Central European)
+    static const uint16_t _cshllink_cp1250[128] = {
+        0x20AC, 0xFFFD, 0x201A, 0xFFFD, 0x201E, 0x2026, 0x2020, 0x2021, 0xFFFD, 0x2030, 0x0160, 0x2039, 0x015A, 0x0164, 0x017D, 0x0179,
+        0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0x2122, 0x0161, 0x203A, 0x015B, 0x0165, 0x017E, 0x017A,
+        0x00A0, 0x02C7, 0x02D8, 0x0141, 0x00A4, 0x0104, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x015E, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x017B,
+        0x00B0, 0x00B1, 0x02DB, 0x0142, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x0105, 0x015F, 0x00BB, 0x013D, 0x02DD, 0x013E, 0x017C,
+        0x0154, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0139, 0x0106, 0x00C7, 0x010C, 0x00C9, 0x0118, 0x00CB, 0x011A, 0x00CD, 0x00CE, 0x010E,
+        0x0110, 0x0143, 0x0147, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x00D7, 0x0158, 0x016E, 0x00DA, 0x0170, 0x00DC, 0x00DD, 0x0162, 0x00DF,
+        0x0155, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x013A, 0x0107, 0x00E7, 0x010D, 0x00E9, 0x0119, 0x00EB, 0x011B, 0x00ED, 0x00EE, 0x010F,
+        0x0111, 0x0144, 0x0148, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x00F7, 0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9
+    };
+    // 1251 (Cyrillic)
+    static const uint16_t _cshllink_cp1251[128] = {
+        0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021, 0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+        0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+        0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7, 0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+        0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7, 0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+        0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+        0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+        0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+        0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F
+    };
+    // 1252 (Western European)
+    static const uint16_t _cshllink_cp1252[128] = {
+        0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0xFFFD, 0x017D, 0xFFFD,
+        0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0xFFFD, 0x017E, 0x0178,
+        0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+        0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+        0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+        0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+        0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+        0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
+    };
+    // 1253 (Greek)
+    static const uint16_t _cshllink_cp1253[128] = {
+        0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0xFFFD, 0x2030, 0xFFFD, 0x2039, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0x2122, 0xFFFD, 0x203A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        0x00A0, 0x0385, 0x0386, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0xFFFD, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x2015,
+        0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x0384, 0x00B5, 0x00B6, 0x00B7, 0x0388, 0x0389, 0x038A, 0x00BB, 0x038C, 0x00BD, 0x038E, 0x038F,
+        0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+        0x03A0, 0x03A1, 0xFFFD, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+        0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+        0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0xFFFD
+    };
+    // 1254 (Turkish)
+    static const uint16_t _cshllink_cp1254[128] = {
+        0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0xFFFD, 0xFFFD, 0xFFFD,
+        0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0xFFFD, 0xFFFD, 0x0178,
+        0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+        0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+        0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+        0x011E, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0130, 0x015E, 0x00DF,
+        0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+        0x011F, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0131, 0x015F, 0x00FF
+    };
+    // 1255 (Hebrew)
+    static const uint16_t _cshllink_cp1255[128] = {
+        0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0xFFFD, 0x2039, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0xFFFD, 0x203A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AA, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00D7, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+        0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+        0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7, 0x05B8, 0x05B9, 0xFFFD, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF,
+        0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05F0, 0x05F1, 0x05F2, 0x05F3, 0x05F4, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+        0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0xFFFD, 0xFFFD, 0x200E, 0x200F, 0xFFFD
+    };
+    // 1256 (Arabic)
+    static const uint16_t _cshllink_cp1256[128] = {
+        0x20AC, 0x067E, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0679, 0x2039, 0x0152, 0x0686, 0x0698, 0x0688,
+        0x06AF, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x06A9, 0x2122, 0x0691, 0x203A, 0x0153, 0x200C, 0x200D, 0x06BA,
+        0x00A0, 0x060C, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x06BE, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+        0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x061B, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x061F,
+        0x06C1, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F,
+        0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x00D7, 0x0637, 0x0638, 0x0639, 0x063A, 0x0640, 0x0641, 0x0642, 0x0643,
+        0x00E0, 0x0644, 0x00E2, 0x0645, 0x0646, 0x0647, 0x0648, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x0649, 0x064A, 0x00EE, 0x00EF,
+        0x064B, 0x064C, 0x064D, 0x064E, 0x00F4, 0x064F, 0x0650, 0x00F7, 0x0651, 0x00F9, 0x0652, 0x00FB, 0x00FC, 0x200E, 0x200F, 0x06D2
+    };
+    // 1257 (Baltic)
+    static const uint16_t _cshllink_cp1257[128] = {
+        0x20AC, 0xFFFD, 0x201A, 0xFFFD, 0x201E, 0x2026, 0x2020, 0x2021, 0xFFFD, 0x2030, 0xFFFD, 0x2039, 0xFFFD, 0x00A8, 0x02C7, 0x00B8,
+        0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0xFFFD, 0x2122, 0xFFFD, 0x203A, 0xFFFD, 0x00AF, 0x02DB, 0xFFFD,
+        0x00A0, 0xFFFD, 0x00A2, 0x00A3, 0x00A4, 0xFFFD, 0x00A6, 0x00A7, 0x00D8, 0x00A9, 0x0156, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00C6,
+        0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00F8, 0x00B9, 0x0157, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00E6,
+        0x0104, 0x012E, 0x0100, 0x0106, 0x00C4, 0x00C5, 0x0118, 0x0112, 0x010C, 0x00C9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012A, 0x013B,
+        0x0160, 0x0143, 0x0145, 0x00D3, 0x014C, 0x00D5, 0x00D6, 0x00D7, 0x0172, 0x0141, 0x015A, 0x016A, 0x00DC, 0x017B, 0x017D, 0x00DF,
+        0x0105, 0x012F, 0x0101, 0x0107, 0x00E4, 0x00E5, 0x0119, 0x0113, 0x010D, 0x00E9, 0x017A, 0x0117, 0x0123, 0x0137, 0x012B, 0x013C,
+        0x0161, 0x0144, 0x0146, 0x00F3, 0x014D, 0x00F5, 0x00F6, 0x00F7, 0x0173, 0x0142, 0x015B, 0x016B, 0x00FC, 0x017C, 0x017E, 0x02D9
+    };
+    // 1258 (Vietnamese)
+    static const uint16_t _cshllink_cp1258[128] = {
+        0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0xFFFD, 0x2039, 0x0152, 0xFFFD, 0xFFFD, 0xFFFD,
+        0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0xFFFD, 0x203A, 0x0153, 0xFFFD, 0xFFFD, 0x0178,
+        0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+        0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+        0x00C0, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x0300, 0x00CD, 0x00CE, 0x00CF,
+        0x0110, 0x00D1, 0x0309, 0x00D3, 0x00D4, 0x01A0, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x01AF, 0x0303, 0x00DF,
+        0x00E0, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x0301, 0x00ED, 0x00EE, 0x00EF,
+        0x0111, 0x00F1, 0x0323, 0x00F3, 0x00F4, 0x01A1, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x01B0, 0x20AB, 0x00FF
+    };
+    // 28591 (ISO 8859-1)
+    static const uint16_t _cshllink_cp28591[128] = {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+        0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+        0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+        0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+        0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+        0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+        0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
+    };
+    // 932 (Japanese Shift-JIS)
+    static const uint8_t _cshllink_cp932lead[128] = {
+        0, 1, 2, 3, 4, 0, 0, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 0, 0, 41, 42, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 45, 0, 0, 0
+    };
+    static const uint16_t _cshllink_cp932[45][189] = {
+        // 0x81
+        {
+            0x3000, 0x3001, 0x3002, 0xFF0C, 0xFF0E, 0x30FB, 0xFF1A, 0xFF1B, 0xFF1F, 0xFF01, 0x309B, 0x309C, 0x00B4, 0xFF40, 0x00A8, 0xFF3E,
+            0xFFE3, 0xFF3F, 0x30FD, 0x30FE, 0x309D, 0x309E, 0x3003, 0x4EDD, 0x3005, 0x3006, 0x3007, 0x30FC, 0x2015, 0x2010, 0xFF0F, 0xFF3C,
+            0xFF5E, 0x2225, 0xFF5C, 0x2026, 0x2025, 0x2018, 0x2019, 0x201C, 0x201D, 0xFF08, 0xFF09, 0x3014, 0x3015, 0xFF3B, 0xFF3D, 0xFF5B,
+            0xFF5D, 0x3008, 0x3009, 0x300A, 0x300B, 0x300C, 0x300D, 0x300E, 0x300F, 0x3010, 0x3011, 0xFF0B, 0xFF0D, 0x00B1, 0x00D7, 0xFFFD,
+            0x00F7, 0xFF1D, 0x2260, 0xFF1C, 0xFF1E, 0x2266, 0x2267, 0x221E, 0x2234, 0x2642, 0x2640, 0x00B0, 0x2032, 0x2033, 0x2103, 0xFFE5,
+            0xFF04, 0xFFE0, 0xFFE1, 0xFF05, 0xFF03, 0xFF06, 0xFF0A, 0xFF20, 0x00A7, 0x2606, 0x2605, 0x25CB, 0x25CF, 0x25CE, 0x25C7, 0x25C6,
+            0x25A1, 0x25A0, 0x25B3, 0x25B2, 0x25BD, 0x25BC, 0x203B, 0x3012, 0x2192, 0x2190, 0x2191, 0x2193, 0x3013, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x2208, 0x220B, 0x2286, 0x2287, 0x2282, 0x2283, 0x222A, 0x2229,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x2227, 0x2228, 0xFFE2, 0x21D2, 0x21D4, 0x2200, 0x2203, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x2220, 0x22A5, 0x2312, 0x2202, 0x2207, 0x2261,
+            0x2252, 0x226A, 0x226B, 0x221A, 0x223D, 0x221D, 0x2235, 0x222B, 0x222C, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0x212B, 0x2030, 0x266F, 0x266D, 0x266A, 0x2020, 0x2021, 0x00B6, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x25EF
+        },
+        // 0x82
+        {
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFF10,
+            0xFF11, 0xFF12, 0xFF13, 0xFF14, 0xFF15, 0xFF16, 0xFF17, 0xFF18, 0xFF19, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F, 0xFF30,
+            0xFF31, 0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38, 0xFF39, 0xFF3A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F,
+            0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x3041,
+            0x3042, 0x3043, 0x3044, 0x3045, 0x3046, 0x3047, 0x3048, 0x3049, 0x304A, 0x304B, 0x304C, 0x304D, 0x304E, 0x304F, 0x3050, 0x3051,
+            0x3052, 0x3053, 0x3054, 0x3055, 0x3056, 0x3057, 0x3058, 0x3059, 0x305A, 0x305B, 0x305C, 0x305D, 0x305E, 0x305F, 0x3060, 0x3061,
+            0x3062, 0x3063, 0x3064, 0x3065, 0x3066, 0x3067, 0x3068, 0x3069, 0x306A, 0x306B, 0x306C, 0x306D, 0x306E, 0x306F, 0x3070, 0x3071,
+            0x3072, 0x3073, 0x3074, 0x3075, 0x3076, 0x3077, 0x3078, 0x3079, 0x307A, 0x307B, 0x307C, 0x307D, 0x307E, 0x307F, 0x3080, 0x3081,
+            0x3082, 0x3083, 0x3084, 0x3085, 0x3086, 0x3087, 0x3088, 0x3089, 0x308A, 0x308B, 0x308C, 0x308D, 0x308E, 0x308F, 0x3090, 0x3091,
+            0x3092, 0x3093, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD
+        },
+        // 0x83
+        {
+            0x30A1, 0x30A2, 0x30A3, 0x30A4, 0x30A5, 0x30A6, 0x30A7, 0x30A8, 0x30A9, 0x30AA, 0x30AB, 0x30AC, 0x30AD, 0x30AE, 0x30AF, 0x30B0,
+            0x30B1, 0x30B2, 0x30B3, 0x30B4, 0x30B5, 0x30B6, 0x30B7, 0x30B8, 0x30B9, 0x30BA, 0x30BB, 0x30BC, 0x30BD, 0x30BE, 0x30BF, 0x30C0,
+            0x30C1, 0x30C2, 0x30C3, 0x30C4, 0x30C5, 0x30C6, 0x30C7, 0x30C8, 0x30C9, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D0,
+            0x30D1, 0x30D2, 0x30D3, 0x30D4, 0x30D5, 0x30D6, 0x30D7, 0x30D8, 0x30D9, 0x30DA, 0x30DB, 0x30DC, 0x30DD, 0x30DE, 0x30DF, 0xFFFD,
+            0x30E0, 0x30E1, 0x30E2, 0x30E3, 0x30E4, 0x30E5, 0x30E6, 0x30E7, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EE, 0x30EF,
+            0x30F0, 0x30F1, 0x30F2, 0x30F3, 0x30F4, 0x30F5, 0x30F6, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x0391,
+            0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1,
+            0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x03B1,
+            0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1,
+            0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD
+        },
+        // 0x84
+        {
+            0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0401, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+            0x041F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E,
+            0x042F, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0451, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0xFFFD,
+            0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D,
+            0x044E, 0x044F, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x2500,
+            0x2502, 0x250C, 0x2510, 0x2518, 0x2514, 0x251C, 0x252C, 0x2524, 0x2534, 0x253C, 0x2501, 0x2503, 0x250F, 0x2513, 0x251B, 0x2517,
+            0x2523, 0x2533, 0x252B, 0x253B, 0x254B, 0x2520, 0x252F, 0x2528, 0x2537, 0x253F, 0x251D, 0x2530, 0x2525, 0x2538, 0x2542, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD
+        },
+        // 0x87
+        {
+            0x2460, 0x2461, 0x2462, 0x2463, 0x2464, 0x2465, 0x2466, 0x2467, 0x2468, 0x2469, 0x246A, 0x246B, 0x246C, 0x246D, 0x246E, 0x246F,
+            0x2470, 0x2471, 0x2472, 0x2473, 0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0xFFFD, 0x3349,
+            0x3314, 0x3322, 0x334D, 0x3318, 0x3327, 0x3303, 0x3336, 0x3351, 0x3357, 0x330D, 0x3326, 0x3323, 0x332B, 0x334A, 0x333B, 0x339C,
+            0x339D, 0x339E, 0x338E, 0x338F, 0x33C4, 0x33A1, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x337B, 0xFFFD,
+            0x301D, 0x301F, 0x2116, 0x33CD, 0x2121, 0x32A4, 0x32A5, 0x32A6, 0x32A7, 0x32A8, 0x3231, 0x3232, 0x3239, 0x337E, 0x337D, 0x337C,
+            0x2252, 0x2261, 0x222B, 0x222E, 0x2211, 0x221A, 0x22A5, 0x2220, 0x221F, 0x22BF, 0x2235, 0x2229, 0x222A, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD
+        },
+        // 0x88
+        {
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x4E9C,
+            0x5516, 0x5A03, 0x963F, 0x54C0, 0x611B, 0x6328, 0x59F6, 0x9022, 0x8475, 0x831C, 0x7A50, 0x60AA, 0x63E1, 0x6E25, 0x65ED, 0x8466,
+            0x82A6, 0x9BF5, 0x6893, 0x5727, 0x65A1, 0x6271, 0x5B9B, 0x59D0, 0x867B, 0x98F4, 0x7D62, 0x7DBE, 0x9B8E, 0x6216, 0x7C9F, 0x88B7,
+            0x5B89, 0x5EB5, 0x6309, 0x6697, 0x6848, 0x95C7, 0x978D, 0x674F, 0x4EE5, 0x4F0A, 0x4F4D, 0x4F9D, 0x5049, 0x56F2, 0x5937, 0x59D4,
+            0x5A01, 0x5C09, 0x60DF, 0x610F, 0x6170, 0x6613, 0x6905, 0x70BA, 0x754F, 0x7570, 0x79FB, 0x7DAD, 0x7DEF, 0x80C3, 0x840E, 0x8863,
+            0x8B02, 0x9055, 0x907A, 0x533B, 0x4E95, 0x4EA5, 0x57DF, 0x80B2, 0x90C1, 0x78EF, 0x4E00, 0x58F1, 0x6EA2, 0x9038, 0x7A32, 0x8328,
+            0x828B, 0x9C2F, 0x5141, 0x5370, 0x54BD, 0x54E1, 0x56E0, 0x59FB, 0x5F15, 0x98F2, 0x6DEB, 0x80E4, 0x852D
+        },
+        // 0x89
+        {
+            0x9662, 0x9670, 0x96A0, 0x97FB, 0x540B, 0x53F3, 0x5B87, 0x70CF, 0x7FBD, 0x8FC2, 0x96E8, 0x536F, 0x9D5C, 0x7ABA, 0x4E11, 0x7893,
+            0x81FC, 0x6E26, 0x5618, 0x5504, 0x6B1D, 0x851A, 0x9C3B, 0x59E5, 0x53A9, 0x6D66, 0x74DC, 0x958F, 0x5642, 0x4E91, 0x904B, 0x96F2,
+            0x834F, 0x990C, 0x53E1, 0x55B6, 0x5B30, 0x5F71, 0x6620, 0x66F3, 0x6804, 0x6C38, 0x6CF3, 0x6D29, 0x745B, 0x76C8, 0x7A4E, 0x9834,
+            0x82F1, 0x885B, 0x8A60, 0x92ED, 0x6DB2, 0x75AB, 0x76CA, 0x99C5, 0x60A6, 0x8B01, 0x8D8A, 0x95B2, 0x698E, 0x53AD, 0x5186, 0xFFFD,
+            0x5712, 0x5830, 0x5944, 0x5BB4, 0x5EF6, 0x6028, 0x63A9, 0x63F4, 0x6CBF, 0x6F14, 0x708E, 0x7114, 0x7159, 0x71D5, 0x733F, 0x7E01,
+            0x8276, 0x82D1, 0x8597, 0x9060, 0x925B, 0x9D1B, 0x5869, 0x65BC, 0x6C5A, 0x7525, 0x51F9, 0x592E, 0x5965, 0x5F80, 0x5FDC, 0x62BC,
+            0x65FA, 0x6A2A, 0x6B27, 0x6BB4, 0x738B, 0x7FC1, 0x8956, 0x9D2C, 0x9D0E, 0x9EC4, 0x5CA1, 0x6C96, 0x837B, 0x5104, 0x5C4B, 0x61B6,
+            0x81C6, 0x6876, 0x7261, 0x4E59, 0x4FFA, 0x5378, 0x6069, 0x6E29, 0x7A4F, 0x97F3, 0x4E0B, 0x5316, 0x4EEE, 0x4F55, 0x4F3D, 0x4FA1,
+            0x4F73, 0x52A0, 0x53EF, 0x5609, 0x590F, 0x5AC1, 0x5BB6, 0x5BE1, 0x79D1, 0x6687, 0x679C, 0x67B6, 0x6B4C, 0x6CB3, 0x706B, 0x73C2,
+            0x798D, 0x79BE, 0x7A3C, 0x7B87, 0x82B1, 0x82DB, 0x8304, 0x8377, 0x83EF, 0x83D3, 0x8766, 0x8AB2, 0x5629, 0x8CA8, 0x8FE6, 0x904E,
+            0x971E, 0x868A, 0x4FC4, 0x5CE8, 0x6211, 0x7259, 0x753B, 0x81E5, 0x82BD, 0x86FE, 0x8CC0, 0x96C5, 0x9913, 0x99D5, 0x4ECB, 0x4F1A,
+            0x89E3, 0x56DE, 0x584A, 0x58CA, 0x5EFB, 0x5FEB, 0x602A, 0x6094, 0x6062, 0x61D0, 0x6212, 0x62D0, 0x6539
+        },
+        // 0x8A
+        {
+            0x9B41, 0x6666, 0x68B0, 0x6D77, 0x7070, 0x754C, 0x7686, 0x7D75, 0x82A5, 0x87F9, 0x958B, 0x968E, 0x8C9D, 0x51F1, 0x52BE, 0x5916,
+            0x54B3, 0x5BB3, 0x5D16, 0x6168, 0x6982, 0x6DAF, 0x788D, 0x84CB, 0x8857, 0x8A72, 0x93A7, 0x9AB8, 0x6D6C, 0x99A8, 0x86D9, 0x57A3,
+            0x67FF, 0x86CE, 0x920E, 0x5283, 0x5687, 0x5404, 0x5ED3, 0x62E1, 0x64B9, 0x683C, 0x6838, 0x6BBB, 0x7372, 0x78BA, 0x7A6B, 0x899A,
+            0x89D2, 0x8D6B, 0x8F03, 0x90ED, 0x95A3, 0x9694, 0x9769, 0x5B66, 0x5CB3, 0x697D, 0x984D, 0x984E, 0x639B, 0x7B20, 0x6A2B, 0xFFFD,
+            0x6A7F, 0x68B6, 0x9C0D, 0x6F5F, 0x5272, 0x559D, 0x6070, 0x62EC, 0x6D3B, 0x6E07, 0x6ED1, 0x845B, 0x8910, 0x8F44, 0x4E14, 0x9C39,
+            0x53F6, 0x691B, 0x6A3A, 0x9784, 0x682A, 0x515C, 0x7AC3, 0x84B2, 0x91DC, 0x938C, 0x565B, 0x9D28, 0x6822, 0x8305, 0x8431, 0x7CA5,
+            0x5208, 0x82C5, 0x74E6, 0x4E7E, 0x4F83, 0x51A0, 0x5BD2, 0x520A, 0x52D8, 0x52E7, 0x5DFB, 0x559A, 0x582A, 0x59E6, 0x5B8C, 0x5B98,
+            0x5BDB, 0x5E72, 0x5E79, 0x60A3, 0x611F, 0x6163, 0x61BE, 0x63DB, 0x6562, 0x67D1, 0x6853, 0x68FA, 0x6B3E, 0x6B53, 0x6C57, 0x6F22,
+            0x6F97, 0x6F45, 0x74B0, 0x7518, 0x76E3, 0x770B, 0x7AFF, 0x7BA1, 0x7C21, 0x7DE9, 0x7F36, 0x7FF0, 0x809D, 0x8266, 0x839E, 0x89B3,
+            0x8ACC, 0x8CAB, 0x9084, 0x9451, 0x9593, 0x9591, 0x95A2, 0x9665, 0x97D3, 0x9928, 0x8218, 0x4E38, 0x542B, 0x5CB8, 0x5DCC, 0x73A9,
+            0x764C, 0x773C, 0x5CA9, 0x7FEB, 0x8D0B, 0x96C1, 0x9811, 0x9854, 0x9858, 0x4F01, 0x4F0E, 0x5371, 0x559C, 0x5668, 0x57FA, 0x5947,
+            0x5B09, 0x5BC4, 0x5C90, 0x5E0C, 0x5E7E, 0x5FCC, 0x63EE, 0x673A, 0x65D7, 0x65E2, 0x671F, 0x68CB, 0x68C4
+        },
+        // 0x8B
+        {
+            0x6A5F, 0x5E30, 0x6BC5, 0x6C17, 0x6C7D, 0x757F, 0x7948, 0x5B63, 0x7A00, 0x7D00, 0x5FBD, 0x898F, 0x8A18, 0x8CB4, 0x8D77, 0x8ECC,
+            0x8F1D, 0x98E2, 0x9A0E, 0x9B3C, 0x4E80, 0x507D, 0x5100, 0x5993, 0x5B9C, 0x622F, 0x6280, 0x64EC, 0x6B3A, 0x72A0, 0x7591, 0x7947,
+            0x7FA9, 0x87FB, 0x8ABC, 0x8B70, 0x63AC, 0x83CA, 0x97A0, 0x5409, 0x5403, 0x55AB, 0x6854, 0x6A58, 0x8A70, 0x7827, 0x6775, 0x9ECD,
+            0x5374, 0x5BA2, 0x811A, 0x8650, 0x9006, 0x4E18, 0x4E45, 0x4EC7, 0x4F11, 0x53CA, 0x5438, 0x5BAE, 0x5F13, 0x6025, 0x6551, 0xFFFD,
+            0x673D, 0x6C42, 0x6C72, 0x6CE3, 0x7078, 0x7403, 0x7A76, 0x7AAE, 0x7B08, 0x7D1A, 0x7CFE, 0x7D66, 0x65E7, 0x725B, 0x53BB, 0x5C45,
+            0x5DE8, 0x62D2, 0x62E0, 0x6319, 0x6E20, 0x865A, 0x8A31, 0x8DDD, 0x92F8, 0x6F01, 0x79A6, 0x9B5A, 0x4EA8, 0x4EAB, 0x4EAC, 0x4F9B,
+            0x4FA0, 0x50D1, 0x5147, 0x7AF6, 0x5171, 0x51F6, 0x5354, 0x5321, 0x537F, 0x53EB, 0x55AC, 0x5883, 0x5CE1, 0x5F37, 0x5F4A, 0x602F,
+            0x6050, 0x606D, 0x631F, 0x6559, 0x6A4B, 0x6CC1, 0x72C2, 0x72ED, 0x77EF, 0x80F8, 0x8105, 0x8208, 0x854E, 0x90F7, 0x93E1, 0x97FF,
+            0x9957, 0x9A5A, 0x4EF0, 0x51DD, 0x5C2D, 0x6681, 0x696D, 0x5C40, 0x66F2, 0x6975, 0x7389, 0x6850, 0x7C81, 0x50C5, 0x52E4, 0x5747,
+            0x5DFE, 0x9326, 0x65A4, 0x6B23, 0x6B3D, 0x7434, 0x7981, 0x79BD, 0x7B4B, 0x7DCA, 0x82B9, 0x83CC, 0x887F, 0x895F, 0x8B39, 0x8FD1,
+            0x91D1, 0x541F, 0x9280, 0x4E5D, 0x5036, 0x53E5, 0x533A, 0x72D7, 0x7396, 0x77E9, 0x82E6, 0x8EAF, 0x99C6, 0x99C8, 0x99D2, 0x5177,
+            0x611A, 0x865E, 0x55B0, 0x7A7A, 0x5076, 0x5BD3, 0x9047, 0x9685, 0x4E32, 0x6ADB, 0x91E7, 0x5C51, 0x5C48
+        },
+        // 0x8C
+        {
+            0x6398, 0x7A9F, 0x6C93, 0x9774, 0x8F61, 0x7AAA, 0x718A, 0x9688, 0x7C82, 0x6817, 0x7E70, 0x6851, 0x936C, 0x52F2, 0x541B, 0x85AB,
+            0x8A13, 0x7FA4, 0x8ECD, 0x90E1, 0x5366, 0x8888, 0x7941, 0x4FC2, 0x50BE, 0x5211, 0x5144, 0x5553, 0x572D, 0x73EA, 0x578B, 0x5951,
+            0x5F62, 0x5F84, 0x6075, 0x6176, 0x6167, 0x61A9, 0x63B2, 0x643A, 0x656C, 0x666F, 0x6842, 0x6E13, 0x7566, 0x7A3D, 0x7CFB, 0x7D4C,
+            0x7D99, 0x7E4B, 0x7F6B, 0x830E, 0x834A, 0x86CD, 0x8A08, 0x8A63, 0x8B66, 0x8EFD, 0x981A, 0x9D8F, 0x82B8, 0x8FCE, 0x9BE8, 0xFFFD,
+            0x5287, 0x621F, 0x6483, 0x6FC0, 0x9699, 0x6841, 0x5091, 0x6B20, 0x6C7A, 0x6F54, 0x7A74, 0x7D50, 0x8840, 0x8A23, 0x6708, 0x4EF6,
+            0x5039, 0x5026, 0x5065, 0x517C, 0x5238, 0x5263, 0x55A7, 0x570F, 0x5805, 0x5ACC, 0x5EFA, 0x61B2, 0x61F8, 0x62F3, 0x6372, 0x691C,
+            0x6A29, 0x727D, 0x72AC, 0x732E, 0x7814, 0x786F, 0x7D79, 0x770C, 0x80A9, 0x898B, 0x8B19, 0x8CE2, 0x8ED2, 0x9063, 0x9375, 0x967A,
+            0x9855, 0x9A13, 0x9E78, 0x5143, 0x539F, 0x53B3, 0x5E7B, 0x5F26, 0x6E1B, 0x6E90, 0x7384, 0x73FE, 0x7D43, 0x8237, 0x8A00, 0x8AFA,
+            0x9650, 0x4E4E, 0x500B, 0x53E4, 0x547C, 0x56FA, 0x59D1, 0x5B64, 0x5DF1, 0x5EAB, 0x5F27, 0x6238, 0x6545, 0x67AF, 0x6E56, 0x72D0,
+            0x7CCA, 0x88B4, 0x80A1, 0x80E1, 0x83F0, 0x864E, 0x8A87, 0x8DE8, 0x9237, 0x96C7, 0x9867, 0x9F13, 0x4E94, 0x4E92, 0x4F0D, 0x5348,
+            0x5449, 0x543E, 0x5A2F, 0x5F8C, 0x5FA1, 0x609F, 0x68A7, 0x6A8E, 0x745A, 0x7881, 0x8A9E, 0x8AA4, 0x8B77, 0x9190, 0x4E5E, 0x9BC9,
+            0x4EA4, 0x4F7C, 0x4FAF, 0x5019, 0x5016, 0x5149, 0x516C, 0x529F, 0x52B9, 0x52FE, 0x539A, 0x53E3, 0x5411
+        },
+        // 0x8D
+        {
+            0x540E, 0x5589, 0x5751, 0x57A2, 0x597D, 0x5B54, 0x5B5D, 0x5B8F, 0x5DE5, 0x5DE7, 0x5DF7, 0x5E78, 0x5E83, 0x5E9A, 0x5EB7, 0x5F18,
+            0x6052, 0x614C, 0x6297, 0x62D8, 0x63A7, 0x653B, 0x6602, 0x6643, 0x66F4, 0x676D, 0x6821, 0x6897, 0x69CB, 0x6C5F, 0x6D2A, 0x6D69,
+            0x6E2F, 0x6E9D, 0x7532, 0x7687, 0x786C, 0x7A3F, 0x7CE0, 0x7D05, 0x7D18, 0x7D5E, 0x7DB1, 0x8015, 0x8003, 0x80AF, 0x80B1, 0x8154,
+            0x818F, 0x822A, 0x8352, 0x884C, 0x8861, 0x8B1B, 0x8CA2, 0x8CFC, 0x90CA, 0x9175, 0x9271, 0x783F, 0x92FC, 0x95A4, 0x964D, 0xFFFD,
+            0x9805, 0x9999, 0x9AD8, 0x9D3B, 0x525B, 0x52AB, 0x53F7, 0x5408, 0x58D5, 0x62F7, 0x6FE0, 0x8C6A, 0x8F5F, 0x9EB9, 0x514B, 0x523B,
+            0x544A, 0x56FD, 0x7A40, 0x9177, 0x9D60, 0x9ED2, 0x7344, 0x6F09, 0x8170, 0x7511, 0x5FFD, 0x60DA, 0x9AA8, 0x72DB, 0x8FBC, 0x6B64,
+            0x9803, 0x4ECA, 0x56F0, 0x5764, 0x58BE, 0x5A5A, 0x6068, 0x61C7, 0x660F, 0x6606, 0x6839, 0x68B1, 0x6DF7, 0x75D5, 0x7D3A, 0x826E,
+            0x9B42, 0x4E9B, 0x4F50, 0x53C9, 0x5506, 0x5D6F, 0x5DE6, 0x5DEE, 0x67FB, 0x6C99, 0x7473, 0x7802, 0x8A50, 0x9396, 0x88DF, 0x5750,
+            0x5EA7, 0x632B, 0x50B5, 0x50AC, 0x518D, 0x6700, 0x54C9, 0x585E, 0x59BB, 0x5BB0, 0x5F69, 0x624D, 0x63A1, 0x683D, 0x6B73, 0x6E08,
+            0x707D, 0x91C7, 0x7280, 0x7815, 0x7826, 0x796D, 0x658E, 0x7D30, 0x83DC, 0x88C1, 0x8F09, 0x969B, 0x5264, 0x5728, 0x6750, 0x7F6A,
+            0x8CA1, 0x51B4, 0x5742, 0x962A, 0x583A, 0x698A, 0x80B4, 0x54B2, 0x5D0E, 0x57FC, 0x7895, 0x9DFA, 0x4F5C, 0x524A, 0x548B, 0x643E,
+            0x6628, 0x6714, 0x67F5, 0x7A84, 0x7B56, 0x7D22, 0x932F, 0x685C, 0x9BAD, 0x7B39, 0x5319, 0x518A, 0x5237
+        },
+        // 0x8E
+        {
+            0x5BDF, 0x62F6, 0x64AE, 0x64E6, 0x672D, 0x6BBA, 0x85A9, 0x96D1, 0x7690, 0x9BD6, 0x634C, 0x9306, 0x9BAB, 0x76BF, 0x6652, 0x4E09,
+            0x5098, 0x53C2, 0x5C71, 0x60E8, 0x6492, 0x6563, 0x685F, 0x71E6, 0x73CA, 0x7523, 0x7B97, 0x7E82, 0x8695, 0x8B83, 0x8CDB, 0x9178,
+            0x9910, 0x65AC, 0x66AB, 0x6B8B, 0x4ED5, 0x4ED4, 0x4F3A, 0x4F7F, 0x523A, 0x53F8, 0x53F2, 0x55E3, 0x56DB, 0x58EB, 0x59CB, 0x59C9,
+            0x59FF, 0x5B50, 0x5C4D, 0x5E02, 0x5E2B, 0x5FD7, 0x601D, 0x6307, 0x652F, 0x5B5C, 0x65AF, 0x65BD, 0x65E8, 0x679D, 0x6B62, 0xFFFD,
+            0x6B7B, 0x6C0F, 0x7345, 0x7949, 0x79C1, 0x7CF8, 0x7D19, 0x7D2B, 0x80A2, 0x8102, 0x81F3, 0x8996, 0x8A5E, 0x8A69, 0x8A66, 0x8A8C,
+            0x8AEE, 0x8CC7, 0x8CDC, 0x96CC, 0x98FC, 0x6B6F, 0x4E8B, 0x4F3C, 0x4F8D, 0x5150, 0x5B57, 0x5BFA, 0x6148, 0x6301, 0x6642, 0x6B21,
+            0x6ECB, 0x6CBB, 0x723E, 0x74BD, 0x75D4, 0x78C1, 0x793A, 0x800C, 0x8033, 0x81EA, 0x8494, 0x8F9E, 0x6C50, 0x9E7F, 0x5F0F, 0x8B58,
+            0x9D2B, 0x7AFA, 0x8EF8, 0x5B8D, 0x96EB, 0x4E03, 0x53F1, 0x57F7, 0x5931, 0x5AC9, 0x5BA4, 0x6089, 0x6E7F, 0x6F06, 0x75BE, 0x8CEA,
+            0x5B9F, 0x8500, 0x7BE0, 0x5072, 0x67F4, 0x829D, 0x5C61, 0x854A, 0x7E1E, 0x820E, 0x5199, 0x5C04, 0x6368, 0x8D66, 0x659C, 0x716E,
+            0x793E, 0x7D17, 0x8005, 0x8B1D, 0x8ECA, 0x906E, 0x86C7, 0x90AA, 0x501F, 0x52FA, 0x5C3A, 0x6753, 0x707C, 0x7235, 0x914C, 0x91C8,
+            0x932B, 0x82E5, 0x5BC2, 0x5F31, 0x60F9, 0x4E3B, 0x53D6, 0x5B88, 0x624B, 0x6731, 0x6B8A, 0x72E9, 0x73E0, 0x7A2E, 0x816B, 0x8DA3,
+            0x9152, 0x9996, 0x5112, 0x53D7, 0x546A, 0x5BFF, 0x6388, 0x6A39, 0x7DAC, 0x9700, 0x56DA, 0x53CE, 0x5468
+        },
+        // 0x8F
+        {
+            0x5B97, 0x5C31, 0x5DDE, 0x4FEE, 0x6101, 0x62FE, 0x6D32, 0x79C0, 0x79CB, 0x7D42, 0x7E4D, 0x7FD2, 0x81ED, 0x821F, 0x8490, 0x8846,
+            0x8972, 0x8B90, 0x8E74, 0x8F2F, 0x9031, 0x914B, 0x916C, 0x96C6, 0x919C, 0x4EC0, 0x4F4F, 0x5145, 0x5341, 0x5F93, 0x620E, 0x67D4,
+            0x6C41, 0x6E0B, 0x7363, 0x7E26, 0x91CD, 0x9283, 0x53D4, 0x5919, 0x5BBF, 0x6DD1, 0x795D, 0x7E2E, 0x7C9B, 0x587E, 0x719F, 0x51FA,
+            0x8853, 0x8FF0, 0x4FCA, 0x5CFB, 0x6625, 0x77AC, 0x7AE3, 0x821C, 0x99FF, 0x51C6, 0x5FAA, 0x65EC, 0x696F, 0x6B89, 0x6DF3, 0xFFFD,
+            0x6E96, 0x6F64, 0x76FE, 0x7D14, 0x5DE1, 0x9075, 0x9187, 0x9806, 0x51E6, 0x521D, 0x6240, 0x6691, 0x66D9, 0x6E1A, 0x5EB6, 0x7DD2,
+            0x7F72, 0x66F8, 0x85AF, 0x85F7, 0x8AF8, 0x52A9, 0x53D9, 0x5973, 0x5E8F, 0x5F90, 0x6055, 0x92E4, 0x9664, 0x50B7, 0x511F, 0x52DD,
+            0x5320, 0x5347, 0x53EC, 0x54E8, 0x5546, 0x5531, 0x5617, 0x5968, 0x59BE, 0x5A3C, 0x5BB5, 0x5C06, 0x5C0F, 0x5C11, 0x5C1A, 0x5E84,
+            0x5E8A, 0x5EE0, 0x5F70, 0x627F, 0x6284, 0x62DB, 0x638C, 0x6377, 0x6607, 0x660C, 0x662D, 0x6676, 0x677E, 0x68A2, 0x6A1F, 0x6A35,
+            0x6CBC, 0x6D88, 0x6E09, 0x6E58, 0x713C, 0x7126, 0x7167, 0x75C7, 0x7701, 0x785D, 0x7901, 0x7965, 0x79F0, 0x7AE0, 0x7B11, 0x7CA7,
+            0x7D39, 0x8096, 0x83D6, 0x848B, 0x8549, 0x885D, 0x88F3, 0x8A1F, 0x8A3C, 0x8A54, 0x8A73, 0x8C61, 0x8CDE, 0x91A4, 0x9266, 0x937E,
+            0x9418, 0x969C, 0x9798, 0x4E0A, 0x4E08, 0x4E1E, 0x4E57, 0x5197, 0x5270, 0x57CE, 0x5834, 0x58CC, 0x5B22, 0x5E38, 0x60C5, 0x64FE,
+            0x6761, 0x6756, 0x6D44, 0x72B6, 0x7573, 0x7A63, 0x84B8, 0x8B72, 0x91B8, 0x9320, 0x5631, 0x57F4, 0x98FE
+        },
+        // 0x90
+        {
+            0x62ED, 0x690D, 0x6B96, 0x71ED, 0x7E54, 0x8077, 0x8272, 0x89E6, 0x98DF, 0x8755, 0x8FB1, 0x5C3B, 0x4F38, 0x4FE1, 0x4FB5, 0x5507,
+            0x5A20, 0x5BDD, 0x5BE9, 0x5FC3, 0x614E, 0x632F, 0x65B0, 0x664B, 0x68EE, 0x699B, 0x6D78, 0x6DF1, 0x7533, 0x75B9, 0x771F, 0x795E,
+            0x79E6, 0x7D33, 0x81E3, 0x82AF, 0x85AA, 0x89AA, 0x8A3A, 0x8EAB, 0x8F9B, 0x9032, 0x91DD, 0x9707, 0x4EBA, 0x4EC1, 0x5203, 0x5875,
+            0x58EC, 0x5C0B, 0x751A, 0x5C3D, 0x814E, 0x8A0A, 0x8FC5, 0x9663, 0x976D, 0x7B25, 0x8ACF, 0x9808, 0x9162, 0x56F3, 0x53A8, 0xFFFD,
+            0x9017, 0x5439, 0x5782, 0x5E25, 0x63A8, 0x6C34, 0x708A, 0x7761, 0x7C8B, 0x7FE0, 0x8870, 0x9042, 0x9154, 0x9310, 0x9318, 0x968F,
+            0x745E, 0x9AC4, 0x5D07, 0x5D69, 0x6570, 0x67A2, 0x8DA8, 0x96DB, 0x636E, 0x6749, 0x6919, 0x83C5, 0x9817, 0x96C0, 0x88FE, 0x6F84,
+            0x647A, 0x5BF8, 0x4E16, 0x702C, 0x755D, 0x662F, 0x51C4, 0x5236, 0x52E2, 0x59D3, 0x5F81, 0x6027, 0x6210, 0x653F, 0x6574, 0x661F,
+            0x6674, 0x68F2, 0x6816, 0x6B63, 0x6E05, 0x7272, 0x751F, 0x76DB, 0x7CBE, 0x8056, 0x58F0, 0x88FD, 0x897F, 0x8AA0, 0x8A93, 0x8ACB,
+            0x901D, 0x9192, 0x9752, 0x9759, 0x6589, 0x7A0E, 0x8106, 0x96BB, 0x5E2D, 0x60DC, 0x621A, 0x65A5, 0x6614, 0x6790, 0x77F3, 0x7A4D,
+            0x7C4D, 0x7E3E, 0x810A, 0x8CAC, 0x8D64, 0x8DE1, 0x8E5F, 0x78A9, 0x5207, 0x62D9, 0x63A5, 0x6442, 0x6298, 0x8A2D, 0x7A83, 0x7BC0,
+            0x8AAC, 0x96EA, 0x7D76, 0x820C, 0x8749, 0x4ED9, 0x5148, 0x5343, 0x5360, 0x5BA3, 0x5C02, 0x5C16, 0x5DDD, 0x6226, 0x6247, 0x64B0,
+            0x6813, 0x6834, 0x6CC9, 0x6D45, 0x6D17, 0x67D3, 0x6F5C, 0x714E, 0x717D, 0x65CB, 0x7A7F, 0x7BAD, 0x7DDA
+        },
+        // 0x91
+        {
+            0x7E4A, 0x7FA8, 0x817A, 0x821B, 0x8239, 0x85A6, 0x8A6E, 0x8CCE, 0x8DF5, 0x9078, 0x9077, 0x92AD, 0x9291, 0x9583, 0x9BAE, 0x524D,
+            0x5584, 0x6F38, 0x7136, 0x5168, 0x7985, 0x7E55, 0x81B3, 0x7CCE, 0x564C, 0x5851, 0x5CA8, 0x63AA, 0x66FE, 0x66FD, 0x695A, 0x72D9,
+            0x758F, 0x758E, 0x790E, 0x7956, 0x79DF, 0x7C97, 0x7D20, 0x7D44, 0x8607, 0x8A34, 0x963B, 0x9061, 0x9F20, 0x50E7, 0x5275, 0x53CC,
+            0x53E2, 0x5009, 0x55AA, 0x58EE, 0x594F, 0x723D, 0x5B8B, 0x5C64, 0x531D, 0x60E3, 0x60F3, 0x635C, 0x6383, 0x633F, 0x63BB, 0xFFFD,
+            0x64CD, 0x65E9, 0x66F9, 0x5DE3, 0x69CD, 0x69FD, 0x6F15, 0x71E5, 0x4E89, 0x75E9, 0x76F8, 0x7A93, 0x7CDF, 0x7DCF, 0x7D9C, 0x8061,
+            0x8349, 0x8358, 0x846C, 0x84BC, 0x85FB, 0x88C5, 0x8D70, 0x9001, 0x906D, 0x9397, 0x971C, 0x9A12, 0x50CF, 0x5897, 0x618E, 0x81D3,
+            0x8535, 0x8D08, 0x9020, 0x4FC3, 0x5074, 0x5247, 0x5373, 0x606F, 0x6349, 0x675F, 0x6E2C, 0x8DB3, 0x901F, 0x4FD7, 0x5C5E, 0x8CCA,
+            0x65CF, 0x7D9A, 0x5352, 0x8896, 0x5176, 0x63C3, 0x5B58, 0x5B6B, 0x5C0A, 0x640D, 0x6751, 0x905C, 0x4ED6, 0x591A, 0x592A, 0x6C70,
+            0x8A51, 0x553E, 0x5815, 0x59A5, 0x60F0, 0x6253, 0x67C1, 0x8235, 0x6955, 0x9640, 0x99C4, 0x9A28, 0x4F53, 0x5806, 0x5BFE, 0x8010,
+            0x5CB1, 0x5E2F, 0x5F85, 0x6020, 0x614B, 0x6234, 0x66FF, 0x6CF0, 0x6EDE, 0x80CE, 0x817F, 0x82D4, 0x888B, 0x8CB8, 0x9000, 0x902E,
+            0x968A, 0x9EDB, 0x9BDB, 0x4EE3, 0x53F0, 0x5927, 0x7B2C, 0x918D, 0x984C, 0x9DF9, 0x6EDD, 0x7027, 0x5353, 0x5544, 0x5B85, 0x6258,
+            0x629E, 0x62D3, 0x6CA2, 0x6FEF, 0x7422, 0x8A17, 0x9438, 0x6FC1, 0x8AFE, 0x8338, 0x51E7, 0x86F8, 0x53EA
+        },
+        // 0x92
+        {
+            0x53E9, 0x4F46, 0x9054, 0x8FB0, 0x596A, 0x8131, 0x5DFD, 0x7AEA, 0x8FBF, 0x68DA, 0x8C37, 0x72F8, 0x9C48, 0x6A3D, 0x8AB0, 0x4E39,
+            0x5358, 0x5606, 0x5766, 0x62C5, 0x63A2, 0x65E6, 0x6B4E, 0x6DE1, 0x6E5B, 0x70AD, 0x77ED, 0x7AEF, 0x7BAA, 0x7DBB, 0x803D, 0x80C6,
+            0x86CB, 0x8A95, 0x935B, 0x56E3, 0x58C7, 0x5F3E, 0x65AD, 0x6696, 0x6A80, 0x6BB5, 0x7537, 0x8AC7, 0x5024, 0x77E5, 0x5730, 0x5F1B,
+            0x6065, 0x667A, 0x6C60, 0x75F4, 0x7A1A, 0x7F6E, 0x81F4, 0x8718, 0x9045, 0x99B3, 0x7BC9, 0x755C, 0x7AF9, 0x7B51, 0x84C4, 0xFFFD,
+            0x9010, 0x79E9, 0x7A92, 0x8336, 0x5AE1, 0x7740, 0x4E2D, 0x4EF2, 0x5B99, 0x5FE0, 0x62BD, 0x663C, 0x67F1, 0x6CE8, 0x866B, 0x8877,
+            0x8A3B, 0x914E, 0x92F3, 0x99D0, 0x6A17, 0x7026, 0x732A, 0x82E7, 0x8457, 0x8CAF, 0x4E01, 0x5146, 0x51CB, 0x558B, 0x5BF5, 0x5E16,
+            0x5E33, 0x5E81, 0x5F14, 0x5F35, 0x5F6B, 0x5FB4, 0x61F2, 0x6311, 0x66A2, 0x671D, 0x6F6E, 0x7252, 0x753A, 0x773A, 0x8074, 0x8139,
+            0x8178, 0x8776, 0x8ABF, 0x8ADC, 0x8D85, 0x8DF3, 0x929A, 0x9577, 0x9802, 0x9CE5, 0x52C5, 0x6357, 0x76F4, 0x6715, 0x6C88, 0x73CD,
+            0x8CC3, 0x93AE, 0x9673, 0x6D25, 0x589C, 0x690E, 0x69CC, 0x8FFD, 0x939A, 0x75DB, 0x901A, 0x585A, 0x6802, 0x63B4, 0x69FB, 0x4F43,
+            0x6F2C, 0x67D8, 0x8FBB, 0x8526, 0x7DB4, 0x9354, 0x693F, 0x6F70, 0x576A, 0x58F7, 0x5B2C, 0x7D2C, 0x722A, 0x540A, 0x91E3, 0x9DB4,
+            0x4EAD, 0x4F4E, 0x505C, 0x5075, 0x5243, 0x8C9E, 0x5448, 0x5824, 0x5B9A, 0x5E1D, 0x5E95, 0x5EAD, 0x5EF7, 0x5F1F, 0x608C, 0x62B5,
+            0x633A, 0x63D0, 0x68AF, 0x6C40, 0x7887, 0x798E, 0x7A0B, 0x7DE0, 0x8247, 0x8A02, 0x8AE6, 0x8E44, 0x9013
+        },
+        // 0x93
+        {
+            0x90B8, 0x912D, 0x91D8, 0x9F0E, 0x6CE5, 0x6458, 0x64E2, 0x6575, 0x6EF4, 0x7684, 0x7B1B, 0x9069, 0x93D1, 0x6EBA, 0x54F2, 0x5FB9,
+            0x64A4, 0x8F4D, 0x8FED, 0x9244, 0x5178, 0x586B, 0x5929, 0x5C55, 0x5E97, 0x6DFB, 0x7E8F, 0x751C, 0x8CBC, 0x8EE2, 0x985B, 0x70B9,
+            0x4F1D, 0x6BBF, 0x6FB1, 0x7530, 0x96FB, 0x514E, 0x5410, 0x5835, 0x5857, 0x59AC, 0x5C60, 0x5F92, 0x6597, 0x675C, 0x6E21, 0x767B,
+            0x83DF, 0x8CED, 0x9014, 0x90FD, 0x934D, 0x7825, 0x783A, 0x52AA, 0x5EA6, 0x571F, 0x5974, 0x6012, 0x5012, 0x515A, 0x51AC, 0xFFFD,
+            0x51CD, 0x5200, 0x5510, 0x5854, 0x5858, 0x5957, 0x5B95, 0x5CF6, 0x5D8B, 0x60BC, 0x6295, 0x642D, 0x6771, 0x6843, 0x68BC, 0x68DF,
+            0x76D7, 0x6DD8, 0x6E6F, 0x6D9B, 0x706F, 0x71C8, 0x5F53, 0x75D8, 0x7977, 0x7B49, 0x7B54, 0x7B52, 0x7CD6, 0x7D71, 0x5230, 0x8463,
+            0x8569, 0x85E4, 0x8A0E, 0x8B04, 0x8C46, 0x8E0F, 0x9003, 0x900F, 0x9419, 0x9676, 0x982D, 0x9A30, 0x95D8, 0x50CD, 0x52D5, 0x540C,
+            0x5802, 0x5C0E, 0x61A7, 0x649E, 0x6D1E, 0x77B3, 0x7AE5, 0x80F4, 0x8404, 0x9053, 0x9285, 0x5CE0, 0x9D07, 0x533F, 0x5F97, 0x5FB3,
+            0x6D9C, 0x7279, 0x7763, 0x79BF, 0x7BE4, 0x6BD2, 0x72EC, 0x8AAD, 0x6803, 0x6A61, 0x51F8, 0x7A81, 0x6934, 0x5C4A, 0x9CF6, 0x82EB,
+            0x5BC5, 0x9149, 0x701E, 0x5678, 0x5C6F, 0x60C7, 0x6566, 0x6C8C, 0x8C5A, 0x9041, 0x9813, 0x5451, 0x66C7, 0x920D, 0x5948, 0x90A3,
+            0x5185, 0x4E4D, 0x51EA, 0x8599, 0x8B0E, 0x7058, 0x637A, 0x934B, 0x6962, 0x99B4, 0x7E04, 0x7577, 0x5357, 0x6960, 0x8EDF, 0x96E3,
+            0x6C5D, 0x4E8C, 0x5C3C, 0x5F10, 0x8FE9, 0x5302, 0x8CD1, 0x8089, 0x8679, 0x5EFF, 0x65E5, 0x4E73, 0x5165
+        },
+        // 0x94
+        {
+            0x5982, 0x5C3F, 0x97EE, 0x4EFB, 0x598A, 0x5FCD, 0x8A8D, 0x6FE1, 0x79B0, 0x7962, 0x5BE7, 0x8471, 0x732B, 0x71B1, 0x5E74, 0x5FF5,
+            0x637B, 0x649A, 0x71C3, 0x7C98, 0x4E43, 0x5EFC, 0x4E4B, 0x57DC, 0x56A2, 0x60A9, 0x6FC3, 0x7D0D, 0x80FD, 0x8133, 0x81BF, 0x8FB2,
+            0x8997, 0x86A4, 0x5DF4, 0x628A, 0x64AD, 0x8987, 0x6777, 0x6CE2, 0x6D3E, 0x7436, 0x7834, 0x5A46, 0x7F75, 0x82AD, 0x99AC, 0x4FF3,
+            0x5EC3, 0x62DD, 0x6392, 0x6557, 0x676F, 0x76C3, 0x724C, 0x80CC, 0x80BA, 0x8F29, 0x914D, 0x500D, 0x57F9, 0x5A92, 0x6885, 0xFFFD,
+            0x6973, 0x7164, 0x72FD, 0x8CB7, 0x58F2, 0x8CE0, 0x966A, 0x9019, 0x877F, 0x79E4, 0x77E7, 0x8429, 0x4F2F, 0x5265, 0x535A, 0x62CD,
+            0x67CF, 0x6CCA, 0x767D, 0x7B94, 0x7C95, 0x8236, 0x8584, 0x8FEB, 0x66DD, 0x6F20, 0x7206, 0x7E1B, 0x83AB, 0x99C1, 0x9EA6, 0x51FD,
+            0x7BB1, 0x7872, 0x7BB8, 0x8087, 0x7B48, 0x6AE8, 0x5E61, 0x808C, 0x7551, 0x7560, 0x516B, 0x9262, 0x6E8C, 0x767A, 0x9197, 0x9AEA,
+            0x4F10, 0x7F70, 0x629C, 0x7B4F, 0x95A5, 0x9CE9, 0x567A, 0x5859, 0x86E4, 0x96BC, 0x4F34, 0x5224, 0x534A, 0x53CD, 0x53DB, 0x5E06,
+            0x642C, 0x6591, 0x677F, 0x6C3E, 0x6C4E, 0x7248, 0x72AF, 0x73ED, 0x7554, 0x7E41, 0x822C, 0x85E9, 0x8CA9, 0x7BC4, 0x91C6, 0x7169,
+            0x9812, 0x98EF, 0x633D, 0x6669, 0x756A, 0x76E4, 0x78D0, 0x8543, 0x86EE, 0x532A, 0x5351, 0x5426, 0x5983, 0x5E87, 0x5F7C, 0x60B2,
+            0x6249, 0x6279, 0x62AB, 0x6590, 0x6BD4, 0x6CCC, 0x75B2, 0x76AE, 0x7891, 0x79D8, 0x7DCB, 0x7F77, 0x80A5, 0x88AB, 0x8AB9, 0x8CBB,
+            0x907F, 0x975E, 0x98DB, 0x6A0B, 0x7C38, 0x5099, 0x5C3E, 0x5FAE, 0x6787, 0x6BD8, 0x7435, 0x7709, 0x7F8E
+        },
+        // 0x95
+        {
+            0x9F3B, 0x67CA, 0x7A17, 0x5339, 0x758B, 0x9AED, 0x5F66, 0x819D, 0x83F1, 0x8098, 0x5F3C, 0x5FC5, 0x7562, 0x7B46, 0x903C, 0x6867,
+            0x59EB, 0x5A9B, 0x7D10, 0x767E, 0x8B2C, 0x4FF5, 0x5F6A, 0x6A19, 0x6C37, 0x6F02, 0x74E2, 0x7968, 0x8868, 0x8A55, 0x8C79, 0x5EDF,
+            0x63CF, 0x75C5, 0x79D2, 0x82D7, 0x9328, 0x92F2, 0x849C, 0x86ED, 0x9C2D, 0x54C1, 0x5F6C, 0x658C, 0x6D5C, 0x7015, 0x8CA7, 0x8CD3,
+            0x983B, 0x654F, 0x74F6, 0x4E0D, 0x4ED8, 0x57E0, 0x592B, 0x5A66, 0x5BCC, 0x51A8, 0x5E03, 0x5E9C, 0x6016, 0x6276, 0x6577, 0xFFFD,
+            0x65A7, 0x666E, 0x6D6E, 0x7236, 0x7B26, 0x8150, 0x819A, 0x8299, 0x8B5C, 0x8CA0, 0x8CE6, 0x8D74, 0x961C, 0x9644, 0x4FAE, 0x64AB,
+            0x6B66, 0x821E, 0x8461, 0x856A, 0x90E8, 0x5C01, 0x6953, 0x98A8, 0x847A, 0x8557, 0x4F0F, 0x526F, 0x5FA9, 0x5E45, 0x670D, 0x798F,
+            0x8179, 0x8907, 0x8986, 0x6DF5, 0x5F17, 0x6255, 0x6CB8, 0x4ECF, 0x7269, 0x9B92, 0x5206, 0x543B, 0x5674, 0x58B3, 0x61A4, 0x626E,
+            0x711A, 0x596E, 0x7C89, 0x7CDE, 0x7D1B, 0x96F0, 0x6587, 0x805E, 0x4E19, 0x4F75, 0x5175, 0x5840, 0x5E63, 0x5E73, 0x5F0A, 0x67C4,
+            0x4E26, 0x853D, 0x9589, 0x965B, 0x7C73, 0x9801, 0x50FB, 0x58C1, 0x7656, 0x78A7, 0x5225, 0x77A5, 0x8511, 0x7B86, 0x504F, 0x5909,
+            0x7247, 0x7BC7, 0x7DE8, 0x8FBA, 0x8FD4, 0x904D, 0x4FBF, 0x52C9, 0x5A29, 0x5F01, 0x97AD, 0x4FDD, 0x8217, 0x92EA, 0x5703, 0x6355,
+            0x6B69, 0x752B, 0x88DC, 0x8F14, 0x7A42, 0x52DF, 0x5893, 0x6155, 0x620A, 0x66AE, 0x6BCD, 0x7C3F, 0x83E9, 0x5023, 0x4FF8, 0x5305,
+            0x5446, 0x5831, 0x5949, 0x5B9D, 0x5CF0, 0x5CEF, 0x5D29, 0x5E96, 0x62B1, 0x6367, 0x653E, 0x65B9, 0x670B
+        },
+        // 0x96
+        {
+            0x6CD5, 0x6CE1, 0x70F9, 0x7832, 0x7E2B, 0x80DE, 0x82B3, 0x840C, 0x84EC, 0x8702, 0x8912, 0x8A2A, 0x8C4A, 0x90A6, 0x92D2, 0x98FD,
+            0x9CF3, 0x9D6C, 0x4E4F, 0x4EA1, 0x508D, 0x5256, 0x574A, 0x59A8, 0x5E3D, 0x5FD8, 0x5FD9, 0x623F, 0x66B4, 0x671B, 0x67D0, 0x68D2,
+            0x5192, 0x7D21, 0x80AA, 0x81A8, 0x8B00, 0x8C8C, 0x8CBF, 0x927E, 0x9632, 0x5420, 0x982C, 0x5317, 0x50D5, 0x535C, 0x58A8, 0x64B2,
+            0x6734, 0x7267, 0x7766, 0x7A46, 0x91E6, 0x52C3, 0x6CA1, 0x6B86, 0x5800, 0x5E4C, 0x5954, 0x672C, 0x7FFB, 0x51E1, 0x76C6, 0xFFFD,
+            0x6469, 0x78E8, 0x9B54, 0x9EBB, 0x57CB, 0x59B9, 0x6627, 0x679A, 0x6BCE, 0x54E9, 0x69D9, 0x5E55, 0x819C, 0x6795, 0x9BAA, 0x67FE,
+            0x9C52, 0x685D, 0x4EA6, 0x4FE3, 0x53C8, 0x62B9, 0x672B, 0x6CAB, 0x8FC4, 0x4FAD, 0x7E6D, 0x9EBF, 0x4E07, 0x6162, 0x6E80, 0x6F2B,
+            0x8513, 0x5473, 0x672A, 0x9B45, 0x5DF3, 0x7B95, 0x5CAC, 0x5BC6, 0x871C, 0x6E4A, 0x84D1, 0x7A14, 0x8108, 0x5999, 0x7C8D, 0x6C11,
+            0x7720, 0x52D9, 0x5922, 0x7121, 0x725F, 0x77DB, 0x9727, 0x9D61, 0x690B, 0x5A7F, 0x5A18, 0x51A5, 0x540D, 0x547D, 0x660E, 0x76DF,
+            0x8FF7, 0x9298, 0x9CF4, 0x59EA, 0x725D, 0x6EC5, 0x514D, 0x68C9, 0x7DBF, 0x7DEC, 0x9762, 0x9EBA, 0x6478, 0x6A21, 0x8302, 0x5984,
+            0x5B5F, 0x6BDB, 0x731B, 0x76F2, 0x7DB2, 0x8017, 0x8499, 0x5132, 0x6728, 0x9ED9, 0x76EE, 0x6762, 0x52FF, 0x9905, 0x5C24, 0x623B,
+            0x7C7E, 0x8CB0, 0x554F, 0x60B6, 0x7D0B, 0x9580, 0x5301, 0x4E5F, 0x51B6, 0x591C, 0x723A, 0x8036, 0x91CE, 0x5F25, 0x77E2, 0x5384,
+            0x5F79, 0x7D04, 0x85AC, 0x8A33, 0x8E8D, 0x9756, 0x67F3, 0x85AE, 0x9453, 0x6109, 0x6108, 0x6CB9, 0x7652
+        },
+        // 0x97
+        {
+            0x8AED, 0x8F38, 0x552F, 0x4F51, 0x512A, 0x52C7, 0x53CB, 0x5BA5, 0x5E7D, 0x60A0, 0x6182, 0x63D6, 0x6709, 0x67DA, 0x6E67, 0x6D8C,
+            0x7336, 0x7337, 0x7531, 0x7950, 0x88D5, 0x8A98, 0x904A, 0x9091, 0x90F5, 0x96C4, 0x878D, 0x5915, 0x4E88, 0x4F59, 0x4E0E, 0x8A89,
+            0x8F3F, 0x9810, 0x50AD, 0x5E7C, 0x5996, 0x5BB9, 0x5EB8, 0x63DA, 0x63FA, 0x64C1, 0x66DC, 0x694A, 0x69D8, 0x6D0B, 0x6EB6, 0x7194,
+            0x7528, 0x7AAF, 0x7F8A, 0x8000, 0x8449, 0x84C9, 0x8981, 0x8B21, 0x8E0A, 0x9065, 0x967D, 0x990A, 0x617E, 0x6291, 0x6B32, 0xFFFD,
+            0x6C83, 0x6D74, 0x7FCC, 0x7FFC, 0x6DC0, 0x7F85, 0x87BA, 0x88F8, 0x6765, 0x83B1, 0x983C, 0x96F7, 0x6D1B, 0x7D61, 0x843D, 0x916A,
+            0x4E71, 0x5375, 0x5D50, 0x6B04, 0x6FEB, 0x85CD, 0x862D, 0x89A7, 0x5229, 0x540F, 0x5C65, 0x674E, 0x68A8, 0x7406, 0x7483, 0x75E2,
+            0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x9678, 0x5F8B, 0x7387, 0x7ACB, 0x844E, 0x63A0, 0x7565, 0x5289, 0x6D41, 0x6E9C, 0x7409, 0x7559,
+            0x786B, 0x7C92, 0x9686, 0x7ADC, 0x9F8D, 0x4FB6, 0x616E, 0x65C5, 0x865C, 0x4E86, 0x4EAE, 0x50DA, 0x4E21, 0x51CC, 0x5BEE, 0x6599,
+            0x6881, 0x6DBC, 0x731F, 0x7642, 0x77AD, 0x7A1C, 0x7CE7, 0x826F, 0x8AD2, 0x907C, 0x91CF, 0x9675, 0x9818, 0x529B, 0x7DD1, 0x502B,
+            0x5398, 0x6797, 0x6DCB, 0x71D0, 0x7433, 0x81E8, 0x8F2A, 0x96A3, 0x9C57, 0x9E9F, 0x7460, 0x5841, 0x6D99, 0x7D2F, 0x985E, 0x4EE4,
+            0x4F36, 0x4F8B, 0x51B7, 0x52B1, 0x5DBA, 0x601C, 0x73B2, 0x793C, 0x82D3, 0x9234, 0x96B7, 0x96F6, 0x970A, 0x9E97, 0x9F62, 0x66A6,
+            0x6B74, 0x5217, 0x52A3, 0x70C8, 0x88C2, 0x5EC9, 0x604B, 0x6190, 0x6F23, 0x7149, 0x7C3E, 0x7DF4, 0x806F
+        },
+        // 0x98
+        {
+            0x84EE, 0x9023, 0x932C, 0x5442, 0x9B6F, 0x6AD3, 0x7089, 0x8CC2, 0x8DEF, 0x9732, 0x52B4, 0x5A41, 0x5ECA, 0x5F04, 0x6717, 0x697C,
+            0x6994, 0x6D6A, 0x6F0F, 0x7262, 0x72FC, 0x7BED, 0x8001, 0x807E, 0x874B, 0x90CE, 0x516D, 0x9E93, 0x7984, 0x808B, 0x9332, 0x8AD6,
+            0x502D, 0x548C, 0x8A71, 0x6B6A, 0x8CC4, 0x8107, 0x60D1, 0x67A0, 0x9DF2, 0x4E99, 0x4E98, 0x9C10, 0x8A6B, 0x85C1, 0x8568, 0x6900,
+            0x6E7E, 0x7897, 0x8155, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x5F0C,
+            0x4E10, 0x4E15, 0x4E2A, 0x4E31, 0x4E36, 0x4E3C, 0x4E3F, 0x4E42, 0x4E56, 0x4E58, 0x4E82, 0x4E85, 0x8C6B, 0x4E8A, 0x8212, 0x5F0D,
+            0x4E8E, 0x4E9E, 0x4E9F, 0x4EA0, 0x4EA2, 0x4EB0, 0x4EB3, 0x4EB6, 0x4ECE, 0x4ECD, 0x4EC4, 0x4EC6, 0x4EC2, 0x4ED7, 0x4EDE, 0x4EED,
+            0x4EDF, 0x4EF7, 0x4F09, 0x4F5A, 0x4F30, 0x4F5B, 0x4F5D, 0x4F57, 0x4F47, 0x4F76, 0x4F88, 0x4F8F, 0x4F98, 0x4F7B, 0x4F69, 0x4F70,
+            0x4F91, 0x4F6F, 0x4F86, 0x4F96, 0x5118, 0x4FD4, 0x4FDF, 0x4FCE, 0x4FD8, 0x4FDB, 0x4FD1, 0x4FDA, 0x4FD0, 0x4FE4, 0x4FE5, 0x501A,
+            0x5028, 0x5014, 0x502A, 0x5025, 0x5005, 0x4F1C, 0x4FF6, 0x5021, 0x5029, 0x502C, 0x4FFE, 0x4FEF, 0x5011, 0x5006, 0x5043, 0x5047,
+            0x6703, 0x5055, 0x5050, 0x5048, 0x505A, 0x5056, 0x506C, 0x5078, 0x5080, 0x509A, 0x5085, 0x50B4, 0x50B2
+        },
+        // 0x99
+        {
+            0x50C9, 0x50CA, 0x50B3, 0x50C2, 0x50D6, 0x50DE, 0x50E5, 0x50ED, 0x50E3, 0x50EE, 0x50F9, 0x50F5, 0x5109, 0x5101, 0x5102, 0x5116,
+            0x5115, 0x5114, 0x511A, 0x5121, 0x513A, 0x5137, 0x513C, 0x513B, 0x513F, 0x5140, 0x5152, 0x514C, 0x5154, 0x5162, 0x7AF8, 0x5169,
+            0x516A, 0x516E, 0x5180, 0x5182, 0x56D8, 0x518C, 0x5189, 0x518F, 0x5191, 0x5193, 0x5195, 0x5196, 0x51A4, 0x51A6, 0x51A2, 0x51A9,
+            0x51AA, 0x51AB, 0x51B3, 0x51B1, 0x51B2, 0x51B0, 0x51B5, 0x51BD, 0x51C5, 0x51C9, 0x51DB, 0x51E0, 0x8655, 0x51E9, 0x51ED, 0xFFFD,
+            0x51F0, 0x51F5, 0x51FE, 0x5204, 0x520B, 0x5214, 0x520E, 0x5227, 0x522A, 0x522E, 0x5233, 0x5239, 0x524F, 0x5244, 0x524B, 0x524C,
+            0x525E, 0x5254, 0x526A, 0x5274, 0x5269, 0x5273, 0x527F, 0x527D, 0x528D, 0x5294, 0x5292, 0x5271, 0x5288, 0x5291, 0x8FA8, 0x8FA7,
+            0x52AC, 0x52AD, 0x52BC, 0x52B5, 0x52C1, 0x52CD, 0x52D7, 0x52DE, 0x52E3, 0x52E6, 0x98ED, 0x52E0, 0x52F3, 0x52F5, 0x52F8, 0x52F9,
+            0x5306, 0x5308, 0x7538, 0x530D, 0x5310, 0x530F, 0x5315, 0x531A, 0x5323, 0x532F, 0x5331, 0x5333, 0x5338, 0x5340, 0x5346, 0x5345,
+            0x4E17, 0x5349, 0x534D, 0x51D6, 0x535E, 0x5369, 0x536E, 0x5918, 0x537B, 0x5377, 0x5382, 0x5396, 0x53A0, 0x53A6, 0x53A5, 0x53AE,
+            0x53B0, 0x53B6, 0x53C3, 0x7C12, 0x96D9, 0x53DF, 0x66FC, 0x71EE, 0x53EE, 0x53E8, 0x53ED, 0x53FA, 0x5401, 0x543D, 0x5440, 0x542C,
+            0x542D, 0x543C, 0x542E, 0x5436, 0x5429, 0x541D, 0x544E, 0x548F, 0x5475, 0x548E, 0x545F, 0x5471, 0x5477, 0x5470, 0x5492, 0x547B,
+            0x5480, 0x5476, 0x5484, 0x5490, 0x5486, 0x54C7, 0x54A2, 0x54B8, 0x54A5, 0x54AC, 0x54C4, 0x54C8, 0x54A8
+        },
+        // 0x9A
+        {
+            0x54AB, 0x54C2, 0x54A4, 0x54BE, 0x54BC, 0x54D8, 0x54E5, 0x54E6, 0x550F, 0x5514, 0x54FD, 0x54EE, 0x54ED, 0x54FA, 0x54E2, 0x5539,
+            0x5540, 0x5563, 0x554C, 0x552E, 0x555C, 0x5545, 0x5556, 0x5557, 0x5538, 0x5533, 0x555D, 0x5599, 0x5580, 0x54AF, 0x558A, 0x559F,
+            0x557B, 0x557E, 0x5598, 0x559E, 0x55AE, 0x557C, 0x5583, 0x55A9, 0x5587, 0x55A8, 0x55DA, 0x55C5, 0x55DF, 0x55C4, 0x55DC, 0x55E4,
+            0x55D4, 0x5614, 0x55F7, 0x5616, 0x55FE, 0x55FD, 0x561B, 0x55F9, 0x564E, 0x5650, 0x71DF, 0x5634, 0x5636, 0x5632, 0x5638, 0xFFFD,
+            0x566B, 0x5664, 0x562F, 0x566C, 0x566A, 0x5686, 0x5680, 0x568A, 0x56A0, 0x5694, 0x568F, 0x56A5, 0x56AE, 0x56B6, 0x56B4, 0x56C2,
+            0x56BC, 0x56C1, 0x56C3, 0x56C0, 0x56C8, 0x56CE, 0x56D1, 0x56D3, 0x56D7, 0x56EE, 0x56F9, 0x5700, 0x56FF, 0x5704, 0x5709, 0x5708,
+            0x570B, 0x570D, 0x5713, 0x5718, 0x5716, 0x55C7, 0x571C, 0x5726, 0x5737, 0x5738, 0x574E, 0x573B, 0x5740, 0x574F, 0x5769, 0x57C0,
+            0x5788, 0x5761, 0x577F, 0x5789, 0x5793, 0x57A0, 0x57B3, 0x57A4, 0x57AA, 0x57B0, 0x57C3, 0x57C6, 0x57D4, 0x57D2, 0x57D3, 0x580A,
+            0x57D6, 0x57E3, 0x580B, 0x5819, 0x581D, 0x5872, 0x5821, 0x5862, 0x584B, 0x5870, 0x6BC0, 0x5852, 0x583D, 0x5879, 0x5885, 0x58B9,
+            0x589F, 0x58AB, 0x58BA, 0x58DE, 0x58BB, 0x58B8, 0x58AE, 0x58C5, 0x58D3, 0x58D1, 0x58D7, 0x58D9, 0x58D8, 0x58E5, 0x58DC, 0x58E4,
+            0x58DF, 0x58EF, 0x58FA, 0x58F9, 0x58FB, 0x58FC, 0x58FD, 0x5902, 0x590A, 0x5910, 0x591B, 0x68A6, 0x5925, 0x592C, 0x592D, 0x5932,
+            0x5938, 0x593E, 0x7AD2, 0x5955, 0x5950, 0x594E, 0x595A, 0x5958, 0x5962, 0x5960, 0x5967, 0x596C, 0x5969
+        },
+        // 0x9B
+        {
+            0x5978, 0x5981, 0x599D, 0x4F5E, 0x4FAB, 0x59A3, 0x59B2, 0x59C6, 0x59E8, 0x59DC, 0x598D, 0x59D9, 0x59DA, 0x5A25, 0x5A1F, 0x5A11,
+            0x5A1C, 0x5A09, 0x5A1A, 0x5A40, 0x5A6C, 0x5A49, 0x5A35, 0x5A36, 0x5A62, 0x5A6A, 0x5A9A, 0x5ABC, 0x5ABE, 0x5ACB, 0x5AC2, 0x5ABD,
+            0x5AE3, 0x5AD7, 0x5AE6, 0x5AE9, 0x5AD6, 0x5AFA, 0x5AFB, 0x5B0C, 0x5B0B, 0x5B16, 0x5B32, 0x5AD0, 0x5B2A, 0x5B36, 0x5B3E, 0x5B43,
+            0x5B45, 0x5B40, 0x5B51, 0x5B55, 0x5B5A, 0x5B5B, 0x5B65, 0x5B69, 0x5B70, 0x5B73, 0x5B75, 0x5B78, 0x6588, 0x5B7A, 0x5B80, 0xFFFD,
+            0x5B83, 0x5BA6, 0x5BB8, 0x5BC3, 0x5BC7, 0x5BC9, 0x5BD4, 0x5BD0, 0x5BE4, 0x5BE6, 0x5BE2, 0x5BDE, 0x5BE5, 0x5BEB, 0x5BF0, 0x5BF6,
+            0x5BF3, 0x5C05, 0x5C07, 0x5C08, 0x5C0D, 0x5C13, 0x5C20, 0x5C22, 0x5C28, 0x5C38, 0x5C39, 0x5C41, 0x5C46, 0x5C4E, 0x5C53, 0x5C50,
+            0x5C4F, 0x5B71, 0x5C6C, 0x5C6E, 0x4E62, 0x5C76, 0x5C79, 0x5C8C, 0x5C91, 0x5C94, 0x599B, 0x5CAB, 0x5CBB, 0x5CB6, 0x5CBC, 0x5CB7,
+            0x5CC5, 0x5CBE, 0x5CC7, 0x5CD9, 0x5CE9, 0x5CFD, 0x5CFA, 0x5CED, 0x5D8C, 0x5CEA, 0x5D0B, 0x5D15, 0x5D17, 0x5D5C, 0x5D1F, 0x5D1B,
+            0x5D11, 0x5D14, 0x5D22, 0x5D1A, 0x5D19, 0x5D18, 0x5D4C, 0x5D52, 0x5D4E, 0x5D4B, 0x5D6C, 0x5D73, 0x5D76, 0x5D87, 0x5D84, 0x5D82,
+            0x5DA2, 0x5D9D, 0x5DAC, 0x5DAE, 0x5DBD, 0x5D90, 0x5DB7, 0x5DBC, 0x5DC9, 0x5DCD, 0x5DD3, 0x5DD2, 0x5DD6, 0x5DDB, 0x5DEB, 0x5DF2,
+            0x5DF5, 0x5E0B, 0x5E1A, 0x5E19, 0x5E11, 0x5E1B, 0x5E36, 0x5E37, 0x5E44, 0x5E43, 0x5E40, 0x5E4E, 0x5E57, 0x5E54, 0x5E5F, 0x5E62,
+            0x5E64, 0x5E47, 0x5E75, 0x5E76, 0x5E7A, 0x9EBC, 0x5E7F, 0x5EA0, 0x5EC1, 0x5EC2, 0x5EC8, 0x5ED0, 0x5ECF
+        },
+        // 0x9C
+        {
+            0x5ED6, 0x5EE3, 0x5EDD, 0x5EDA, 0x5EDB, 0x5EE2, 0x5EE1, 0x5EE8, 0x5EE9, 0x5EEC, 0x5EF1, 0x5EF3, 0x5EF0, 0x5EF4, 0x5EF8, 0x5EFE,
+            0x5F03, 0x5F09, 0x5F5D, 0x5F5C, 0x5F0B, 0x5F11, 0x5F16, 0x5F29, 0x5F2D, 0x5F38, 0x5F41, 0x5F48, 0x5F4C, 0x5F4E, 0x5F2F, 0x5F51,
+            0x5F56, 0x5F57, 0x5F59, 0x5F61, 0x5F6D, 0x5F73, 0x5F77, 0x5F83, 0x5F82, 0x5F7F, 0x5F8A, 0x5F88, 0x5F91, 0x5F87, 0x5F9E, 0x5F99,
+            0x5F98, 0x5FA0, 0x5FA8, 0x5FAD, 0x5FBC, 0x5FD6, 0x5FFB, 0x5FE4, 0x5FF8, 0x5FF1, 0x5FDD, 0x60B3, 0x5FFF, 0x6021, 0x6060, 0xFFFD,
+            0x6019, 0x6010, 0x6029, 0x600E, 0x6031, 0x601B, 0x6015, 0x602B, 0x6026, 0x600F, 0x603A, 0x605A, 0x6041, 0x606A, 0x6077, 0x605F,
+            0x604A, 0x6046, 0x604D, 0x6063, 0x6043, 0x6064, 0x6042, 0x606C, 0x606B, 0x6059, 0x6081, 0x608D, 0x60E7, 0x6083, 0x609A, 0x6084,
+            0x609B, 0x6096, 0x6097, 0x6092, 0x60A7, 0x608B, 0x60E1, 0x60B8, 0x60E0, 0x60D3, 0x60B4, 0x5FF0, 0x60BD, 0x60C6, 0x60B5, 0x60D8,
+            0x614D, 0x6115, 0x6106, 0x60F6, 0x60F7, 0x6100, 0x60F4, 0x60FA, 0x6103, 0x6121, 0x60FB, 0x60F1, 0x610D, 0x610E, 0x6147, 0x613E,
+            0x6128, 0x6127, 0x614A, 0x613F, 0x613C, 0x612C, 0x6134, 0x613D, 0x6142, 0x6144, 0x6173, 0x6177, 0x6158, 0x6159, 0x615A, 0x616B,
+            0x6174, 0x616F, 0x6165, 0x6171, 0x615F, 0x615D, 0x6153, 0x6175, 0x6199, 0x6196, 0x6187, 0x61AC, 0x6194, 0x619A, 0x618A, 0x6191,
+            0x61AB, 0x61AE, 0x61CC, 0x61CA, 0x61C9, 0x61F7, 0x61C8, 0x61C3, 0x61C6, 0x61BA, 0x61CB, 0x7F79, 0x61CD, 0x61E6, 0x61E3, 0x61F6,
+            0x61FA, 0x61F4, 0x61FF, 0x61FD, 0x61FC, 0x61FE, 0x6200, 0x6208, 0x6209, 0x620D, 0x620C, 0x6214, 0x621B
+        },
+        // 0x9D
+        {
+            0x621E, 0x6221, 0x622A, 0x622E, 0x6230, 0x6232, 0x6233, 0x6241, 0x624E, 0x625E, 0x6263, 0x625B, 0x6260, 0x6268, 0x627C, 0x6282,
+            0x6289, 0x627E, 0x6292, 0x6293, 0x6296, 0x62D4, 0x6283, 0x6294, 0x62D7, 0x62D1, 0x62BB, 0x62CF, 0x62FF, 0x62C6, 0x64D4, 0x62C8,
+            0x62DC, 0x62CC, 0x62CA, 0x62C2, 0x62C7, 0x629B, 0x62C9, 0x630C, 0x62EE, 0x62F1, 0x6327, 0x6302, 0x6308, 0x62EF, 0x62F5, 0x6350,
+            0x633E, 0x634D, 0x641C, 0x634F, 0x6396, 0x638E, 0x6380, 0x63AB, 0x6376, 0x63A3, 0x638F, 0x6389, 0x639F, 0x63B5, 0x636B, 0xFFFD,
+            0x6369, 0x63BE, 0x63E9, 0x63C0, 0x63C6, 0x63E3, 0x63C9, 0x63D2, 0x63F6, 0x63C4, 0x6416, 0x6434, 0x6406, 0x6413, 0x6426, 0x6436,
+            0x651D, 0x6417, 0x6428, 0x640F, 0x6467, 0x646F, 0x6476, 0x644E, 0x652A, 0x6495, 0x6493, 0x64A5, 0x64A9, 0x6488, 0x64BC, 0x64DA,
+            0x64D2, 0x64C5, 0x64C7, 0x64BB, 0x64D8, 0x64C2, 0x64F1, 0x64E7, 0x8209, 0x64E0, 0x64E1, 0x62AC, 0x64E3, 0x64EF, 0x652C, 0x64F6,
+            0x64F4, 0x64F2, 0x64FA, 0x6500, 0x64FD, 0x6518, 0x651C, 0x6505, 0x6524, 0x6523, 0x652B, 0x6534, 0x6535, 0x6537, 0x6536, 0x6538,
+            0x754B, 0x6548, 0x6556, 0x6555, 0x654D, 0x6558, 0x655E, 0x655D, 0x6572, 0x6578, 0x6582, 0x6583, 0x8B8A, 0x659B, 0x659F, 0x65AB,
+            0x65B7, 0x65C3, 0x65C6, 0x65C1, 0x65C4, 0x65CC, 0x65D2, 0x65DB, 0x65D9, 0x65E0, 0x65E1, 0x65F1, 0x6772, 0x660A, 0x6603, 0x65FB,
+            0x6773, 0x6635, 0x6636, 0x6634, 0x661C, 0x664F, 0x6644, 0x6649, 0x6641, 0x665E, 0x665D, 0x6664, 0x6667, 0x6668, 0x665F, 0x6662,
+            0x6670, 0x6683, 0x6688, 0x668E, 0x6689, 0x6684, 0x6698, 0x669D, 0x66C1, 0x66B9, 0x66C9, 0x66BE, 0x66BC
+        },
+        // 0x9E
+        {
+            0x66C4, 0x66B8, 0x66D6, 0x66DA, 0x66E0, 0x663F, 0x66E6, 0x66E9, 0x66F0, 0x66F5, 0x66F7, 0x670F, 0x6716, 0x671E, 0x6726, 0x6727,
+            0x9738, 0x672E, 0x673F, 0x6736, 0x6741, 0x6738, 0x6737, 0x6746, 0x675E, 0x6760, 0x6759, 0x6763, 0x6764, 0x6789, 0x6770, 0x67A9,
+            0x677C, 0x676A, 0x678C, 0x678B, 0x67A6, 0x67A1, 0x6785, 0x67B7, 0x67EF, 0x67B4, 0x67EC, 0x67B3, 0x67E9, 0x67B8, 0x67E4, 0x67DE,
+            0x67DD, 0x67E2, 0x67EE, 0x67B9, 0x67CE, 0x67C6, 0x67E7, 0x6A9C, 0x681E, 0x6846, 0x6829, 0x6840, 0x684D, 0x6832, 0x684E, 0xFFFD,
+            0x68B3, 0x682B, 0x6859, 0x6863, 0x6877, 0x687F, 0x689F, 0x688F, 0x68AD, 0x6894, 0x689D, 0x689B, 0x6883, 0x6AAE, 0x68B9, 0x6874,
+            0x68B5, 0x68A0, 0x68BA, 0x690F, 0x688D, 0x687E, 0x6901, 0x68CA, 0x6908, 0x68D8, 0x6922, 0x6926, 0x68E1, 0x690C, 0x68CD, 0x68D4,
+            0x68E7, 0x68D5, 0x6936, 0x6912, 0x6904, 0x68D7, 0x68E3, 0x6925, 0x68F9, 0x68E0, 0x68EF, 0x6928, 0x692A, 0x691A, 0x6923, 0x6921,
+            0x68C6, 0x6979, 0x6977, 0x695C, 0x6978, 0x696B, 0x6954, 0x697E, 0x696E, 0x6939, 0x6974, 0x693D, 0x6959, 0x6930, 0x6961, 0x695E,
+            0x695D, 0x6981, 0x696A, 0x69B2, 0x69AE, 0x69D0, 0x69BF, 0x69C1, 0x69D3, 0x69BE, 0x69CE, 0x5BE8, 0x69CA, 0x69DD, 0x69BB, 0x69C3,
+            0x69A7, 0x6A2E, 0x6991, 0x69A0, 0x699C, 0x6995, 0x69B4, 0x69DE, 0x69E8, 0x6A02, 0x6A1B, 0x69FF, 0x6B0A, 0x69F9, 0x69F2, 0x69E7,
+            0x6A05, 0x69B1, 0x6A1E, 0x69ED, 0x6A14, 0x69EB, 0x6A0A, 0x6A12, 0x6AC1, 0x6A23, 0x6A13, 0x6A44, 0x6A0C, 0x6A72, 0x6A36, 0x6A78,
+            0x6A47, 0x6A62, 0x6A59, 0x6A66, 0x6A48, 0x6A38, 0x6A22, 0x6A90, 0x6A8D, 0x6AA0, 0x6A84, 0x6AA2, 0x6AA3
+        },
+        // 0x9F
+        {
+            0x6A97, 0x8617, 0x6ABB, 0x6AC3, 0x6AC2, 0x6AB8, 0x6AB3, 0x6AAC, 0x6ADE, 0x6AD1, 0x6ADF, 0x6AAA, 0x6ADA, 0x6AEA, 0x6AFB, 0x6B05,
+            0x8616, 0x6AFA, 0x6B12, 0x6B16, 0x9B31, 0x6B1F, 0x6B38, 0x6B37, 0x76DC, 0x6B39, 0x98EE, 0x6B47, 0x6B43, 0x6B49, 0x6B50, 0x6B59,
+            0x6B54, 0x6B5B, 0x6B5F, 0x6B61, 0x6B78, 0x6B79, 0x6B7F, 0x6B80, 0x6B84, 0x6B83, 0x6B8D, 0x6B98, 0x6B95, 0x6B9E, 0x6BA4, 0x6BAA,
+            0x6BAB, 0x6BAF, 0x6BB2, 0x6BB1, 0x6BB3, 0x6BB7, 0x6BBC, 0x6BC6, 0x6BCB, 0x6BD3, 0x6BDF, 0x6BEC, 0x6BEB, 0x6BF3, 0x6BEF, 0xFFFD,
+            0x9EBE, 0x6C08, 0x6C13, 0x6C14, 0x6C1B, 0x6C24, 0x6C23, 0x6C5E, 0x6C55, 0x6C62, 0x6C6A, 0x6C82, 0x6C8D, 0x6C9A, 0x6C81, 0x6C9B,
+            0x6C7E, 0x6C68, 0x6C73, 0x6C92, 0x6C90, 0x6CC4, 0x6CF1, 0x6CD3, 0x6CBD, 0x6CD7, 0x6CC5, 0x6CDD, 0x6CAE, 0x6CB1, 0x6CBE, 0x6CBA,
+            0x6CDB, 0x6CEF, 0x6CD9, 0x6CEA, 0x6D1F, 0x884D, 0x6D36, 0x6D2B, 0x6D3D, 0x6D38, 0x6D19, 0x6D35, 0x6D33, 0x6D12, 0x6D0C, 0x6D63,
+            0x6D93, 0x6D64, 0x6D5A, 0x6D79, 0x6D59, 0x6D8E, 0x6D95, 0x6FE4, 0x6D85, 0x6DF9, 0x6E15, 0x6E0A, 0x6DB5, 0x6DC7, 0x6DE6, 0x6DB8,
+            0x6DC6, 0x6DEC, 0x6DDE, 0x6DCC, 0x6DE8, 0x6DD2, 0x6DC5, 0x6DFA, 0x6DD9, 0x6DE4, 0x6DD5, 0x6DEA, 0x6DEE, 0x6E2D, 0x6E6E, 0x6E2E,
+            0x6E19, 0x6E72, 0x6E5F, 0x6E3E, 0x6E23, 0x6E6B, 0x6E2B, 0x6E76, 0x6E4D, 0x6E1F, 0x6E43, 0x6E3A, 0x6E4E, 0x6E24, 0x6EFF, 0x6E1D,
+            0x6E38, 0x6E82, 0x6EAA, 0x6E98, 0x6EC9, 0x6EB7, 0x6ED3, 0x6EBD, 0x6EAF, 0x6EC4, 0x6EB2, 0x6ED4, 0x6ED5, 0x6E8F, 0x6EA5, 0x6EC2,
+            0x6E9F, 0x6F41, 0x6F11, 0x704C, 0x6EEC, 0x6EF8, 0x6EFE, 0x6F3F, 0x6EF2, 0x6F31, 0x6EEF, 0x6F32, 0x6ECC
+        },
+        // 0xE0
+        {
+            0x6F3E, 0x6F13, 0x6EF7, 0x6F86, 0x6F7A, 0x6F78, 0x6F81, 0x6F80, 0x6F6F, 0x6F5B, 0x6FF3, 0x6F6D, 0x6F82, 0x6F7C, 0x6F58, 0x6F8E,
+            0x6F91, 0x6FC2, 0x6F66, 0x6FB3, 0x6FA3, 0x6FA1, 0x6FA4, 0x6FB9, 0x6FC6, 0x6FAA, 0x6FDF, 0x6FD5, 0x6FEC, 0x6FD4, 0x6FD8, 0x6FF1,
+            0x6FEE, 0x6FDB, 0x7009, 0x700B, 0x6FFA, 0x7011, 0x7001, 0x700F, 0x6FFE, 0x701B, 0x701A, 0x6F74, 0x701D, 0x7018, 0x701F, 0x7030,
+            0x703E, 0x7032, 0x7051, 0x7063, 0x7099, 0x7092, 0x70AF, 0x70F1, 0x70AC, 0x70B8, 0x70B3, 0x70AE, 0x70DF, 0x70CB, 0x70DD, 0xFFFD,
+            0x70D9, 0x7109, 0x70FD, 0x711C, 0x7119, 0x7165, 0x7155, 0x7188, 0x7166, 0x7162, 0x714C, 0x7156, 0x716C, 0x718F, 0x71FB, 0x7184,
+            0x7195, 0x71A8, 0x71AC, 0x71D7, 0x71B9, 0x71BE, 0x71D2, 0x71C9, 0x71D4, 0x71CE, 0x71E0, 0x71EC, 0x71E7, 0x71F5, 0x71FC, 0x71F9,
+            0x71FF, 0x720D, 0x7210, 0x721B, 0x7228, 0x722D, 0x722C, 0x7230, 0x7232, 0x723B, 0x723C, 0x723F, 0x7240, 0x7246, 0x724B, 0x7258,
+            0x7274, 0x727E, 0x7282, 0x7281, 0x7287, 0x7292, 0x7296, 0x72A2, 0x72A7, 0x72B9, 0x72B2, 0x72C3, 0x72C6, 0x72C4, 0x72CE, 0x72D2,
+            0x72E2, 0x72E0, 0x72E1, 0x72F9, 0x72F7, 0x500F, 0x7317, 0x730A, 0x731C, 0x7316, 0x731D, 0x7334, 0x732F, 0x7329, 0x7325, 0x733E,
+            0x734E, 0x734F, 0x9ED8, 0x7357, 0x736A, 0x7368, 0x7370, 0x7378, 0x7375, 0x737B, 0x737A, 0x73C8, 0x73B3, 0x73CE, 0x73BB, 0x73C0,
+            0x73E5, 0x73EE, 0x73DE, 0x74A2, 0x7405, 0x746F, 0x7425, 0x73F8, 0x7432, 0x743A, 0x7455, 0x743F, 0x745F, 0x7459, 0x7441, 0x745C,
+            0x7469, 0x7470, 0x7463, 0x746A, 0x7476, 0x747E, 0x748B, 0x749E, 0x74A7, 0x74CA, 0x74CF, 0x74D4, 0x73F1
+        },
+        // 0xE1
+        {
+            0x74E0, 0x74E3, 0x74E7, 0x74E9, 0x74EE, 0x74F2, 0x74F0, 0x74F1, 0x74F8, 0x74F7, 0x7504, 0x7503, 0x7505, 0x750C, 0x750E, 0x750D,
+            0x7515, 0x7513, 0x751E, 0x7526, 0x752C, 0x753C, 0x7544, 0x754D, 0x754A, 0x7549, 0x755B, 0x7546, 0x755A, 0x7569, 0x7564, 0x7567,
+            0x756B, 0x756D, 0x7578, 0x7576, 0x7586, 0x7587, 0x7574, 0x758A, 0x7589, 0x7582, 0x7594, 0x759A, 0x759D, 0x75A5, 0x75A3, 0x75C2,
+            0x75B3, 0x75C3, 0x75B5, 0x75BD, 0x75B8, 0x75BC, 0x75B1, 0x75CD, 0x75CA, 0x75D2, 0x75D9, 0x75E3, 0x75DE, 0x75FE, 0x75FF, 0xFFFD,
+            0x75FC, 0x7601, 0x75F0, 0x75FA, 0x75F2, 0x75F3, 0x760B, 0x760D, 0x7609, 0x761F, 0x7627, 0x7620, 0x7621, 0x7622, 0x7624, 0x7634,
+            0x7630, 0x763B, 0x7647, 0x7648, 0x7646, 0x765C, 0x7658, 0x7661, 0x7662, 0x7668, 0x7669, 0x766A, 0x7667, 0x766C, 0x7670, 0x7672,
+            0x7676, 0x7678, 0x767C, 0x7680, 0x7683, 0x7688, 0x768B, 0x768E, 0x7696, 0x7693, 0x7699, 0x769A, 0x76B0, 0x76B4, 0x76B8, 0x76B9,
+            0x76BA, 0x76C2, 0x76CD, 0x76D6, 0x76D2, 0x76DE, 0x76E1, 0x76E5, 0x76E7, 0x76EA, 0x862F, 0x76FB, 0x7708, 0x7707, 0x7704, 0x7729,
+            0x7724, 0x771E, 0x7725, 0x7726, 0x771B, 0x7737, 0x7738, 0x7747, 0x775A, 0x7768, 0x776B, 0x775B, 0x7765, 0x777F, 0x777E, 0x7779,
+            0x778E, 0x778B, 0x7791, 0x77A0, 0x779E, 0x77B0, 0x77B6, 0x77B9, 0x77BF, 0x77BC, 0x77BD, 0x77BB, 0x77C7, 0x77CD, 0x77D7, 0x77DA,
+            0x77DC, 0x77E3, 0x77EE, 0x77FC, 0x780C, 0x7812, 0x7926, 0x7820, 0x792A, 0x7845, 0x788E, 0x7874, 0x7886, 0x787C, 0x789A, 0x788C,
+            0x78A3, 0x78B5, 0x78AA, 0x78AF, 0x78D1, 0x78C6, 0x78CB, 0x78D4, 0x78BE, 0x78BC, 0x78C5, 0x78CA, 0x78EC
+        },
+        // 0xE2
+        {
+            0x78E7, 0x78DA, 0x78FD, 0x78F4, 0x7907, 0x7912, 0x7911, 0x7919, 0x792C, 0x792B, 0x7940, 0x7960, 0x7957, 0x795F, 0x795A, 0x7955,
+            0x7953, 0x797A, 0x797F, 0x798A, 0x799D, 0x79A7, 0x9F4B, 0x79AA, 0x79AE, 0x79B3, 0x79B9, 0x79BA, 0x79C9, 0x79D5, 0x79E7, 0x79EC,
+            0x79E1, 0x79E3, 0x7A08, 0x7A0D, 0x7A18, 0x7A19, 0x7A20, 0x7A1F, 0x7980, 0x7A31, 0x7A3B, 0x7A3E, 0x7A37, 0x7A43, 0x7A57, 0x7A49,
+            0x7A61, 0x7A62, 0x7A69, 0x9F9D, 0x7A70, 0x7A79, 0x7A7D, 0x7A88, 0x7A97, 0x7A95, 0x7A98, 0x7A96, 0x7AA9, 0x7AC8, 0x7AB0, 0xFFFD,
+            0x7AB6, 0x7AC5, 0x7AC4, 0x7ABF, 0x9083, 0x7AC7, 0x7ACA, 0x7ACD, 0x7ACF, 0x7AD5, 0x7AD3, 0x7AD9, 0x7ADA, 0x7ADD, 0x7AE1, 0x7AE2,
+            0x7AE6, 0x7AED, 0x7AF0, 0x7B02, 0x7B0F, 0x7B0A, 0x7B06, 0x7B33, 0x7B18, 0x7B19, 0x7B1E, 0x7B35, 0x7B28, 0x7B36, 0x7B50, 0x7B7A,
+            0x7B04, 0x7B4D, 0x7B0B, 0x7B4C, 0x7B45, 0x7B75, 0x7B65, 0x7B74, 0x7B67, 0x7B70, 0x7B71, 0x7B6C, 0x7B6E, 0x7B9D, 0x7B98, 0x7B9F,
+            0x7B8D, 0x7B9C, 0x7B9A, 0x7B8B, 0x7B92, 0x7B8F, 0x7B5D, 0x7B99, 0x7BCB, 0x7BC1, 0x7BCC, 0x7BCF, 0x7BB4, 0x7BC6, 0x7BDD, 0x7BE9,
+            0x7C11, 0x7C14, 0x7BE6, 0x7BE5, 0x7C60, 0x7C00, 0x7C07, 0x7C13, 0x7BF3, 0x7BF7, 0x7C17, 0x7C0D, 0x7BF6, 0x7C23, 0x7C27, 0x7C2A,
+            0x7C1F, 0x7C37, 0x7C2B, 0x7C3D, 0x7C4C, 0x7C43, 0x7C54, 0x7C4F, 0x7C40, 0x7C50, 0x7C58, 0x7C5F, 0x7C64, 0x7C56, 0x7C65, 0x7C6C,
+            0x7C75, 0x7C83, 0x7C90, 0x7CA4, 0x7CAD, 0x7CA2, 0x7CAB, 0x7CA1, 0x7CA8, 0x7CB3, 0x7CB2, 0x7CB1, 0x7CAE, 0x7CB9, 0x7CBD, 0x7CC0,
+            0x7CC5, 0x7CC2, 0x7CD8, 0x7CD2, 0x7CDC, 0x7CE2, 0x9B3B, 0x7CEF, 0x7CF2, 0x7CF4, 0x7CF6, 0x7CFA, 0x7D06
+        },
+        // 0xE3
+        {
+            0x7D02, 0x7D1C, 0x7D15, 0x7D0A, 0x7D45, 0x7D4B, 0x7D2E, 0x7D32, 0x7D3F, 0x7D35, 0x7D46, 0x7D73, 0x7D56, 0x7D4E, 0x7D72, 0x7D68,
+            0x7D6E, 0x7D4F, 0x7D63, 0x7D93, 0x7D89, 0x7D5B, 0x7D8F, 0x7D7D, 0x7D9B, 0x7DBA, 0x7DAE, 0x7DA3, 0x7DB5, 0x7DC7, 0x7DBD, 0x7DAB,
+            0x7E3D, 0x7DA2, 0x7DAF, 0x7DDC, 0x7DB8, 0x7D9F, 0x7DB0, 0x7DD8, 0x7DDD, 0x7DE4, 0x7DDE, 0x7DFB, 0x7DF2, 0x7DE1, 0x7E05, 0x7E0A,
+            0x7E23, 0x7E21, 0x7E12, 0x7E31, 0x7E1F, 0x7E09, 0x7E0B, 0x7E22, 0x7E46, 0x7E66, 0x7E3B, 0x7E35, 0x7E39, 0x7E43, 0x7E37, 0xFFFD,
+            0x7E32, 0x7E3A, 0x7E67, 0x7E5D, 0x7E56, 0x7E5E, 0x7E59, 0x7E5A, 0x7E79, 0x7E6A, 0x7E69, 0x7E7C, 0x7E7B, 0x7E83, 0x7DD5, 0x7E7D,
+            0x8FAE, 0x7E7F, 0x7E88, 0x7E89, 0x7E8C, 0x7E92, 0x7E90, 0x7E93, 0x7E94, 0x7E96, 0x7E8E, 0x7E9B, 0x7E9C, 0x7F38, 0x7F3A, 0x7F45,
+            0x7F4C, 0x7F4D, 0x7F4E, 0x7F50, 0x7F51, 0x7F55, 0x7F54, 0x7F58, 0x7F5F, 0x7F60, 0x7F68, 0x7F69, 0x7F67, 0x7F78, 0x7F82, 0x7F86,
+            0x7F83, 0x7F88, 0x7F87, 0x7F8C, 0x7F94, 0x7F9E, 0x7F9D, 0x7F9A, 0x7FA3, 0x7FAF, 0x7FB2, 0x7FB9, 0x7FAE, 0x7FB6, 0x7FB8, 0x8B71,
+            0x7FC5, 0x7FC6, 0x7FCA, 0x7FD5, 0x7FD4, 0x7FE1, 0x7FE6, 0x7FE9, 0x7FF3, 0x7FF9, 0x98DC, 0x8006, 0x8004, 0x800B, 0x8012, 0x8018,
+            0x8019, 0x801C, 0x8021, 0x8028, 0x803F, 0x803B, 0x804A, 0x8046, 0x8052, 0x8058, 0x805A, 0x805F, 0x8062, 0x8068, 0x8073, 0x8072,
+            0x8070, 0x8076, 0x8079, 0x807D, 0x807F, 0x8084, 0x8086, 0x8085, 0x809B, 0x8093, 0x809A, 0x80AD, 0x5190, 0x80AC, 0x80DB, 0x80E5,
+            0x80D9, 0x80DD, 0x80C4, 0x80DA, 0x80D6, 0x8109, 0x80EF, 0x80F1, 0x811B, 0x8129, 0x8123, 0x812F, 0x814B
+        },
+        // 0xE4
+        {
+            0x968B, 0x8146, 0x813E, 0x8153, 0x8151, 0x80FC, 0x8171, 0x816E, 0x8165, 0x8166, 0x8174, 0x8183, 0x8188, 0x818A, 0x8180, 0x8182,
+            0x81A0, 0x8195, 0x81A4, 0x81A3, 0x815F, 0x8193, 0x81A9, 0x81B0, 0x81B5, 0x81BE, 0x81B8, 0x81BD, 0x81C0, 0x81C2, 0x81BA, 0x81C9,
+            0x81CD, 0x81D1, 0x81D9, 0x81D8, 0x81C8, 0x81DA, 0x81DF, 0x81E0, 0x81E7, 0x81FA, 0x81FB, 0x81FE, 0x8201, 0x8202, 0x8205, 0x8207,
+            0x820A, 0x820D, 0x8210, 0x8216, 0x8229, 0x822B, 0x8238, 0x8233, 0x8240, 0x8259, 0x8258, 0x825D, 0x825A, 0x825F, 0x8264, 0xFFFD,
+            0x8262, 0x8268, 0x826A, 0x826B, 0x822E, 0x8271, 0x8277, 0x8278, 0x827E, 0x828D, 0x8292, 0x82AB, 0x829F, 0x82BB, 0x82AC, 0x82E1,
+            0x82E3, 0x82DF, 0x82D2, 0x82F4, 0x82F3, 0x82FA, 0x8393, 0x8303, 0x82FB, 0x82F9, 0x82DE, 0x8306, 0x82DC, 0x8309, 0x82D9, 0x8335,
+            0x8334, 0x8316, 0x8332, 0x8331, 0x8340, 0x8339, 0x8350, 0x8345, 0x832F, 0x832B, 0x8317, 0x8318, 0x8385, 0x839A, 0x83AA, 0x839F,
+            0x83A2, 0x8396, 0x8323, 0x838E, 0x8387, 0x838A, 0x837C, 0x83B5, 0x8373, 0x8375, 0x83A0, 0x8389, 0x83A8, 0x83F4, 0x8413, 0x83EB,
+            0x83CE, 0x83FD, 0x8403, 0x83D8, 0x840B, 0x83C1, 0x83F7, 0x8407, 0x83E0, 0x83F2, 0x840D, 0x8422, 0x8420, 0x83BD, 0x8438, 0x8506,
+            0x83FB, 0x846D, 0x842A, 0x843C, 0x855A, 0x8484, 0x8477, 0x846B, 0x84AD, 0x846E, 0x8482, 0x8469, 0x8446, 0x842C, 0x846F, 0x8479,
+            0x8435, 0x84CA, 0x8462, 0x84B9, 0x84BF, 0x849F, 0x84D9, 0x84CD, 0x84BB, 0x84DA, 0x84D0, 0x84C1, 0x84C6, 0x84D6, 0x84A1, 0x8521,
+            0x84FF, 0x84F4, 0x8517, 0x8518, 0x852C, 0x851F, 0x8515, 0x8514, 0x84FC, 0x8540, 0x8563, 0x8558, 0x8548
+        },
+        // 0xE5
+        {
+            0x8541, 0x8602, 0x854B, 0x8555, 0x8580, 0x85A4, 0x8588, 0x8591, 0x858A, 0x85A8, 0x856D, 0x8594, 0x859B, 0x85EA, 0x8587, 0x859C,
+            0x8577, 0x857E, 0x8590, 0x85C9, 0x85BA, 0x85CF, 0x85B9, 0x85D0, 0x85D5, 0x85DD, 0x85E5, 0x85DC, 0x85F9, 0x860A, 0x8613, 0x860B,
+            0x85FE, 0x85FA, 0x8606, 0x8622, 0x861A, 0x8630, 0x863F, 0x864D, 0x4E55, 0x8654, 0x865F, 0x8667, 0x8671, 0x8693, 0x86A3, 0x86A9,
+            0x86AA, 0x868B, 0x868C, 0x86B6, 0x86AF, 0x86C4, 0x86C6, 0x86B0, 0x86C9, 0x8823, 0x86AB, 0x86D4, 0x86DE, 0x86E9, 0x86EC, 0xFFFD,
+            0x86DF, 0x86DB, 0x86EF, 0x8712, 0x8706, 0x8708, 0x8700, 0x8703, 0x86FB, 0x8711, 0x8709, 0x870D, 0x86F9, 0x870A, 0x8734, 0x873F,
+            0x8737, 0x873B, 0x8725, 0x8729, 0x871A, 0x8760, 0x875F, 0x8778, 0x874C, 0x874E, 0x8774, 0x8757, 0x8768, 0x876E, 0x8759, 0x8753,
+            0x8763, 0x876A, 0x8805, 0x87A2, 0x879F, 0x8782, 0x87AF, 0x87CB, 0x87BD, 0x87C0, 0x87D0, 0x96D6, 0x87AB, 0x87C4, 0x87B3, 0x87C7,
+            0x87C6, 0x87BB, 0x87EF, 0x87F2, 0x87E0, 0x880F, 0x880D, 0x87FE, 0x87F6, 0x87F7, 0x880E, 0x87D2, 0x8811, 0x8816, 0x8815, 0x8822,
+            0x8821, 0x8831, 0x8836, 0x8839, 0x8827, 0x883B, 0x8844, 0x8842, 0x8852, 0x8859, 0x885E, 0x8862, 0x886B, 0x8881, 0x887E, 0x889E,
+            0x8875, 0x887D, 0x88B5, 0x8872, 0x8882, 0x8897, 0x8892, 0x88AE, 0x8899, 0x88A2, 0x888D, 0x88A4, 0x88B0, 0x88BF, 0x88B1, 0x88C3,
+            0x88C4, 0x88D4, 0x88D8, 0x88D9, 0x88DD, 0x88F9, 0x8902, 0x88FC, 0x88F4, 0x88E8, 0x88F2, 0x8904, 0x890C, 0x890A, 0x8913, 0x8943,
+            0x891E, 0x8925, 0x892A, 0x892B, 0x8941, 0x8944, 0x893B, 0x8936, 0x8938, 0x894C, 0x891D, 0x8960, 0x895E
+        },
+        // 0xE6
+        {
+            0x8966, 0x8964, 0x896D, 0x896A, 0x896F, 0x8974, 0x8977, 0x897E, 0x8983, 0x8988, 0x898A, 0x8993, 0x8998, 0x89A1, 0x89A9, 0x89A6,
+            0x89AC, 0x89AF, 0x89B2, 0x89BA, 0x89BD, 0x89BF, 0x89C0, 0x89DA, 0x89DC, 0x89DD, 0x89E7, 0x89F4, 0x89F8, 0x8A03, 0x8A16, 0x8A10,
+            0x8A0C, 0x8A1B, 0x8A1D, 0x8A25, 0x8A36, 0x8A41, 0x8A5B, 0x8A52, 0x8A46, 0x8A48, 0x8A7C, 0x8A6D, 0x8A6C, 0x8A62, 0x8A85, 0x8A82,
+            0x8A84, 0x8AA8, 0x8AA1, 0x8A91, 0x8AA5, 0x8AA6, 0x8A9A, 0x8AA3, 0x8AC4, 0x8ACD, 0x8AC2, 0x8ADA, 0x8AEB, 0x8AF3, 0x8AE7, 0xFFFD,
+            0x8AE4, 0x8AF1, 0x8B14, 0x8AE0, 0x8AE2, 0x8AF7, 0x8ADE, 0x8ADB, 0x8B0C, 0x8B07, 0x8B1A, 0x8AE1, 0x8B16, 0x8B10, 0x8B17, 0x8B20,
+            0x8B33, 0x97AB, 0x8B26, 0x8B2B, 0x8B3E, 0x8B28, 0x8B41, 0x8B4C, 0x8B4F, 0x8B4E, 0x8B49, 0x8B56, 0x8B5B, 0x8B5A, 0x8B6B, 0x8B5F,
+            0x8B6C, 0x8B6F, 0x8B74, 0x8B7D, 0x8B80, 0x8B8C, 0x8B8E, 0x8B92, 0x8B93, 0x8B96, 0x8B99, 0x8B9A, 0x8C3A, 0x8C41, 0x8C3F, 0x8C48,
+            0x8C4C, 0x8C4E, 0x8C50, 0x8C55, 0x8C62, 0x8C6C, 0x8C78, 0x8C7A, 0x8C82, 0x8C89, 0x8C85, 0x8C8A, 0x8C8D, 0x8C8E, 0x8C94, 0x8C7C,
+            0x8C98, 0x621D, 0x8CAD, 0x8CAA, 0x8CBD, 0x8CB2, 0x8CB3, 0x8CAE, 0x8CB6, 0x8CC8, 0x8CC1, 0x8CE4, 0x8CE3, 0x8CDA, 0x8CFD, 0x8CFA,
+            0x8CFB, 0x8D04, 0x8D05, 0x8D0A, 0x8D07, 0x8D0F, 0x8D0D, 0x8D10, 0x9F4E, 0x8D13, 0x8CCD, 0x8D14, 0x8D16, 0x8D67, 0x8D6D, 0x8D71,
+            0x8D73, 0x8D81, 0x8D99, 0x8DC2, 0x8DBE, 0x8DBA, 0x8DCF, 0x8DDA, 0x8DD6, 0x8DCC, 0x8DDB, 0x8DCB, 0x8DEA, 0x8DEB, 0x8DDF, 0x8DE3,
+            0x8DFC, 0x8E08, 0x8E09, 0x8DFF, 0x8E1D, 0x8E1E, 0x8E10, 0x8E1F, 0x8E42, 0x8E35, 0x8E30, 0x8E34, 0x8E4A
+        },
+        // 0xE7
+        {
+            0x8E47, 0x8E49, 0x8E4C, 0x8E50, 0x8E48, 0x8E59, 0x8E64, 0x8E60, 0x8E2A, 0x8E63, 0x8E55, 0x8E76, 0x8E72, 0x8E7C, 0x8E81, 0x8E87,
+            0x8E85, 0x8E84, 0x8E8B, 0x8E8A, 0x8E93, 0x8E91, 0x8E94, 0x8E99, 0x8EAA, 0x8EA1, 0x8EAC, 0x8EB0, 0x8EC6, 0x8EB1, 0x8EBE, 0x8EC5,
+            0x8EC8, 0x8ECB, 0x8EDB, 0x8EE3, 0x8EFC, 0x8EFB, 0x8EEB, 0x8EFE, 0x8F0A, 0x8F05, 0x8F15, 0x8F12, 0x8F19, 0x8F13, 0x8F1C, 0x8F1F,
+            0x8F1B, 0x8F0C, 0x8F26, 0x8F33, 0x8F3B, 0x8F39, 0x8F45, 0x8F42, 0x8F3E, 0x8F4C, 0x8F49, 0x8F46, 0x8F4E, 0x8F57, 0x8F5C, 0xFFFD,
+            0x8F62, 0x8F63, 0x8F64, 0x8F9C, 0x8F9F, 0x8FA3, 0x8FAD, 0x8FAF, 0x8FB7, 0x8FDA, 0x8FE5, 0x8FE2, 0x8FEA, 0x8FEF, 0x9087, 0x8FF4,
+            0x9005, 0x8FF9, 0x8FFA, 0x9011, 0x9015, 0x9021, 0x900D, 0x901E, 0x9016, 0x900B, 0x9027, 0x9036, 0x9035, 0x9039, 0x8FF8, 0x904F,
+            0x9050, 0x9051, 0x9052, 0x900E, 0x9049, 0x903E, 0x9056, 0x9058, 0x905E, 0x9068, 0x906F, 0x9076, 0x96A8, 0x9072, 0x9082, 0x907D,
+            0x9081, 0x9080, 0x908A, 0x9089, 0x908F, 0x90A8, 0x90AF, 0x90B1, 0x90B5, 0x90E2, 0x90E4, 0x6248, 0x90DB, 0x9102, 0x9112, 0x9119,
+            0x9132, 0x9130, 0x914A, 0x9156, 0x9158, 0x9163, 0x9165, 0x9169, 0x9173, 0x9172, 0x918B, 0x9189, 0x9182, 0x91A2, 0x91AB, 0x91AF,
+            0x91AA, 0x91B5, 0x91B4, 0x91BA, 0x91C0, 0x91C1, 0x91C9, 0x91CB, 0x91D0, 0x91D6, 0x91DF, 0x91E1, 0x91DB, 0x91FC, 0x91F5, 0x91F6,
+            0x921E, 0x91FF, 0x9214, 0x922C, 0x9215, 0x9211, 0x925E, 0x9257, 0x9245, 0x9249, 0x9264, 0x9248, 0x9295, 0x923F, 0x924B, 0x9250,
+            0x929C, 0x9296, 0x9293, 0x929B, 0x925A, 0x92CF, 0x92B9, 0x92B7, 0x92E9, 0x930F, 0x92FA, 0x9344, 0x932E
+        },
+        // 0xE8
+        {
+            0x9319, 0x9322, 0x931A, 0x9323, 0x933A, 0x9335, 0x933B, 0x935C, 0x9360, 0x937C, 0x936E, 0x9356, 0x93B0, 0x93AC, 0x93AD, 0x9394,
+            0x93B9, 0x93D6, 0x93D7, 0x93E8, 0x93E5, 0x93D8, 0x93C3, 0x93DD, 0x93D0, 0x93C8, 0x93E4, 0x941A, 0x9414, 0x9413, 0x9403, 0x9407,
+            0x9410, 0x9436, 0x942B, 0x9435, 0x9421, 0x943A, 0x9441, 0x9452, 0x9444, 0x945B, 0x9460, 0x9462, 0x945E, 0x946A, 0x9229, 0x9470,
+            0x9475, 0x9477, 0x947D, 0x945A, 0x947C, 0x947E, 0x9481, 0x947F, 0x9582, 0x9587, 0x958A, 0x9594, 0x9596, 0x9598, 0x9599, 0xFFFD,
+            0x95A0, 0x95A8, 0x95A7, 0x95AD, 0x95BC, 0x95BB, 0x95B9, 0x95BE, 0x95CA, 0x6FF6, 0x95C3, 0x95CD, 0x95CC, 0x95D5, 0x95D4, 0x95D6,
+            0x95DC, 0x95E1, 0x95E5, 0x95E2, 0x9621, 0x9628, 0x962E, 0x962F, 0x9642, 0x964C, 0x964F, 0x964B, 0x9677, 0x965C, 0x965E, 0x965D,
+            0x965F, 0x9666, 0x9672, 0x966C, 0x968D, 0x9698, 0x9695, 0x9697, 0x96AA, 0x96A7, 0x96B1, 0x96B2, 0x96B0, 0x96B4, 0x96B6, 0x96B8,
+            0x96B9, 0x96CE, 0x96CB, 0x96C9, 0x96CD, 0x894D, 0x96DC, 0x970D, 0x96D5, 0x96F9, 0x9704, 0x9706, 0x9708, 0x9713, 0x970E, 0x9711,
+            0x970F, 0x9716, 0x9719, 0x9724, 0x972A, 0x9730, 0x9739, 0x973D, 0x973E, 0x9744, 0x9746, 0x9748, 0x9742, 0x9749, 0x975C, 0x9760,
+            0x9764, 0x9766, 0x9768, 0x52D2, 0x976B, 0x9771, 0x9779, 0x9785, 0x977C, 0x9781, 0x977A, 0x9786, 0x978B, 0x978F, 0x9790, 0x979C,
+            0x97A8, 0x97A6, 0x97A3, 0x97B3, 0x97B4, 0x97C3, 0x97C6, 0x97C8, 0x97CB, 0x97DC, 0x97ED, 0x9F4F, 0x97F2, 0x7ADF, 0x97F6, 0x97F5,
+            0x980F, 0x980C, 0x9838, 0x9824, 0x9821, 0x9837, 0x983D, 0x9846, 0x984F, 0x984B, 0x986B, 0x986F, 0x9870
+        },
+        // 0xE9
+        {
+            0x9871, 0x9874, 0x9873, 0x98AA, 0x98AF, 0x98B1, 0x98B6, 0x98C4, 0x98C3, 0x98C6, 0x98E9, 0x98EB, 0x9903, 0x9909, 0x9912, 0x9914,
+            0x9918, 0x9921, 0x991D, 0x991E, 0x9924, 0x9920, 0x992C, 0x992E, 0x993D, 0x993E, 0x9942, 0x9949, 0x9945, 0x9950, 0x994B, 0x9951,
+            0x9952, 0x994C, 0x9955, 0x9997, 0x9998, 0x99A5, 0x99AD, 0x99AE, 0x99BC, 0x99DF, 0x99DB, 0x99DD, 0x99D8, 0x99D1, 0x99ED, 0x99EE,
+            0x99F1, 0x99F2, 0x99FB, 0x99F8, 0x9A01, 0x9A0F, 0x9A05, 0x99E2, 0x9A19, 0x9A2B, 0x9A37, 0x9A45, 0x9A42, 0x9A40, 0x9A43, 0xFFFD,
+            0x9A3E, 0x9A55, 0x9A4D, 0x9A5B, 0x9A57, 0x9A5F, 0x9A62, 0x9A65, 0x9A64, 0x9A69, 0x9A6B, 0x9A6A, 0x9AAD, 0x9AB0, 0x9ABC, 0x9AC0,
+            0x9ACF, 0x9AD1, 0x9AD3, 0x9AD4, 0x9ADE, 0x9ADF, 0x9AE2, 0x9AE3, 0x9AE6, 0x9AEF, 0x9AEB, 0x9AEE, 0x9AF4, 0x9AF1, 0x9AF7, 0x9AFB,
+            0x9B06, 0x9B18, 0x9B1A, 0x9B1F, 0x9B22, 0x9B23, 0x9B25, 0x9B27, 0x9B28, 0x9B29, 0x9B2A, 0x9B2E, 0x9B2F, 0x9B32, 0x9B44, 0x9B43,
+            0x9B4F, 0x9B4D, 0x9B4E, 0x9B51, 0x9B58, 0x9B74, 0x9B93, 0x9B83, 0x9B91, 0x9B96, 0x9B97, 0x9B9F, 0x9BA0, 0x9BA8, 0x9BB4, 0x9BC0,
+            0x9BCA, 0x9BB9, 0x9BC6, 0x9BCF, 0x9BD1, 0x9BD2, 0x9BE3, 0x9BE2, 0x9BE4, 0x9BD4, 0x9BE1, 0x9C3A, 0x9BF2, 0x9BF1, 0x9BF0, 0x9C15,
+            0x9C14, 0x9C09, 0x9C13, 0x9C0C, 0x9C06, 0x9C08, 0x9C12, 0x9C0A, 0x9C04, 0x9C2E, 0x9C1B, 0x9C25, 0x9C24, 0x9C21, 0x9C30, 0x9C47,
+            0x9C32, 0x9C46, 0x9C3E, 0x9C5A, 0x9C60, 0x9C67, 0x9C76, 0x9C78, 0x9CE7, 0x9CEC, 0x9CF0, 0x9D09, 0x9D08, 0x9CEB, 0x9D03, 0x9D06,
+            0x9D2A, 0x9D26, 0x9DAF, 0x9D23, 0x9D1F, 0x9D44, 0x9D15, 0x9D12, 0x9D41, 0x9D3F, 0x9D3E, 0x9D46, 0x9D48
+        },
+        // 0xEA
+        {
+            0x9D5D, 0x9D5E, 0x9D64, 0x9D51, 0x9D50, 0x9D59, 0x9D72, 0x9D89, 0x9D87, 0x9DAB, 0x9D6F, 0x9D7A, 0x9D9A, 0x9DA4, 0x9DA9, 0x9DB2,
+            0x9DC4, 0x9DC1, 0x9DBB, 0x9DB8, 0x9DBA, 0x9DC6, 0x9DCF, 0x9DC2, 0x9DD9, 0x9DD3, 0x9DF8, 0x9DE6, 0x9DED, 0x9DEF, 0x9DFD, 0x9E1A,
+            0x9E1B, 0x9E1E, 0x9E75, 0x9E79, 0x9E7D, 0x9E81, 0x9E88, 0x9E8B, 0x9E8C, 0x9E92, 0x9E95, 0x9E91, 0x9E9D, 0x9EA5, 0x9EA9, 0x9EB8,
+            0x9EAA, 0x9EAD, 0x9761, 0x9ECC, 0x9ECE, 0x9ECF, 0x9ED0, 0x9ED4, 0x9EDC, 0x9EDE, 0x9EDD, 0x9EE0, 0x9EE5, 0x9EE8, 0x9EEF, 0xFFFD,
+            0x9EF4, 0x9EF6, 0x9EF7, 0x9EF9, 0x9EFB, 0x9EFC, 0x9EFD, 0x9F07, 0x9F08, 0x76B7, 0x9F15, 0x9F21, 0x9F2C, 0x9F3E, 0x9F4A, 0x9F52,
+            0x9F54, 0x9F63, 0x9F5F, 0x9F60, 0x9F61, 0x9F66, 0x9F67, 0x9F6C, 0x9F6A, 0x9F77, 0x9F72, 0x9F76, 0x9F95, 0x9F9C, 0x9FA0, 0x582F,
+            0x69C7, 0x9059, 0x7464, 0x51DC, 0x7199, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD
+        },
+        // 0xED
+        {
+            0x7E8A, 0x891C, 0x9348, 0x9288, 0x84DC, 0x4FC9, 0x70BB, 0x6631, 0x68C8, 0x92F9, 0x66FB, 0x5F45, 0x4E28, 0x4EE1, 0x4EFC, 0x4F00,
+            0x4F03, 0x4F39, 0x4F56, 0x4F92, 0x4F8A, 0x4F9A, 0x4F94, 0x4FCD, 0x5040, 0x5022, 0x4FFF, 0x501E, 0x5046, 0x5070, 0x5042, 0x5094,
+            0x50F4, 0x50D8, 0x514A, 0x5164, 0x519D, 0x51BE, 0x51EC, 0x5215, 0x529C, 0x52A6, 0x52C0, 0x52DB, 0x5300, 0x5307, 0x5324, 0x5372,
+            0x5393, 0x53B2, 0x53DD, 0xFA0E, 0x549C, 0x548A, 0x54A9, 0x54FF, 0x5586, 0x5759, 0x5765, 0x57AC, 0x57C8, 0x57C7, 0xFA0F, 0xFFFD,
+            0xFA10, 0x589E, 0x58B2, 0x590B, 0x5953, 0x595B, 0x595D, 0x5963, 0x59A4, 0x59BA, 0x5B56, 0x5BC0, 0x752F, 0x5BD8, 0x5BEC, 0x5C1E,
+            0x5CA6, 0x5CBA, 0x5CF5, 0x5D27, 0x5D53, 0xFA11, 0x5D42, 0x5D6D, 0x5DB8, 0x5DB9, 0x5DD0, 0x5F21, 0x5F34, 0x5F67, 0x5FB7, 0x5FDE,
+            0x605D, 0x6085, 0x608A, 0x60DE, 0x60D5, 0x6120, 0x60F2, 0x6111, 0x6137, 0x6130, 0x6198, 0x6213, 0x62A6, 0x63F5, 0x6460, 0x649D,
+            0x64CE, 0x654E, 0x6600, 0x6615, 0x663B, 0x6609, 0x662E, 0x661E, 0x6624, 0x6665, 0x6657, 0x6659, 0xFA12, 0x6673, 0x6699, 0x66A0,
+            0x66B2, 0x66BF, 0x66FA, 0x670E, 0xF929, 0x6766, 0x67BB, 0x6852, 0x67C0, 0x6801, 0x6844, 0x68CF, 0xFA13, 0x6968, 0xFA14, 0x6998,
+            0x69E2, 0x6A30, 0x6A6B, 0x6A46, 0x6A73, 0x6A7E, 0x6AE2, 0x6AE4, 0x6BD6, 0x6C3F, 0x6C5C, 0x6C86, 0x6C6F, 0x6CDA, 0x6D04, 0x6D87,
+            0x6D6F, 0x6D96, 0x6DAC, 0x6DCF, 0x6DF8, 0x6DF2, 0x6DFC, 0x6E39, 0x6E5C, 0x6E27, 0x6E3C, 0x6EBF, 0x6F88, 0x6FB5, 0x6FF5, 0x7005,
+            0x7007, 0x7028, 0x7085, 0x70AB, 0x710F, 0x7104, 0x715C, 0x7146, 0x7147, 0xFA15, 0x71C1, 0x71FE, 0x72B1
+        },
+        // 0xEE
+        {
+            0x72BE, 0x7324, 0xFA16, 0x7377, 0x73BD, 0x73C9, 0x73D6, 0x73E3, 0x73D2, 0x7407, 0x73F5, 0x7426, 0x742A, 0x7429, 0x742E, 0x7462,
+            0x7489, 0x749F, 0x7501, 0x756F, 0x7682, 0x769C, 0x769E, 0x769B, 0x76A6, 0xFA17, 0x7746, 0x52AF, 0x7821, 0x784E, 0x7864, 0x787A,
+            0x7930, 0xFA18, 0xFA19, 0xFA1A, 0x7994, 0xFA1B, 0x799B, 0x7AD1, 0x7AE7, 0xFA1C, 0x7AEB, 0x7B9E, 0xFA1D, 0x7D48, 0x7D5C, 0x7DB7,
+            0x7DA0, 0x7DD6, 0x7E52, 0x7F47, 0x7FA1, 0xFA1E, 0x8301, 0x8362, 0x837F, 0x83C7, 0x83F6, 0x8448, 0x84B4, 0x8553, 0x8559, 0xFFFD,
+            0x856B, 0xFA1F, 0x85B0, 0xFA20, 0xFA21, 0x8807, 0x88F5, 0x8A12, 0x8A37, 0x8A79, 0x8AA7, 0x8ABE, 0x8ADF, 0xFA22, 0x8AF6, 0x8B53,
+            0x8B7F, 0x8CF0, 0x8CF4, 0x8D12, 0x8D76, 0xFA23, 0x8ECF, 0xFA24, 0xFA25, 0x9067, 0x90DE, 0xFA26, 0x9115, 0x9127, 0x91DA, 0x91D7,
+            0x91DE, 0x91ED, 0x91EE, 0x91E4, 0x91E5, 0x9206, 0x9210, 0x920A, 0x923A, 0x9240, 0x923C, 0x924E, 0x9259, 0x9251, 0x9239, 0x9267,
+            0x92A7, 0x9277, 0x9278, 0x92E7, 0x92D7, 0x92D9, 0x92D0, 0xFA27, 0x92D5, 0x92E0, 0x92D3, 0x9325, 0x9321, 0x92FB, 0xFA28, 0x931E,
+            0x92FF, 0x931D, 0x9302, 0x9370, 0x9357, 0x93A4, 0x93C6, 0x93DE, 0x93F8, 0x9431, 0x9445, 0x9448, 0x9592, 0xF9DC, 0xFA29, 0x969D,
+            0x96AF, 0x9733, 0x973B, 0x9743, 0x974D, 0x974F, 0x9751, 0x9755, 0x9857, 0x9865, 0xFA2A, 0xFA2B, 0x9927, 0xFA2C, 0x999E, 0x9A4E,
+            0x9AD9, 0x9ADC, 0x9B75, 0x9B72, 0x9B8F, 0x9BB1, 0x9BBB, 0x9C00, 0x9D70, 0x9D6B, 0xFA2D, 0x9E19, 0x9ED1, 0xFFFD, 0xFFFD, 0x2170,
+            0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0xFFE2, 0xFFE4, 0xFF07, 0xFF02
+        },
+        // 0xFA
+        {
+            0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165,
+            0x2166, 0x2167, 0x2168, 0x2169, 0xFFE2, 0xFFE4, 0xFF07, 0xFF02, 0x3231, 0x2116, 0x2121, 0x2235, 0x7E8A, 0x891C, 0x9348, 0x9288,
+            0x84DC, 0x4FC9, 0x70BB, 0x6631, 0x68C8, 0x92F9, 0x66FB, 0x5F45, 0x4E28, 0x4EE1, 0x4EFC, 0x4F00, 0x4F03, 0x4F39, 0x4F56, 0x4F92,
+            0x4F8A, 0x4F9A, 0x4F94, 0x4FCD, 0x5040, 0x5022, 0x4FFF, 0x501E, 0x5046, 0x5070, 0x5042, 0x5094, 0x50F4, 0x50D8, 0x514A, 0xFFFD,
+            0x5164, 0x519D, 0x51BE, 0x51EC, 0x5215, 0x529C, 0x52A6, 0x52C0, 0x52DB, 0x5300, 0x5307, 0x5324, 0x5372, 0x5393, 0x53B2, 0x53DD,
+            0xFA0E, 0x549C, 0x548A, 0x54A9, 0x54FF, 0x5586, 0x5759, 0x5765, 0x57AC, 0x57C8, 0x57C7, 0xFA0F, 0xFA10, 0x589E, 0x58B2, 0x590B,
+            0x5953, 0x595B, 0x595D, 0x5963, 0x59A4, 0x59BA, 0x5B56, 0x5BC0, 0x752F, 0x5BD8, 0x5BEC, 0x5C1E, 0x5CA6, 0x5CBA, 0x5CF5, 0x5D27,
+            0x5D53, 0xFA11, 0x5D42, 0x5D6D, 0x5DB8, 0x5DB9, 0x5DD0, 0x5F21, 0x5F34, 0x5F67, 0x5FB7, 0x5FDE, 0x605D, 0x6085, 0x608A, 0x60DE,
+            0x60D5, 0x6120, 0x60F2, 0x6111, 0x6137, 0x6130, 0x6198, 0x6213, 0x62A6, 0x63F5, 0x6460, 0x649D, 0x64CE, 0x654E, 0x6600, 0x6615,
+            0x663B, 0x6609, 0x662E, 0x661E, 0x6624, 0x6665, 0x6657, 0x6659, 0xFA12, 0x6673, 0x6699, 0x66A0, 0x66B2, 0x66BF, 0x66FA, 0x670E,
+            0xF929, 0x6766, 0x67BB, 0x6852, 0x67C0, 0x6801, 0x6844, 0x68CF, 0xFA13, 0x6968, 0xFA14, 0x6998, 0x69E2, 0x6A30, 0x6A6B, 0x6A46,
+            0x6A73, 0x6A7E, 0x6AE2, 0x6AE4, 0x6BD6, 0x6C3F, 0x6C5C, 0x6C86, 0x6C6F, 0x6CDA, 0x6D04, 0x6D87, 0x6D6F
+        },
+        // 0xFB
+        {
+            0x6D96, 0x6DAC, 0x6DCF, 0x6DF8, 0x6DF2, 0x6DFC, 0x6E39, 0x6E5C, 0x6E27, 0x6E3C, 0x6EBF, 0x6F88, 0x6FB5, 0x6FF5, 0x7005, 0x7007,
+            0x7028, 0x7085, 0x70AB, 0x710F, 0x7104, 0x715C, 0x7146, 0x7147, 0xFA15, 0x71C1, 0x71FE, 0x72B1, 0x72BE, 0x7324, 0xFA16, 0x7377,
+            0x73BD, 0x73C9, 0x73D6, 0x73E3, 0x73D2, 0x7407, 0x73F5, 0x7426, 0x742A, 0x7429, 0x742E, 0x7462, 0x7489, 0x749F, 0x7501, 0x756F,
+            0x7682, 0x769C, 0x769E, 0x769B, 0x76A6, 0xFA17, 0x7746, 0x52AF, 0x7821, 0x784E, 0x7864, 0x787A, 0x7930, 0xFA18, 0xFA19, 0xFFFD,
+            0xFA1A, 0x7994, 0xFA1B, 0x799B, 0x7AD1, 0x7AE7, 0xFA1C, 0x7AEB, 0x7B9E, 0xFA1D, 0x7D48, 0x7D5C, 0x7DB7, 0x7DA0, 0x7DD6, 0x7E52,
+            0x7F47, 0x7FA1, 0xFA1E, 0x8301, 0x8362, 0x837F, 0x83C7, 0x83F6, 0x8448, 0x84B4, 0x8553, 0x8559, 0x856B, 0xFA1F, 0x85B0, 0xFA20,
+            0xFA21, 0x8807, 0x88F5, 0x8A12, 0x8A37, 0x8A79, 0x8AA7, 0x8ABE, 0x8ADF, 0xFA22, 0x8AF6, 0x8B53, 0x8B7F, 0x8CF0, 0x8CF4, 0x8D12,
+            0x8D76, 0xFA23, 0x8ECF, 0xFA24, 0xFA25, 0x9067, 0x90DE, 0xFA26, 0x9115, 0x9127, 0x91DA, 0x91D7, 0x91DE, 0x91ED, 0x91EE, 0x91E4,
+            0x91E5, 0x9206, 0x9210, 0x920A, 0x923A, 0x9240, 0x923C, 0x924E, 0x9259, 0x9251, 0x9239, 0x9267, 0x92A7, 0x9277, 0x9278, 0x92E7,
+            0x92D7, 0x92D9, 0x92D0, 0xFA27, 0x92D5, 0x92E0, 0x92D3, 0x9325, 0x9321, 0x92FB, 0xFA28, 0x931E, 0x92FF, 0x931D, 0x9302, 0x9370,
+            0x9357, 0x93A4, 0x93C6, 0x93DE, 0x93F8, 0x9431, 0x9445, 0x9448, 0x9592, 0xF9DC, 0xFA29, 0x969D, 0x96AF, 0x9733, 0x973B, 0x9743,
+            0x974D, 0x974F, 0x9751, 0x9755, 0x9857, 0x9865, 0xFA2A, 0xFA2B, 0x9927, 0xFA2C, 0x999E, 0x9A4E, 0x9AD9
+        },
+        // 0xFC
+        {
+            0x9ADC, 0x9B75, 0x9B72, 0x9B8F, 0x9BB1, 0x9BBB, 0x9C00, 0x9D70, 0x9D6B, 0xFA2D, 0x9E19, 0x9ED1, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD
+        }
+    };
+
+    /*
+        -> cshllink structure pointer
+        -> code page returned if the link has no ConsoleFEDataBlock or its code page is not supported
+        <- ConsoleFEDataBlock.CodePage or fallback
+    */
+    uint32_t cshllink_codePage(const cshllink *inputStruct, uint32_t fallback) {
+        if(inputStruct==NULL || inputStruct->cshllink_extdatablk.ConsoleFEDataBlock.info.BlockSignature!=_CSHLLINK_EDBLK_ConsoleFEDataBlockSig)
+            return fallback;
+        uint32_t codePage = inputStruct->cshllink_extdatablk.ConsoleFEDataBlock.CodePage;
+        if(codePage!=932 && _cshllink_cpTable(codePage)==NULL)
+            return fallback;
+        return codePage;
+    }
+
+    /*
+        -> ANSI string and its length in bytes
+        -> code page of src (0: CSHLLINK_CP_DEFAULT)
+        -> output buffer and its size in characters (NULL: only computes the length)
+        -> optional pointer receiving the length in characters of the UTF-16 string, without the terminator (may be NULL)
+        -- decodes src to a NUL terminated UTF-16 string, bytes not defined in the code page decode to U+FFFD. ASCII runs are widened 16 (SSE2) or 32 (AVX2) bytes at a time
+        <- on error this function will return -1 (0x31: dest too small, 0x32: unsupported code page), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_ansiToUtf16(const char *src, size_t len, uint32_t codePage, char16_t *dest, size_t size, size_t *written) {
+        #ifdef _CSHLLINK_SIMD_X86
+            return _cshllink_ansiDecodeLevel((const uint8_t *)src, len, codePage, dest, size, written, 0, _cshllink_simdLevel());
+        #else
+            return _cshllink_ansiDecodeLevel((const uint8_t *)src, len, codePage, dest, size, written, 0, 0);
+        #endif
+    }
+    /*
+        -> ANSI string and its length in bytes
+        -> code page of src (0: CSHLLINK_CP_DEFAULT)
+        -> output buffer and its size in bytes (NULL: only computes the length)
+        -> optional pointer receiving the length in bytes of the UTF-8 string, without the terminator (may be NULL)
+        -- decodes src to a NUL terminated UTF-8 string, bytes not defined in the code page decode to U+FFFD. ASCII runs are copied 16 (SSE2) or 32 (AVX2) bytes at a time
+        <- on error this function will return -1 (0x31: dest too small, 0x32: unsupported code page), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_ansiToUtf8(const char *src, size_t len, uint32_t codePage, char *dest, size_t size, size_t *written) {
+        #ifdef _CSHLLINK_SIMD_X86
+            return _cshllink_ansiDecodeLevel((const uint8_t *)src, len, codePage, dest, size, written, 1, _cshllink_simdLevel());
+        #else
+            return _cshllink_ansiDecodeLevel((const uint8_t *)src, len, codePage, dest, size, written, 1, 0);
+        #endif
     }
+        /*
+            cshllink_ansiToUtf16 (utf8: 0) or cshllink_ansiToUtf8 (utf8: 1) with a given kernel level (0: scalar, 1: SSE2, 2: AVX2 -- see _cshllink_simdLevel)
+        */
+        uint8_t _cshllink_ansiDecodeLevel(const uint8_t *src, size_t len, uint32_t codePage, void *dest, size_t size, size_t *written, int utf8, int level) {
+            if(src==NULL && len!=0)
+                _cshllink_errint(_CSHLLINK_ERR_NULLPA);
+            if(codePage==0)
+                codePage = CSHLLINK_CP_DEFAULT;
+            const uint16_t *table = _cshllink_cpTable(codePage);
+            if(table==NULL && codePage!=932)
+                _cshllink_errint(_CSHLLINK_ERR_CODEPAGE);
+            char *d8 = dest;
+            char16_t *d16 = dest;
+            size_t i=0, o=0;
+
+            while(i<len) {
+                #ifdef _CSHLLINK_SIMD_X86
+                    if(level>0) {
+                        size_t room = dest!=NULL ? size-o : SIZE_MAX, n;
+                        if(utf8)
+                            n = level==2 ? _cshllink_copyAsciiAVX2(src+i, len-i, dest!=NULL ? d8+o : NULL, room)
+                                         : _cshllink_copyAsciiSSE2(src+i, len-i, dest!=NULL ? d8+o : NULL, room);
+                        else
+                            n = level==2 ? _cshllink_widenAVX2(src+i, len-i, dest!=NULL ? d16+o : NULL, room)
+                                         : _cshllink_widenSSE2(src+i, len-i, dest!=NULL ? d16+o : NULL, room);
+                        i += n;
+                        o += n;
+                    }
+                #endif
+                // ASCII inline up to the next other byte, which goes through the table (then back to the vector kernel)
+                while(i<len && src[i]<0x80 && (dest==NULL || o<size)) {
+                    if(dest!=NULL) {
+                        if(utf8)
+                            d8[o] = src[i];
+                        else
+                            d16[o] = src[i];
+                    }
+                    i++;
+                    o++;
+                }
+                if(i<len) {
+                    uint16_t c = _cshllink_ansiChar(src, len, &i, table);
+                    size_t units = !utf8 || c<0x80 ? 1 : c<0x800 ? 2 : 3;
+                    if(dest!=NULL) {
+                        if(size-o<units)
+                            _cshllink_errint(_CSHLLINK_ERR_BUFSIZE);
+                        if(!utf8)
+                            d16[o] = c;
+                        else {
+                            uint8_t *d = (uint8_t *)d8+o;
+                            switch(units) {
+                                case 1:
+                                    d[0] = c;
+                                    break;
+                                case 2:
+                                    d[0] = 0xC0 | c>>6;
+                                    d[1] = 0x80 | (c&0x3F);
+                                    break;
+                                default:
+                                    d[0] = 0xE0 | c>>12;
+                                    d[1] = 0x80 | (c>>6&0x3F);
+                                    d[2] = 0x80 | (c&0x3F);
+                            }
+                        }
+                    }
+                    o += units;
+                }
+            }
+
+            //terminator
+            if(dest!=NULL) {
+                if(o>=size)
+                    _cshllink_errint(_CSHLLINK_ERR_BUFSIZE);
+                if(utf8)
+                    d8[o] = 0;
+                else
+                    d16[o] = 0;
+            }
+            if(written!=NULL)
+                *written = o;
+            return 0;
+        }
+        /*
+            table of the bytes 0x80-0xFF of a single-byte code page, NULL if codePage is not one
+        */
+        const uint16_t *_cshllink_cpTable(uint32_t codePage) {
+            switch(codePage) {
+                case 437: return _cshllink_cp437;
+                case 850: return _cshllink_cp850;
+                case 852: return _cshllink_cp852;
+                case 866: return _cshllink_cp866;
+                case 874: return _cshllink_cp874;
+                case 1250: return _cshllink_cp1250;
+                case 1251: return _cshllink_cp1251;
+                case 1252: return _cshllink_cp1252;
+                case 1253: return _cshllink_cp1253;
+                case 1254: return _cshllink_cp1254;
+                case 1255: return _cshllink_cp1255;
+                case 1256: return _cshllink_cp1256;
+                case 1257: return _cshllink_cp1257;
+                case 1258: return _cshllink_cp1258;
+                case 28591: return _cshllink_cp28591;
+                default: return NULL;
+            }
+        }
+        /*
+            decodes the character at src[*i] (a double-byte character takes two), advances *i (table: see _cshllink_cpTable, NULL: 932)
+        */
+        uint16_t _cshllink_ansiChar(const uint8_t *src, size_t len, size_t *i, const uint16_t *table) {
+            uint8_t b = src[(*i)++];
+            if(b<0x80)
+                return b;
+            if(table!=NULL)
+                return table[b-0x80];
+
+            // 932 single bytes: halfwidth katakana, 0x80, 0xA0 and 0xFD-0xFF
+            if(b>=0xA1 && b<=0xDF)
+                return 0xFF61 + (b-0xA1);
+            if(b==0x80)
+                return 0x0080;
+            if(b==0xA0)
+                return 0xF8F0;
+            if(b>=0xFD)
+                return 0xF8F1 + (b-0xFD);
+            // lead byte, trail byte 0x40-0xFC (except 0x7F)
+            if(*i>=len || src[*i]<0x40 || src[*i]==0x7F || src[*i]>0xFC)
+                return 0xFFFD;
+            uint8_t t = src[(*i)++];
+            if(b>=0xF0 && b<=0xF9)
+                return 0xE000 + (b-0xF0)*188 + (t-0x40) - (t>0x7F);
+            if(_cshllink_cp932lead[b-0x80]==0)
+                return 0xFFFD;
+            return _cshllink_cp932[_cshllink_cp932lead[b-0x80]-1][t-0x40];
+        }
+
+    #ifdef _CSHLLINK_SIMD_X86
+        /*
+            copies (UTF-8) or widens (UTF-16) the leading ASCII bytes of src into dest (NULL: counts only, room: characters available), 16 / 32 bytes at a time
+            <- number of bytes converted
+        */
+        __attribute__((target("sse2")))
+        size_t _cshllink_copyAsciiSSE2(const uint8_t *src, size_t len, char *dest, size_t room) {
+            size_t i=0;
+            for(; i+16<=len && i+16<=room; i+=16) {
+                __m128i v = _mm_loadu_si128((const __m128i *)(src+i));
+                int m = _mm_movemask_epi8(v);
+                // the whole block is stored, only the bytes up to the first non-ASCII one count
+                if(dest!=NULL)
+                    _mm_storeu_si128((__m128i *)(dest+i), v);
+                if(m)
+                    return i+__builtin_ctz(m);
+            }
+            return i;
+        }
+        __attribute__((target("avx2")))
+        size_t _cshllink_copyAsciiAVX2(const uint8_t *src, size_t len, char *dest, size_t room) {
+            size_t i=0;
+            for(; i+32<=len && i+32<=room; i+=32) {
+                __m256i v = _mm256_loadu_si256((const __m256i *)(src+i));
+                uint32_t m = _mm256_movemask_epi8(v);
+                if(dest!=NULL)
+                    _mm256_storeu_si256((__m256i *)(dest+i), v);
+                if(m)
+                    return i+__builtin_ctz(m);
+            }
+            // half block
+            if(i+16<=len && i+16<=room) {
+                __m128i v = _mm_loadu_si128((const __m128i *)(src+i));
+                int m = _mm_movemask_epi8(v);
+                if(dest!=NULL)
+                    _mm_storeu_si128((__m128i *)(dest+i), v);
+                return m ? i+__builtin_ctz(m) : i+16;
+            }
+            return i;
+        }
+        __attribute__((target("sse2")))
+        size_t _cshllink_widenSSE2(const uint8_t *src, size_t len, char16_t *dest, size_t room) {
+            const __m128i zero = _mm_setzero_si128();
+            size_t i=0;
+            for(; i+16<=len && i+16<=room; i+=16) {
+                __m128i v = _mm_loadu_si128((const __m128i *)(src+i));
+                int m = _mm_movemask_epi8(v);
+                if(dest!=NULL) {
+                    _mm_storeu_si128((__m128i *)(dest+i), _mm_unpacklo_epi8(v, zero));
+                    _mm_storeu_si128((__m128i *)(dest+i+8), _mm_unpackhi_epi8(v, zero));
+                }
+                if(m)
+                    return i+__builtin_ctz(m);
+            }
+            return i;
+        }
+        __attribute__((target("avx2")))
+        size_t _cshllink_widenAVX2(const uint8_t *src, size_t len, char16_t *dest, size_t room) {
+            size_t i=0;
+            for(; i+32<=len && i+32<=room; i+=32) {
+                __m256i v = _mm256_loadu_si256((const __m256i *)(src+i));
+                uint32_t m = _mm256_movemask_epi8(v);
+                if(dest!=NULL) {
+                    _mm256_storeu_si256((__m256i *)(dest+i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+                    _mm256_storeu_si256((__m256i *)(dest+i+16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+                }
+                if(m)
+                    return i+__builtin_ctz(m);
+            }
+            // half block
+            if(i+16<=len && i+16<=room) {
+                __m128i v = _mm_loadu_si128((const __m128i *)(src+i));
+                int m = _mm_movemask_epi8(v);
+                if(dest!=NULL)
+                    _mm256_storeu_si256((__m256i *)(dest+i), _mm256_cvtepu8_epi16(v));
+                return m ? i+__builtin_ctz(m) : i+16;
+            }
+            return i;
+        }
+    #endif
 
     #pragma endregion
\ No newline at end of file
@@ -46,7 +46,7 @@
         0x16            NULL pointer WorkingDir
         0x17            NULL pointer CommandLineArguments
         0x18            NULL pointer IconLocation
-        0x19            Unknown ExtraDataBlock Signature
+        0x19            Unknown ExtraDataBlock Signature (cshllink_getBlock)
         0x1A            ExtraDataBlock ConsoleDataBlock duplicate
         0x1B            ExtraDataBlock ConsoleFEDataBlock duplicate
         0x1C            ExtraDataBlock DarwinDataBlock duplicate
@@ -68,8 +68,24 @@
         0x2C            NULL pointer ExtraDataBlock EnvironmentVariableDataUnicode
         0x2D            NULL pointer ExtraDataBlock IconEnvironmentDataAnsi
         0x2E            NULL pointer ExtraDataBlock IconEnvironmentDataUnicode
-    */
-    extern uint8_t cshllink_error;
+        0x2F            Skipped sections cannot be written (not copied from the input by cshllink_trackDirty: modified, or input not kept), or cshllink_toCompact would drop their input
+        0x30            Invalid UTF-16 (unpaired surrogate)
+        0x31            Output buffer too small
+        0x32            Unsupported code page
+        0x33            Too many ExtraDataBlocks (more than 65535)
+        0x34            Invalid ExtraDataBlock handler or signature (cshllink_registerBlock)
+        0x35            Input not kept (cshllink_trackDirty needs cshllink_loadView, cshllink_loadMapped keep or cshllink_ctx.track, or the copy of the input could not be allocated)
+    */
+    // storage class of per-thread state (cshllink_error, error context)
+    #if defined(_MSC_VER)
+        #define _CSHLLINK_TLS __declspec(thread)
+    #elif defined(__STDC_VERSION__) && __STDC_VERSION__>=201112L
+        #define _CSHLLINK_TLS _Thread_local
+    #else
+        #define _CSHLLINK_TLS __thread
+    #endif
+    // last error code of the calling thread (compatibility, see cshllink_ctx / cshllink_lastError)
+    extern _CSHLLINK_TLS uint8_t cshllink_error;
     #define _CSHLLINK_ERR_FCL 0x01
     #define _CSHLLINK_ERR_FIO 0x02
     #define _CSHLLINK_ERR_NULLPA 0x03
@@ -116,7 +132,193 @@
     #define _CSHLLINK_ERRX_NULLPSTRENVDU 0x2C
     #define _CSHLLINK_ERRX_NULLPSTRIENVDA 0x2D
     #define _CSHLLINK_ERRX_NULLPSTRIENVDU 0x2E
-    #define _cshllink_errint(errorval) {cshllink_error=errorval; return -1;}
+    #define _CSHLLINK_ERR_SKIPPED 0x2F
+    #define _CSHLLINK_ERR_UTF16 0x30
+    #define _CSHLLINK_ERR_BUFSIZE 0x31
+    #define _CSHLLINK_ERR_CODEPAGE 0x32
+    #define _CSHLLINK_ERR_EDBLKNUM 0x33
+    #define _CSHLLINK_ERR_EDBLKHDL 0x34
+    #define _CSHLLINK_ERR_NOINPUT 0x35
+    #define _cshllink_errint(errorval) {_cshllink_seterr(errorval); return -1;}
+
+    /*
+        allocator hooks
+
+        - alloc / realloc / free follow the contract of malloc / realloc / free, user is passed as first argument
+        - installed globally (cshllink_setAllocator) or per call (cshllink_ctx.allocator)
+        - a loaded structure remembers its allocator (cshllink_allocator), the setters and cshllink_free use it
+        - free may be NULL: memory is released as a whole by the owner of the allocator (cshllink_arena), cshllink_free only clears the structure
+    */
+    typedef struct _cshllink_allocator{
+        void *(*alloc)(void *user, size_t size);
+        void *(*realloc)(void *user, void *ptr, size_t size);
+        void (*free)(void *user, void *ptr);
+        // passed unchanged to the functions above
+        void *user;
+    }cshllink_allocator;
+
+    /*
+        bump arena
+
+        - owns every field of the structures loaded with it (cshllink_loadFileArena, cshllink_loadBufferArena, or cshllink_ctx.allocator = &arena.allocator)
+        - a load reserves _CSHLLINK_ARENA_RESERVE(file size) bytes up front, blocks are only added if that bound is exceeded
+        - cshllink_arena_reset releases all structures at once (keeps the newest block), cshllink_arena_free returns all blocks
+        - must not be moved after cshllink_arena_init (allocator.user points to it)
+    */
+    // alignment of arena allocations
+    #define _CSHLLINK_ARENA_ALIGN 8
+    // bytes reserved for a shell link of "size" bytes (decoded strings and blobs never exceed the input, plus IDList arrays and allocation headers)
+    #define _CSHLLINK_ARENA_RESERVE(size) ((size)*2 + 0x400)
+        struct _cshllink_arenablk{
+            // previous (older) block
+            struct _cshllink_arenablk *prev;
+            // usable bytes following this header
+            size_t size;
+        };
+    typedef struct _cshllink_arena{
+        // allocator routing into this arena (free is NULL)
+        cshllink_allocator allocator;
+        // newest block (allocations are served from here)
+        struct _cshllink_arenablk *block;
+        // bytes used of block
+        size_t used;
+        // allocator of the blocks (global allocator at cshllink_arena_init)
+        const cshllink_allocator *backing;
+        // number of blocks allocated since cshllink_arena_init (statistics)
+        size_t blocks;
+    }cshllink_arena;
+
+    /*
+        error context
+
+        - error code together with the position at which loading or writing failed
+        - passed to the ...Ctx functions, or kept per thread for all other functions (cshllink_lastError)
+        - initialize with {0} (or set allocator) before the first call
+    */
+    typedef struct _cshllink_ctx{
+        // error code (see above), 0 if the call succeeded
+        uint8_t error;
+        // absolute offset, in bytes, of the input / output position at which the error occurred (0 outside of parsing and serializing)
+        size_t offset;
+        // section (CSHLLINK_SEC_*) read or written when the error occurred (0 outside of parsing and serializing)
+        uint32_t section;
+        // allocator of the structure loaded with this context (NULL: global allocator), kept by the ...Ctx functions
+        const cshllink_allocator *allocator;
+        // 1: the ...Ctx loaders keep an owned copy of the input and call cshllink_trackDirty (unmodified sections are written back byte for byte)
+        uint8_t track;
+    }cshllink_ctx;
+
+    /*
+        <- error context of the last failed call of the calling thread
+    */
+    const cshllink_ctx *cshllink_lastError(void);
+
+    /*
+        set the error code of the calling thread (cshllink_error and the thread context, position cleared)
+    */
+    void _cshllink_seterr(uint8_t error);
+    /*
+        record the position of the last error in the thread context and ctx (may be NULL)
+    */
+    void _cshllink_errpos(cshllink_ctx *ctx, size_t offset, uint32_t section);
+    /*
+        start / finish a call with an explicit context (ctx may be NULL)
+    */
+    void _cshllink_ctxBegin(cshllink_ctx *ctx);
+    uint8_t _cshllink_ctxEnd(cshllink_ctx *ctx, uint8_t ret);
+
+    /*
+        -> allocator used by all following loads without an explicit context (NULL restores malloc / realloc / free)
+        -- the allocator must stay valid as long as structures loaded with it exist, install it before any structure is created
+    */
+    void cshllink_setAllocator(const cshllink_allocator *allocator);
+    /*
+        <- current global allocator (never NULL)
+    */
+    const cshllink_allocator *cshllink_getAllocator(void);
+
+    /*
+        default allocator (malloc / realloc / free)
+    */
+    void *_cshllink_libcAlloc(void *user, size_t size);
+    void *_cshllink_libcRealloc(void *user, void *ptr, size_t size);
+    void _cshllink_libcFree(void *user, void *ptr);
+
+    /*
+        allocate / resize / release through allocator (NULL: global allocator)
+    */
+    void *_cshllink_alloc(const cshllink_allocator *allocator, size_t size);
+    void *_cshllink_realloc(const cshllink_allocator *allocator, void *ptr, size_t size);
+    void _cshllink_dealloc(const cshllink_allocator *allocator, void *ptr);
+    /*
+        allocator of a call with context ctx (may be NULL), never NULL
+    */
+    const cshllink_allocator *_cshllink_allocator(const cshllink_ctx *ctx);
+
+    /*
+        -> arena
+        -> initial capacity in bytes (0: first block allocated by the first load)
+        -- initializes the arena, blocks come from the current global allocator
+        <- on error this function will return -1, on success 0
+    */
+    uint8_t cshllink_arena_init(cshllink_arena *arena, size_t capacity);
+    /*
+        -> arena
+        -> number of bytes
+        -- makes sure the next "size" bytes can be allocated without adding a block
+        <- on error this function will return -1, on success 0
+    */
+    uint8_t cshllink_arena_reserve(cshllink_arena *arena, size_t size);
+    /*
+        -> arena
+        -- releases all memory allocated from the arena in O(1) (older blocks are returned, the newest is reused)
+        structures loaded with the arena must not be used afterwards (cshllink_free is not needed)
+    */
+    void cshllink_arena_reset(cshllink_arena *arena);
+    /*
+        -> arena
+        -- returns all blocks to the backing allocator
+    */
+    void cshllink_arena_free(cshllink_arena *arena);
+
+    /*
+        arena allocator functions (user is the arena), each allocation is preceded by its size
+    */
+    void *_cshllink_arenaAlloc(void *user, size_t size);
+    void *_cshllink_arenaRealloc(void *user, void *ptr, size_t size);
+    /*
+        add a block of at least "size" usable bytes
+    */
+    uint8_t _cshllink_arenaGrow(cshllink_arena *arena, size_t size);
+
+    /*
+        spare buffer pool
+
+        - heap buffers kept by cshllink_reset, sorted by size, handed out again by cshllink_reload / cshllink_reloadBuffer
+        - owned by the caller and passed to these functions like an arena, may be shared by structures of the same allocator
+        - initialize with {0}, cshllink_pool_free returns the kept buffers
+    */
+    // maximum number of kept buffers (further buffers are freed)
+    #define _CSHLLINK_SPARE_NUM 64
+        struct _cshllink_spare{
+            void *ptr;
+            // usable size in bytes
+            size_t size;
+        };
+    typedef struct _cshllink_pool{
+        // kept buffers, ascending size
+        struct _cshllink_spare spare[_CSHLLINK_SPARE_NUM];
+        // number of used entries of spare
+        uint8_t num;
+        // allocator of the kept buffers (set by cshllink_reset)
+        const cshllink_allocator *allocator;
+    }cshllink_pool;
+
+    /*
+        -> pool
+        -- returns all kept buffers to their allocator, the pool can be used again
+    */
+    void cshllink_pool_free(cshllink_pool *pool);
 
     /*
         SHLLINK Header
@@ -460,31 +662,52 @@
 
         - specifies the target of the link. The presence of this structure is specified by the HasLinkTargetIDList bit (LinkFlags section 2.1.1) in the ShellLinkHeader
     */
-            /*
-                SHLLINK LinkTargetIDList - IDList - IDItem
-
-                - The data stored in a given ItemID is defined by the source that corresponds to the location in the target namespace of the preceding ItemIDs. This data uniquely identifies the items in that part of the namespace
-            */
-            struct _cshllink_lnktidl_idl_item{
-                // item size in bytes
-                uint16_t item_size;
-                // The shell data source-defined data that specifies an item
-                uint8_t *item;
-            };
         /*
             SHLLINK LinkTargetIDList - IDList (terminated with TerminalBlock (2 Bytes NULL))
+
+            - the ItemIDs (section 2.2.2) are stored as in the file, back to back in one blob: 2 byte ItemIDSize followed by the shell data source-defined data
+            - The data stored in a given ItemID is defined by the source that corresponds to the location in the target namespace of the preceding ItemIDs. This data uniquely identifies the items in that part of the namespace
+            - use cshllink_IDListItem / cshllink_IDListIter to access the items
         */
         struct _cshllink_lnktidl_idl{
             // num of elements
-            uint8_t idl_inum;
-            // An array of zero or more ItemID structures (section 2.2.2)
-            struct _cshllink_lnktidl_idl_item *idl_item;
+            uint16_t idl_inum;
+            // zero or more ItemID structures (section 2.2.2), TerminalBlock excluded
+            uint8_t *idl_blob;
+            // size of idl_blob in bytes
+            uint32_t idl_bloblen;
+            // allocated size of idl_blob in bytes (0: borrowed from the input or none)
+            uint32_t idl_blobcap;
+            // offset of every ItemID in idl_blob (idl_inum entries)
+            uint32_t *idl_off;
+            // allocated entries of idl_off
+            uint16_t idl_offcap;
+            // allocator of idl_blob and idl_off (NULL: global allocator)
+            const cshllink_allocator *idl_allocator;
+            // changed by cshllink_IDListSplice since loading (the list is encoded instead of copied from cshllink_input, see cshllink_trackDirty)
+            uint8_t idl_dirty;
         };
+        /*
+            item passed to the IDList editing functions (cshllink_IDListSplice ...)
+        */
+        typedef struct _cshllink_idl_item{
+            // shell data source-defined data of the item
+            const uint8_t *data;
+            // length in bytes of data (ItemIDSize - 2)
+            uint16_t size;
+        }cshllink_idl_item;
+        /*
+            iterator over the ItemIDs of an IDList (cshllink_IDListIter / cshllink_IDListNext)
+        */
+        typedef struct _cshllink_idl_iter{
+            const uint8_t *pos;
+            const uint8_t *end;
+        }cshllink_idl_iter;
     struct _cshllink_lnktidl{
         /*
             List of IDList elements
         */
-        // size in bytes = SUM(_cshllink_lnktidl_idl_item.item_size)
+        // size in bytes = idl_bloblen + 2 (TerminalBlock), kept by the cshllink_*IDListItem functions, the writer derives it from idl_bloblen
         uint16_t idl_size;
         // A stored IDList structure (section 2.2.1), which contains the item ID list
         struct _cshllink_lnktidl_idl cshllink_lnktidl_idl;
@@ -708,6 +931,18 @@
         // An optional structure that specifies the location of the icon to be used when displaying a shell link item in an icon view. This structure MUST be present if the HasIconLocation flag is set
         struct _cshllink_strdata_def IconLocation;
     };
+    /*
+        ExtraDataBlock fields with a size fixed by [MS-SHLLINK] (FaceName, DarwinDataAnsi, DarwinDataUnicode, TargetAnsi, TargetUnicode, KnownFolderID, MachineID, Droid, DroidBirth)
+        build with CSHLLINK_INLINE_EXTRADATA to store them as arrays inside the block structures (decoded with one copy per block, no heap buffers, never borrowed from the input),
+        otherwise they are pointers to heap buffers (or into the input for cshllink_loadView / cshllink_loadMapped)
+        CSHLLINK_INLINE_EXTRADATA changes the layout of cshllink, it has to be defined for the library and every program using it
+    */
+    #ifdef CSHLLINK_INLINE_EXTRADATA
+        #define _CSHLLINK_FIXEDBUF(type, name, count) type name[count]
+    #else
+        #define _CSHLLINK_FIXEDBUF(type, name, count) type *name
+    #endif
+
             /*
             SHLLINK ExtraDataBlock - BlockInfo
             */
@@ -788,7 +1023,7 @@
             */
             uint32_t FontWeight;
             // A 32-character Unicode string that specifies the face name of the font used in the console window
-            char16_t *FaceName;
+            _CSHLLINK_FIXEDBUF(char16_t, FaceName, 32);
             // A 32-bit, unsigned integer that specifies the size of the cursor, in pixels, used in the console window
             /*
                 value ≤ 25      A small cursor.
@@ -882,9 +1117,9 @@
             // BlockSignature MUST be 0xA0000006
             struct _cshllink_extdatablk_blk_info info;
             // A NULL–terminated string, defined by the system default code page, which specifies an application identifier. This field SHOULD be ignored (260b)
-            char *DarwinDataAnsi;
+            _CSHLLINK_FIXEDBUF(char, DarwinDataAnsi, 260);
             // An optional, NULL–terminated, Unicode string that specifies an application identifier (In Windows, this is a Windows Installer (MSI) application descriptor. For more information, see [MSDN-MSISHORTCUTS]) (520b)
-            char16_t *DarwinDataUnicode;
+            _CSHLLINK_FIXEDBUF(char16_t, DarwinDataUnicode, 260);
         };
         /*
             SHLLINK ExtraDataBlock - EnvironmentVariableDataBlock
@@ -898,9 +1133,9 @@
             // BlockSignature MUST be 0xA0000001
             struct _cshllink_extdatablk_blk_info info;
             // A NULL-terminated string, defined by the system default code page, which specifies a path to environment variable information (260b)
-            char *TargetAnsi;
+            _CSHLLINK_FIXEDBUF(char, TargetAnsi, 260);
             // An optional, NULL-terminated, Unicode string that specifies a path to environment variable information (520b)
-            char16_t *TargetUnicode;
+            _CSHLLINK_FIXEDBUF(char16_t, TargetUnicode, 260);
         };
         /*
             SHLLINK ExtraDataBlock - IconEnvironmentDataBlock
@@ -914,9 +1149,9 @@
             // BlockSignature MUST be 0xA0000007
             struct _cshllink_extdatablk_blk_info info;
             // A NULL-terminated string, defined by the system default code page, which specifies a path that is constructed with environment variables
-            char *TargetAnsi;
+            _CSHLLINK_FIXEDBUF(char, TargetAnsi, 260);
             // An optional, NULL-terminated, Unicode string that specifies a path that is constructed with environment variables
-            char16_t *TargetUnicode;
+            _CSHLLINK_FIXEDBUF(char16_t, TargetUnicode, 260);
         };
         /*
             SHLLINK ExtraDataBlock - KnownFolderDataBlock
@@ -930,7 +1165,7 @@
             // BlockSignature MUST be 0xA000000B
             struct _cshllink_extdatablk_blk_info info;
             // A value in GUID packet representation ([MS-DTYP] section 2.3.4.2) that specifies the folder GUID ID
-            uint8_t *KnownFolderID;
+            _CSHLLINK_FIXEDBUF(uint8_t, KnownFolderID, 16);
             // A 32-bit, unsigned integer that specifies the location of the ItemID of the first child segment of the IDList specified by KnownFolderID. This value is the offset, in bytes, into the link target IDList
             uint32_t Offset;
         };
@@ -995,11 +1230,11 @@
             // A 32-bit, unsigned integer. This value MUST be 0x00000000
             uint32_t Version;
             // A NULL–terminated character string, as defined by the system default code page, which specifies the NetBIOS name of the machine where the link target was last known to reside
-            char *MachineID;
+            _CSHLLINK_FIXEDBUF(char, MachineID, 16);
             // Two values in GUID packet representation ([MS-DTYP] section 2.3.4.2) that are used to find the link target with the Link Tracking service, as described in [MS-DLTW]
-            uint8_t *Droid;
+            _CSHLLINK_FIXEDBUF(uint8_t, Droid, 32);
             // Two values in GUID packet representation that are used to find the link target with the Link Tracking service
-            uint8_t *DroidBirth;
+            _CSHLLINK_FIXEDBUF(uint8_t, DroidBirth, 32);
         };
         /*
             SHLLINK ExtraDataBlock - VistaAndAboveIDListDataBlock
@@ -1037,6 +1272,62 @@
     /*
         SHLLINK Structure
     */
+    /*
+        SHLLINK sections (bit flags)
+    */
+    #define CSHLLINK_SEC_HEADER 0x00000001
+    #define CSHLLINK_SEC_LINKTARGETIDLIST 0x00000002
+    #define CSHLLINK_SEC_LINKINFO 0x00000004
+    #define CSHLLINK_SEC_STRINGDATA 0x00000008
+    #define CSHLLINK_SEC_EXTRADATA 0x00000010
+    // single ExtraDataBlock by its signature (0xA0000001 - 0xA000000C), used by the skip mask of the cshllink_load*Skip functions and the section index
+    #define CSHLLINK_SEC_EDBLK(BlockSignature) (0x00000100u<<((BlockSignature)&0x0F))
+    // all ExtraDataBlocks known to this library
+    #define CSHLLINK_SEC_EDBLKS 0x001FFE00
+    // BlockSignature is one of the ExtraDataBlocks known to this library
+    #define _CSHLLINK_EDBLK_KNOWN(BlockSignature) ((BlockSignature)>=_CSHLLINK_EDBLK_EnvironmentVariableDataBlockSig && (BlockSignature)<=_CSHLLINK_EDBLK_VistaAndAboveIDListDataBlockSig && (BlockSignature)!=0xA000000A)
+
+    /*
+        SHLLINK section index entry
+
+        - position of a section or ExtraDataBlock in the loaded input, recorded while parsing
+    */
+    // sections (header, LinkTargetIDList, LinkInfo, StringData, ExtraData) + ExtraDataBlocks (unknown signatures included, blocks beyond this number are not indexed)
+    #define _CSHLLINK_SECIDX_NUM (5+_CSHLLINK_EDBLK_NUM)
+    struct _cshllink_secidx{
+        // section (CSHLLINK_SEC_*) or ExtraDataBlock (CSHLLINK_SEC_EDBLK, 0 for unknown signatures)
+        uint32_t section;
+        // BlockSignature of an ExtraDataBlock, 0 for sections
+        uint32_t BlockSignature;
+        // absolute offset, in bytes, from the start of the input
+        uint32_t offset;
+        // length, in bytes (ExtraData includes the TerminalBlock)
+        uint32_t size;
+    };
+
+    /*
+        SHLLINK ExtraDataBlock list entry
+
+        - every ExtraDataBlock of the input in its original order, unknown signatures included (allocated with the structure, grown while parsing)
+        - written back in this order: decoded blocks are encoded by their handler (cshllink_blockhandler), unknown and not yet decoded blocks are copied verbatim from raw
+        - known blocks are decoded while loading; only blocks skipped by cshllink_loadViewSkip / cshllink_loadMappedSkip (keep) are decoded on first access (cshllink_getBlock)
+    */
+    // entries allocated for the first ExtraDataBlock of a link (doubled when exceeded)
+    #define _CSHLLINK_EDBLKLIST_INIT 8
+    struct _cshllink_edblkent{
+        uint32_t BlockSignature;
+        uint32_t BlockSize;
+        // absolute offset, in bytes, from the start of the input
+        uint32_t offset;
+        // BlockSize bytes of the block (BlockSize and BlockSignature included): points into the input if ExtraData is borrowed, owned copy for blocks not known to this library otherwise. NULL for known blocks decoded from a copied input
+        const uint8_t *raw;
+        // block structure in cshllink_extdatablk once decoded, object of the registered handler for other signatures (cshllink_registerBlock), NULL for unknown and not yet decoded blocks (see cshllink_getBlock)
+        void *block;
+    };
+
+    // sections borrowed in view mode (all sections containing string or blob fields)
+    #define _CSHLLINK_SEC_VIEW (CSHLLINK_SEC_LINKTARGETIDLIST|CSHLLINK_SEC_LINKINFO|CSHLLINK_SEC_STRINGDATA|CSHLLINK_SEC_EXTRADATA)
+
     typedef struct _cshllink{
 
         /*
@@ -1059,8 +1350,212 @@
         SHLLINK ExtraData
         */
         struct _cshllink_extdatablk cshllink_extdatablk;
+        // ExtraDataBlocks in input order (NULL if there are none)
+        struct _cshllink_edblkent *cshllink_edblklist;
+        // Number of used entries of cshllink_edblklist
+        uint16_t cshllink_edblklistnum;
+        // Allocated entries of cshllink_edblklist
+        uint16_t cshllink_edblklistcap;
+
+        /*
+        Input ownership
+        */
+        // Sections (CSHLLINK_SEC_*) whose string fields point into the kept input instead of owned heap memory. cshllink_free does not free these fields
+        uint32_t cshllink_borrowed;
+        // Read-only mapping of the input kept alive by cshllink_loadMapped (NULL if none), released by cshllink_free
+        void *cshllink_map;
+        // Size, in bytes, of cshllink_map
+        size_t cshllink_mapsize;
+        // Sections (CSHLLINK_SEC_*, CSHLLINK_SEC_EDBLK) stepped over by a cshllink_load*Skip function. They are only written back while copied from the input (cshllink_trackDirty, unmodified) or from kept raw bytes (ExtraDataBlocks), otherwise writing fails with 0x2F
+        uint32_t cshllink_skipped;
+        // Allocator owning all heap fields (NULL: global allocator), set by the load functions, kept by cshllink_free
+        const cshllink_allocator *cshllink_allocator;
+        // Parsed input (header to TerminalBlock of ExtraData) of cshllink_loadView / cshllink_loadMapped (keep) or a load with cshllink_ctx.track, NULL otherwise: points into the buffer or mapping while cshllink_borrowed is set, owned copy after cshllink_detach of a tracked structure or with cshllink_ctx.track
+        const uint8_t *cshllink_input;
+        // Size, in bytes, of cshllink_input
+        size_t cshllink_inputsize;
+        // Set by cshllink_trackDirty: the writers copy the sections not in cshllink_dirty from cshllink_input (0: every section is encoded)
+        uint8_t cshllink_tracked;
+        // Sections (CSHLLINK_SEC_*) modified by the setters or cshllink_setDirty, encoded from the structure on write of a tracked structure. Direct field changes must be reported with cshllink_setDirty
+        uint32_t cshllink_dirty;
+
+        /*
+        Section index (in input order, also for skipped sections)
+        */
+        struct _cshllink_secidx cshllink_index[_CSHLLINK_SECIDX_NUM];
+        // Number of used entries of cshllink_index
+        uint8_t cshllink_indexnum;
     }cshllink;
 
+    /*
+        SHLLINK compact structure (cshllink_toCompact / cshllink_fromCompact)
+
+        - for keeping many parsed links resident: the hot sections are kept inline, LinkInfo and only the ExtraDataBlocks that are present share one "cold" allocation
+        - section index and loaded input (cshllink_input) are not kept
+    */
+    struct _cshllink_compact_edblk{
+        // BlockSignature of the block (the list is sorted by it)
+        uint32_t BlockSignature;
+        // block structure in the cold allocation (e.g. struct _cshllink_extdatablk_trackdblk for _CSHLLINK_EDBLK_TrackerDataBlockSig)
+        void *block;
+    };
+    typedef struct _cshllink_compact{
+        /*
+            SHLLINK Header, LinkTargetIDList and StringData (same as in cshllink)
+        */
+        struct _cshllink_header cshllink_header;
+        struct _cshllink_lnktidl cshllink_lnktidl;
+        struct _cshllink_strdata cshllink_strdata;
+        /*
+            SHLLINK LinkInfo (NULL if empty)
+        */
+        struct _cshllink_lnkinfo *cshllink_lnkinfo;
+        /*
+            SHLLINK ExtraData: the blocks that are not empty, sorted by BlockSignature
+        */
+        struct _cshllink_compact_edblk *cshllink_edblk;
+        // Number of entries of cshllink_edblk
+        uint8_t cshllink_edblknum;
+        // ExtraDataBlocks in input order (handed over from cshllink, block points to cshllink_edblk blocks)
+        struct _cshllink_edblkent *cshllink_edblklist;
+        // Number of entries of cshllink_edblklist
+        uint16_t cshllink_edblklistnum;
+
+        /*
+            Input ownership (same as in cshllink)
+        */
+        uint32_t cshllink_borrowed;
+        uint32_t cshllink_skipped;
+        void *cshllink_map;
+        size_t cshllink_mapsize;
+        const cshllink_allocator *cshllink_allocator;
+        // Cold allocation holding cshllink_lnkinfo, cshllink_edblk and the blocks (NULL if there are none)
+        void *cshllink_cold;
+        // Size, in bytes, of cshllink_cold
+        size_t cshllink_coldsize;
+    }cshllink_compact;
+
+    /*
+        SHLLINK input cursor
+
+        - bounds-checked read position over the input byte span data
+    */
+    // files up to this size are read into a stack buffer by cshllink_loadFile, larger ones into a heap buffer
+    #define _CSHLLINK_LOADBUF_STACK 0x1000
+    // size, in bytes, of the ShellLinkHeader
+    #define _CSHLLINK_HEADERSIZE 0x4C
+    // number of output segments cshllink_writeFd keeps on the stack (further heap buffers are copied)
+    #define _CSHLLINK_WRITEV_IOV 64
+    struct _cshllink_cursor{
+        // start of the input byte span
+        const uint8_t *data;
+        // size, in bytes, of the input
+        size_t size;
+        // current read position, in bytes, from the start of the input
+        size_t pos;
+        // sections (CSHLLINK_SEC_*) whose strings are referenced in data instead of copied
+        uint32_t borrow;
+        // section currently read (CSHLLINK_SEC_*)
+        uint32_t section;
+        // sections (CSHLLINK_SEC_*, CSHLLINK_SEC_EDBLK) stepped over instead of decoded
+        uint32_t skip;
+        // absolute offset, in bytes, of data in the whole input (units of the push parser), 0 otherwise
+        size_t base;
+        // error context of the call (NULL: thread context only)
+        cshllink_ctx *ctx;
+        // allocator of the structure read
+        const cshllink_allocator *alloc;
+        // pool whose spare buffers serve allocations (cshllink_reload), NULL otherwise
+        cshllink_pool *pool;
+    };
+
+    /*
+        SHLLINK push parser
+
+        - incremental parser state (cshllink_parser_feed), buffers only the current unit (section size field, section or ExtraDataBlock)
+    */
+    #define CSHLLINK_PARSER_DONE 0x00
+    #define CSHLLINK_PARSER_NEEDMORE 0x01
+    #define CSHLLINK_PARSER_ERROR 0xFF
+    // largest LinkInfo / ExtraDataBlock accepted by the push parser
+    #define _CSHLLINK_PARSER_MAXUNIT 0x00100000
+    #define _CSHLLINK_PARSER_HEADER 0
+    #define _CSHLLINK_PARSER_IDLISTSIZE 1
+    #define _CSHLLINK_PARSER_IDLIST 2
+    #define _CSHLLINK_PARSER_LINKINFOSIZE 3
+    #define _CSHLLINK_PARSER_LINKINFO 4
+    #define _CSHLLINK_PARSER_STRINGSIZE 5
+    #define _CSHLLINK_PARSER_STRING 6
+    #define _CSHLLINK_PARSER_BLOCKSIZE 7
+    #define _CSHLLINK_PARSER_BLOCK 8
+    #define _CSHLLINK_PARSER_DONE 9
+    #define _CSHLLINK_PARSER_ERROR 10
+    typedef struct _cshllink_parser{
+        // structure receiving the content
+        cshllink *out;
+        // current unit (_CSHLLINK_PARSER_*)
+        uint8_t phase;
+        // next StringData structure (0 NameString - 4 IconLocation)
+        uint8_t item;
+        // error code once phase is _CSHLLINK_PARSER_ERROR
+        uint8_t error;
+        // buffer of the current unit
+        uint8_t *buf;
+        // size, in bytes, of buf
+        size_t capacity;
+        // bytes of the current unit received / needed
+        size_t have;
+        size_t need;
+        // bytes consumed from the start of the input
+        size_t offset;
+        // offset of the first byte of the current section (StringData, ExtraData)
+        size_t sectionStart;
+        // allocator of buf and the structure (global allocator at cshllink_parser_init)
+        const cshllink_allocator *allocator;
+    }cshllink_parser;
+
+    /*
+        SHLLINK output cursor
+
+        - bounds-checked write position over the output byte span data
+    */
+    struct _cshllink_ocursor{
+        // start of the output byte span
+        uint8_t *data;
+        // size, in bytes, of the output
+        size_t size;
+        // current write position, in bytes, from the start of the output
+        size_t pos;
+        // gather mode (cshllink_writeFd): segments of the output in order, NULL for plain buffer output
+        // copied bytes are appended to data, heap buffers of the structure are referenced directly
+        struct iovec *iov;
+        // number of used segments
+        int iovcnt;
+        // capacity of iov
+        int iovmax;
+        // section currently written (CSHLLINK_SEC_*)
+        uint32_t section;
+        // error context of the call (NULL: thread context only)
+        cshllink_ctx *ctx;
+    };
+
+    /*
+        SHLLINK ExtraDataBlock handler
+
+        - callbacks of one BlockSignature, kept in a table indexed by the low byte of the signature (0xA00000xx)
+        - the known blocks are built in, other signatures can be added with cshllink_registerBlock (blocks without handler are copied verbatim)
+        - read: the cursor is positioned after BlockSignature and ends with the block, the result is stored in entry->block (memory from _cshllink_curAlloc)
+        - write: encodes the whole block (BlockSize and BlockSignature included, _cshllink_cwrite), entry is NULL for a known block added by the setters
+        - size: bytes written by write
+        - free: releases entry->block (NULL for the known blocks, their fields are released with the structure)
+    */
+    typedef struct _cshllink_blockhandler{
+        uint8_t (*read)(cshllink *inputStruct, struct _cshllink_edblkent *entry, struct _cshllink_cursor *cur);
+        uint8_t (*write)(cshllink *inputStruct, struct _cshllink_edblkent *entry, struct _cshllink_ocursor *cur);
+        size_t (*size)(const cshllink *inputStruct, const struct _cshllink_edblkent *entry);
+        void (*free)(cshllink *inputStruct, struct _cshllink_edblkent *entry);
+    }cshllink_blockhandler;
+
     /*
         Functions
     */
@@ -1075,11 +1570,424 @@
         exact error codes are stored in cshllink_error
     */
     uint8_t cshllink_loadFile(FILE *fp, cshllink *inputStruct);
+    /*
+        same as cshllink_loadFile, the error code and position are also stored in ctx (may be NULL)
+        with ctx->track the input is kept for cshllink_trackDirty (an owned copy, released by cshllink_free)
+    */
+    uint8_t cshllink_loadFileCtx(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx);
+
+    /*
+        -> pointer to a buffer containing the complete shell link
+        -> size of the buffer in bytes
+        -> cshllink structure pointer containing the buffer content
+        -- reads content, modifies cshllink structure (the buffer is not referenced after the call)
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadBuffer(const uint8_t *data, size_t size, cshllink *inputStruct);
+    /*
+        same as cshllink_loadBuffer, the error code and position are also stored in ctx (may be NULL)
+        with ctx->track the input is kept for cshllink_trackDirty (an owned copy, released by cshllink_free)
+    */
+    uint8_t cshllink_loadBufferCtx(const uint8_t *data, size_t size, cshllink *inputStruct, cshllink_ctx *ctx);
+
+    /*
+        -> open file descriptor of type FILE (R mode) / buffer and its size
+        -> cshllink structure pointer containing the content
+        -> initialized arena (cshllink_arena_init)
+        -- same as cshllink_loadFile / cshllink_loadBuffer, all fields are allocated from arena (released with cshllink_arena_reset)
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadFileArena(FILE *fp, cshllink *inputStruct, cshllink_arena *arena);
+    uint8_t cshllink_loadBufferArena(const uint8_t *data, size_t size, cshllink *inputStruct, cshllink_arena *arena);
+
+    /*
+        -> pointer to a buffer containing the complete shell link
+        -> size of the buffer in bytes
+        -> cshllink structure pointer containing the buffer content
+        -> skip: sections (CSHLLINK_SEC_*) and ExtraDataBlocks (CSHLLINK_SEC_EDBLK) not to decode
+        -- same as cshllink_loadBuffer; skipped sections are stepped over by their size fields and left zeroed
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        skipped sections are recorded in cshllink_skipped. The input is not kept, so writing such a structure fails with 0x2F (use cshllink_loadViewSkip and cshllink_trackDirty to write unmodified skipped sections back)
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadBufferSkip(const uint8_t *data, size_t size, cshllink *inputStruct, uint32_t skip);
+
+    /*
+        -> pointer to a buffer containing the complete shell link
+        -> size of the buffer in bytes
+        -> cshllink structure pointer referencing the buffer content
+        -- reads content, modifies cshllink structure; string and blob fields (IDList items, LinkInfo strings, StringData UStrings, ExtraData strings and blobs) point into the buffer instead of being copied
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        the buffer must outlive inputStruct (or until cshllink_detach). Borrowed fields are read-only, may be unaligned and keep their lengths in the existing size fields (idl_bloblen of an IDList blob, whose ItemIDs are located by the owned offset array idl_off, CountCharacters, BlockSize, ...)
+        setters detach the structure before modifying it. cshllink_free does not free borrowed fields
+        all ExtraDataBlocks are decoded while loading, lazy decoding is opt-in: pass them in the skip mask of cshllink_loadViewSkip
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadView(const uint8_t *data, size_t size, cshllink *inputStruct);
+
+    /*
+        -> pointer to a buffer containing the complete shell link
+        -> size of the buffer in bytes
+        -> cshllink structure pointer referencing the buffer content
+        -> skip: sections (CSHLLINK_SEC_*) and ExtraDataBlocks (CSHLLINK_SEC_EDBLK) not to decode
+        -- same as cshllink_loadView; skipped sections are stepped over by their size fields and left zeroed
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        skipped ExtraDataBlocks (e.g. CSHLLINK_SEC_EDBLKS) stay in the buffer: cshllink_getBlock decodes them on first access, the writers copy them verbatim
+        other skipped sections are only written back after cshllink_trackDirty and while unmodified, otherwise writing fails with 0x2F
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadViewSkip(const uint8_t *data, size_t size, cshllink *inputStruct, uint32_t skip);
+
+    /*
+        -> path of the shell link
+        -> cshllink structure pointer containing the file content
+        -- maps the file read-only, parses the mapping and unmaps it again
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadPath(const char *path, cshllink *inputStruct);
+
+    /*
+        -> path of the shell link
+        -> cshllink structure pointer containing the file content
+        -> keep: 0 - unmap after parsing (same as cshllink_loadPath)
+                 1 - keep the mapping alive; string and blob fields point into the mapping instead of being copied (see cshllink_loadView)
+        -- maps the file read-only and parses the mapping
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        borrowed fields are read-only, may be unaligned and StringData UStrings are not NULL terminated (use CountCharacters).
+        The mapping is released by cshllink_free (also call it after an error).
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadMapped(const char *path, cshllink *inputStruct, uint8_t keep);
+
+    /*
+        -> path of the shell link
+        -> cshllink structure pointer containing the file content
+        -> keep: see cshllink_loadMapped
+        -> skip: sections (CSHLLINK_SEC_*) and ExtraDataBlocks (CSHLLINK_SEC_EDBLK) not to decode
+        -- same as cshllink_loadMapped; skipped sections are stepped over by their size fields and left zeroed
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        with keep 1 skipped ExtraDataBlocks (e.g. CSHLLINK_SEC_EDBLKS) stay in the mapping: cshllink_getBlock decodes them on first access, the writers copy them verbatim
+        other skipped sections are only written back with keep 1, after cshllink_trackDirty and while unmodified, otherwise writing fails with 0x2F
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadMappedSkip(const char *path, cshllink *inputStruct, uint8_t keep, uint32_t skip);
+
+    /*
+        map / unmap file read-only (falls back to a heap copy where mmap is not available)
+    */
+    uint8_t _cshllink_map(const char *path, void **map, size_t *size);
+    void _cshllink_unmap(void *map, size_t size);
     
     /*
-        Processes inputFile
+        -> pointer to a buffer starting with the shell link (at least 0x4C bytes)
+        -> size of the buffer in bytes
+        -> header structure pointer
+        -- reads only the ShellLinkHeader, no allocation
+        <- on error this function will return -1 (the content of header is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadHeader(const uint8_t *data, size_t size, struct _cshllink_header *header);
+
+    /*
+        -> open file descriptor (read access)
+        -> header structure pointer
+        -- reads exactly the 0x4C bytes of the ShellLinkHeader from the start of the file (the file position is not changed), no allocation
+        <- on error this function will return -1 (the content of header is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadHeaderFd(int fd, struct _cshllink_header *header);
+
+    /*
+        -> parser state
+        -> cshllink structure pointer receiving the content
+        -- prepares an incremental parse (see cshllink_parser_feed), clears inputStruct
+        <- on error this function will return -1, on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_parser_init(cshllink_parser *ctx, cshllink *inputStruct);
+
+    /*
+        -> parser state (cshllink_parser_init)
+        -> next chunk of the input (any size, may be empty)
+        -> size of the chunk in bytes
+        -> optional pointer receiving the number of bytes of the chunk consumed (may be NULL)
+        -- parses the chunk; only the current section (ExtraDataBlock) is buffered, bytes after the TerminalBlock are not consumed
+        <- CSHLLINK_PARSER_NEEDMORE - feed the next chunk
+           CSHLLINK_PARSER_DONE     - the TerminalBlock was read, the structure is complete
+           CSHLLINK_PARSER_ERROR    - (-1) the input is invalid (the content of the structure is undefined, free it with cshllink_free)
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_parser_feed(cshllink_parser *ctx, const uint8_t *data, size_t size, size_t *used);
+
+    /*
+        -> parser state
+        <- number of bytes still missing for the current unit, 0 once done
+        (feeding exactly this many bytes never consumes input beyond the TerminalBlock)
+    */
+    size_t cshllink_parser_pending(const cshllink_parser *ctx);
+
+    /*
+        -> parser state
+        -- releases the unit buffer of the parser (not the cshllink structure)
+    */
+    void cshllink_parser_free(cshllink_parser *ctx);
+
+    /*
+        decodes the completed unit of the parser and selects the next one
+    */
+    uint8_t _cshllink_parser_step(cshllink_parser *ctx);
+
+    /*
+        -> open file descriptor of type FILE (R mode, may be a pipe or stdin)
+        -> cshllink structure pointer containing the content
+        -- reads one shell link from the current position up to its TerminalBlock (no seeking, nothing after the TerminalBlock is consumed)
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_loadStream(FILE *fp, cshllink *inputStruct);
+
+    /*
+        validates HeaderSize and LinkCLSID (one comparison) and decodes the 0x4C header bytes at raw
+    */
+    uint8_t _cshllink_decodeHeader(const uint8_t *raw, struct _cshllink_header *header);
+
+    /*
+        fixed-layout portions, one descriptor list per block (reader and writer are generated from them)
+
+        V(T, member, offset)                value member, serialized in the size of the member at offset
+        R(T, member, offset, size, err)     buffer of "size" bytes at offset, a pointer member or an array with CSHLLINK_INLINE_EXTRADATA (err: error code if it cannot be allocated or is NULL)
+
+        offsets are in bytes from the start of the structure (ExtraDataBlocks: from the end of BlockSize and BlockSignature), fields are sorted by offset,
+        bytes not covered by a field (reserved, HeaderSize and LinkCLSID) are written as 0 / by the caller
+    */
+    #define _CSHLLINK_LAYOUT_HEADER(V, R, T) \
+        V(T, LinkFlags, 20) \
+        V(T, FileAttributes, 24) \
+        V(T, CreationTime, 28) \
+        V(T, AccessTime, 36) \
+        V(T, WriteTime, 44) \
+        V(T, FileSize, 52) \
+        V(T, IconIndex, 56) \
+        V(T, ShowCommand, 60) \
+        V(T, HotKey, 64)
+    // LocalBasePathOffsetUnicode and CommonPathSuffixOffsetUnicode only if LinkInfoHeaderSize >= 0x24
+    #define _CSHLLINK_LAYOUT_LINKINFO(V, R, T) \
+        V(T, LinkInfoSize, 0) \
+        V(T, LinkInfoHeaderSize, 4) \
+        V(T, LinkInfoFlags, 8) \
+        V(T, VolumeIDOffset, 12) \
+        V(T, LocalBasePathOffset, 16) \
+        V(T, CommonNetworkRelativeLinkOffset, 20) \
+        V(T, CommonPathSuffixOffset, 24) \
+        V(T, LocalBasePathOffsetUnicode, 28) \
+        V(T, CommonPathSuffixOffsetUnicode, 32)
+    // VolumeLabelOffsetUnicode only if VolumeLabelOffset == 0x14
+    #define _CSHLLINK_LAYOUT_VOLUMEID(V, R, T) \
+        V(T, VolumeIDSize, 0) \
+        V(T, DriveType, 4) \
+        V(T, DriveSerialNumber, 8) \
+        V(T, VolumeLabelOffset, 12) \
+        V(T, VolumeLabelOffsetUnicode, 16)
+    // NetNameOffsetUnicode and DeviceNameOffsetUnicode only if NetNameOffset > 0x14
+    #define _CSHLLINK_LAYOUT_CNETRLNK(V, R, T) \
+        V(T, CommonNetworkRelativeSize, 0) \
+        V(T, CommonNetworkRelativeLinkFlags, 4) \
+        V(T, NetNameOffset, 8) \
+        V(T, DeviceNameOffset, 12) \
+        V(T, NetworkProviderType, 16) \
+        V(T, NetNameOffsetUnicode, 20) \
+        V(T, DeviceNameOffsetUnicode, 24)
+    #define _CSHLLINK_LAYOUT_CONSOLE(V, R, T) \
+        V(T, FillAttributes, 0) \
+        V(T, PopupFillAttributes, 2) \
+        V(T, ScreenBufferSizeX, 4) \
+        V(T, ScreenBufferSizeY, 6) \
+        V(T, WindowSizeX, 8) \
+        V(T, WindowSizeY, 10) \
+        V(T, WindowOriginX, 12) \
+        V(T, WindowOriginY, 14) \
+        V(T, FontSize, 24) \
+        V(T, FontFamily, 28) \
+        V(T, FontWeight, 32) \
+        R(T, FaceName, 36, 64, _CSHLLINK_ERRX_NULLPSTRFNAME) \
+        V(T, CursorSize, 100) \
+        V(T, FullScreen, 104) \
+        V(T, QuickEdit, 108) \
+        V(T, InsertMode, 112) \
+        V(T, AutoPosition, 116) \
+        V(T, HistoryBufferSize, 120) \
+        V(T, NumberOfHistoryBuffers, 124) \
+        V(T, HistoryNoDup, 128) \
+        V(T, ColorTable, 132)
+    #define _CSHLLINK_LAYOUT_DARWIN(V, R, T) \
+        R(T, DarwinDataAnsi, 0, 260, _CSHLLINK_ERRX_NULLPSTRDARDA) \
+        R(T, DarwinDataUnicode, 260, 520, _CSHLLINK_ERRX_NULLPSTRDARDU)
+    #define _CSHLLINK_LAYOUT_ENVIRONMENT(V, R, T) \
+        R(T, TargetAnsi, 0, 260, _CSHLLINK_ERRX_NULLPSTRENVDA) \
+        R(T, TargetUnicode, 260, 520, _CSHLLINK_ERRX_NULLPSTRENVDU)
+    #define _CSHLLINK_LAYOUT_ICONENVIRONMENT(V, R, T) \
+        R(T, TargetAnsi, 0, 260, _CSHLLINK_ERRX_NULLPSTRIENVDA) \
+        R(T, TargetUnicode, 260, 520, _CSHLLINK_ERRX_NULLPSTRIENVDU)
+    #define _CSHLLINK_LAYOUT_CONSOLEFE(V, R, T) \
+        V(T, CodePage, 0)
+    #define _CSHLLINK_LAYOUT_SPECIALFOLDER(V, R, T) \
+        V(T, SpecialFolderID, 0) \
+        V(T, Offset, 4)
+    #define _CSHLLINK_LAYOUT_KNOWNFOLDER(V, R, T) \
+        R(T, KnownFolderID, 0, 16, _CSHLLINK_ERR_NULLPEXTD) \
+        V(T, Offset, 16)
+    #define _CSHLLINK_LAYOUT_TRACKER(V, R, T) \
+        V(T, Length, 0) \
+        V(T, Version, 4) \
+        R(T, MachineID, 8, 16, _CSHLLINK_ERR_NULLPEXTD) \
+        R(T, Droid, 24, 32, _CSHLLINK_ERR_NULLPEXTD) \
+        R(T, DroidBirth, 56, 32, _CSHLLINK_ERR_NULLPEXTD)
+
+    // keeps a function out of line
+    #if defined(_MSC_VER)
+        #define _CSHLLINK_NOINLINE __declspec(noinline)
+    #elif defined(__GNUC__)
+        #define _CSHLLINK_NOINLINE __attribute__((noinline))
+    #else
+        #define _CSHLLINK_NOINLINE
+    #endif
+    /*
+        memcpy of a buffer field of a fixed layout (out of line: constant sizes of some hundred bytes would be inlined as slow rep movs)
+    */
+    void *_cshllink_copyBuf(void *dest, const void *src, size_t size);
+    /*
+        buffer field of a fixed layout: src if the cursor borrows the current section, otherwise a copy allocated with the cursor (NULL on failure)
+    */
+    const void *_cshllink_decodeBuf(const uint8_t *src, size_t size, struct _cshllink_cursor *cur);
+    /*
+        decoder and encoder generated from one descriptor list (see cshllink.c)
+    */
+    struct _cshllink_layout{
+        /*
+            decodes the fields that lie within the first "size" bytes at raw into dest
+            pointer members reference raw if the cursor borrows the current section, otherwise they are allocated with the cursor (cur may be NULL for layouts without pointers)
+        */
+        uint8_t (*decode)(const uint8_t *raw, size_t size, void *dest, struct _cshllink_cursor *cur);
+        /*
+            encodes the fields that lie within the first "size" bytes of raw from src, all other bytes are set to 0
+        */
+        uint8_t (*encode)(const void *src, uint8_t *raw, size_t size);
+        // serialized size in bytes, optional trailing fields included
+        uint16_t size;
+    };
+
+    /*
+        Processes inputFile (reads the whole file with a single fread and parses the buffer)
     */
     uint8_t cshllink_loadFile_i(FILE *fp, cshllink *inputStruct);
+    uint8_t _cshllink_loadFile(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx, cshllink_pool *pool);
+    uint8_t _cshllink_loadFileChecked(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx);
+
+    /*
+        Processes input buffer (shared by the buffer, view and mapped loaders)
+    */
+    uint8_t _cshllink_loadBuffer(const uint8_t *data, size_t size, cshllink *inputStruct, uint32_t skip, uint32_t borrow, cshllink_ctx *ctx);
+
+    /*
+        Processes input cursor (shared by all load functions)
+    */
+    uint8_t _cshllink_parse(struct _cshllink_cursor *cur, cshllink *inputStruct);
+    uint8_t _cshllink_parseSections(struct _cshllink_cursor *cur, cshllink *inputStruct);
+
+    /*
+        step over the current section (cur->section) using its size fields, records it in cshllink_skipped
+    */
+    uint8_t _cshllink_skipSection(cshllink *inputStruct, struct _cshllink_cursor *cur);
+
+    /*
+        -> cshllink structure pointer (loaded)
+        -> section (CSHLLINK_SEC_*) or ExtraDataBlock (CSHLLINK_SEC_EDBLK)
+        -- looks up the position of the section in the loaded input
+        <- index entry, NULL if the section was not present
+    */
+    const struct _cshllink_secidx *cshllink_findSection(const cshllink *inputStruct, uint32_t section);
+
+    /*
+        append an entry to the section index (ignored once the table is full, the last entry is kept for the ExtraData section recorded after its blocks)
+    */
+    void _cshllink_indexSection(cshllink *inputStruct, uint32_t section, uint32_t BlockSignature, size_t offset, size_t size);
+
+    /*
+        Section read functions
+    */
+    uint8_t _cshllink_readHeader(cshllink *inputStruct, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readLinkTargetIDList(cshllink *inputStruct, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readLinkInfo(cshllink *inputStruct, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readStringData(cshllink *inputStruct, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readExtraData(cshllink *inputStruct, struct _cshllink_cursor *cur);
+
+    /*
+        append the ExtraDataBlock starting at "start" to cshllink_edblklist, growing it (raw is referenced if the cursor borrows ExtraData, copied for blocks not known to this library otherwise)
+    */
+    struct _cshllink_edblkent *_cshllink_listBlock(cshllink *inputStruct, struct _cshllink_cursor *cur, size_t start, const struct _cshllink_extdatablk_blk_info info);
+    /*
+        decode an ExtraDataBlock of cshllink_edblklist from its raw bytes with its handler (parent: cursor of the load, NULL on first access)
+    */
+    uint8_t _cshllink_readRawBlock(cshllink *inputStruct, struct _cshllink_edblkent *entry, const struct _cshllink_cursor *parent);
+    /*
+        handler of BlockSignature, NULL if there is none (the block is copied verbatim)
+    */
+    const cshllink_blockhandler *_cshllink_edblkHandler(uint32_t BlockSignature);
+
+    /*
+        -> cshllink structure pointer (loaded)
+        -> BlockSignature of a known or registered ExtraDataBlock (_CSHLLINK_EDBLK_*Sig, cshllink_registerBlock)
+        -- returns the decoded block; a block skipped by cshllink_loadViewSkip / cshllink_loadMappedSkip (keep) or loaded before its handler was registered is decoded from the kept input on first access
+        <- block structure (e.g. struct _cshllink_extdatablk_trackdblk * for _CSHLLINK_EDBLK_TrackerDataBlockSig, entry->block of the handler otherwise), NULL on error or if the block is not present
+
+        no load decodes lazily by default: without a skip mask the block was decoded while loading and is only looked up
+        with cshllink_trackDirty, changes made through the block need cshllink_setDirty(inputStruct, CSHLLINK_SEC_EXTRADATA) to be written
+        exact error codes are stored in cshllink_error (0 if the block is not present)
+    */
+    void *cshllink_getBlock(cshllink *inputStruct, uint32_t BlockSignature);
+
+    /*
+        -> BlockSignature 0xA00000xx not known to this library
+        -> handler (copied, read, write and size are required), NULL removes the handler
+        -- blocks of this signature are decoded by handler->read on load and encoded by handler->write, instead of being copied verbatim
+        <- on error this function will return -1, on success 0
+
+        the table is shared by all threads and may be changed while other threads load: loads already running keep the handlers they started with
+        every call allocates a copy of the table (8 KB, never released), keep the handler as long as structures decoded with it exist
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_registerBlock(uint32_t BlockSignature, const cshllink_blockhandler *handler);
+
+    /*
+        read IDList ("size" in bytes without the TerminalBlock)
+    */
+    uint8_t _cshllink_readIDList(struct _cshllink_lnktidl_idl *list, int size, struct _cshllink_cursor *cur);
+
+    /*
+        read / skip "size" bytes of the cursor (bounds-checked)
+    */
+    uint8_t _cshllink_cread(struct _cshllink_cursor *cur, void *dest, size_t size);
+    uint8_t _cshllink_cskip(struct _cshllink_cursor *cur, size_t size);
+    /*
+        reference "size" bytes of the cursor without copying (bounds-checked)
+    */
+    uint8_t _cshllink_cref(struct _cshllink_cursor *cur, const void **dest, size_t size);
 
     /*
         -> open file descriptor of type FILE (W mode)
@@ -1087,14 +1995,122 @@
         -- writes content to file
         <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
 
+        all sections are encoded from the structure; after cshllink_trackDirty the sections not modified since loading are copied from the input byte for byte
         exact error codes are stored in cshllink_error
     */
     uint8_t cshllink_writeFile(FILE *fp, cshllink *inputStruct);
+    /*
+        same as cshllink_writeFile, the error code and position are also stored in ctx (may be NULL)
+    */
+    uint8_t cshllink_writeFileCtx(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx);
     
     /*
         Processes outputFile
     */
     uint8_t cshllink_writeFile_i(FILE *fp, cshllink *inputStruct);
+    uint8_t _cshllink_writeFile(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx);
+    uint8_t _cshllink_writeFileChecked(FILE *fp, cshllink *inputStruct, cshllink_ctx *ctx);
+
+    /*
+        -> open file descriptor (write access, regular file)
+        -> cshllink structure pointer
+        -- writes content to the start of the file with a single pwritev (heap buffers of inputStruct are not copied) and truncates the file to the written length
+        <- on error this function will return -1 (the content of the file is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_writeFd(int fd, cshllink *inputStruct);
+
+    /*
+        -> cshllink structure pointer
+        -- computes the exact number of bytes cshllink_writeBuffer / cshllink_writeFile emit for inputStruct (from the header flags, IDList items, LinkInfo, StringData and ExtraDataBlocks, the input size of sections copied verbatim)
+        <- size in bytes, 0 on error
+
+        exact error codes are stored in cshllink_error
+    */
+    size_t cshllink_serializedSize(const cshllink *inputStruct);
+
+    /*
+        size helpers for cshllink_serializedSize (IDList items + TerminalBlock, NULL terminated strings)
+    */
+    size_t _cshllink_sizeIDList(const struct _cshllink_lnktidl_idl *list);
+    size_t _cshllink_sizeNULLstr(const char *str);
+    size_t _cshllink_sizeNULLwstr(const char16_t *str);
+
+    /*
+        -> cshllink structure pointer
+        -> output buffer
+        -> size of the output buffer in bytes (at least cshllink_serializedSize(inputStruct))
+        -> optional pointer receiving the number of bytes written (may be NULL)
+        -- serializes inputStruct into the buffer in one pass (no stdio involved)
+        <- on error this function will return -1 (the content of the buffer is undefined), on success 0
+
+        after cshllink_trackDirty the sections not modified since loading are copied from the input, see cshllink_writeFile
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_writeBuffer(cshllink *inputStruct, uint8_t *data, size_t size, size_t *written);
+    /*
+        same as cshllink_writeBuffer, the error code and position are also stored in ctx (may be NULL)
+    */
+    uint8_t cshllink_writeBufferCtx(cshllink *inputStruct, uint8_t *data, size_t size, size_t *written, cshllink_ctx *ctx);
+    uint8_t _cshllink_writeBufferChecked(cshllink *inputStruct, uint8_t *data, size_t size, size_t *written, cshllink_ctx *ctx);
+
+    /*
+        Processes output cursor (shared by all write functions)
+    */
+    uint8_t _cshllink_serialize(struct _cshllink_ocursor *cur, cshllink *inputStruct);
+    uint8_t _cshllink_serializeSections(struct _cshllink_ocursor *cur, cshllink *inputStruct);
+
+    /*
+        Section write functions
+    */
+    uint8_t _cshllink_writeHeader(cshllink *inputStruct, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeLinkTargetIDList(cshllink *inputStruct, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeLinkInfo(cshllink *inputStruct, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeStringData(cshllink *inputStruct, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeExtraData(cshllink *inputStruct, struct _cshllink_ocursor *cur);
+    /*
+        true if writing cshllink_edblklist in order gives the fixed order (no block from raw, ascending positions, no block added by the setters)
+    */
+    int _cshllink_fixedOrder(const cshllink *inputStruct);
+    /*
+        write the ExtraDataBlocks of cshllink_edblklist in input order, then the blocks added by the setters in the fixed order
+    */
+    uint8_t _cshllink_writeListed(cshllink *inputStruct, struct _cshllink_ocursor *cur);
+    /*
+        encode an ExtraDataBlock with its handler (entry is NULL for a known block added by the setters, nothing is written for a known block that is not present)
+    */
+    uint8_t _cshllink_writeBlock(cshllink *inputStruct, struct _cshllink_edblkent *entry, uint32_t BlockSignature, struct _cshllink_ocursor *cur);
+    /*
+        true if the block of cshllink_edblklist is written from raw (no handler, or skipped and not decoded yet)
+    */
+    int _cshllink_rawBlock(const cshllink *inputStruct, const struct _cshllink_edblkent *entry);
+    /*
+        skipped sections (cshllink_skipped) that cannot be written back (skipped blocks with kept raw bytes and unmodified sections are copied)
+    */
+    uint32_t _cshllink_unwritable(const cshllink *inputStruct);
+    /*
+        skipped sections that cannot be written back if the sections "verbatim" (CSHLLINK_SEC_*) are copied from the input
+    */
+    uint32_t _cshllink_unwritableWith(const cshllink *inputStruct, uint32_t verbatim);
+    /*
+        sections (CSHLLINK_SEC_*) copied from cshllink_input by the writers (cshllink_trackDirty only): indexed and not modified since loading (cshllink_dirty, idl_dirty)
+        the header is copied while its fields encode to the input bytes, the other sections also need the LinkFlags bits that decide their presence and strings unchanged
+    */
+    uint32_t _cshllink_verbatim(const cshllink *inputStruct);
+    /*
+        write the current section (cur->section) from cshllink_input
+    */
+    uint8_t _cshllink_writeVerbatim(cshllink *inputStruct, struct _cshllink_ocursor *cur);
+
+    /*
+        write "size" bytes to the cursor (bounds-checked)
+    */
+    uint8_t _cshllink_cwrite(struct _cshllink_ocursor *cur, const void *src, size_t size);
+    /*
+        write "size" bytes of a buffer that outlives the cursor (referenced instead of copied in gather mode)
+    */
+    uint8_t _cshllink_cwriteRef(struct _cshllink_ocursor *cur, const void *src, size_t size);
     
     /*
         Converts little Endian to big Endian and vice versa
@@ -1102,73 +2118,252 @@
     void cshllink_sEndian(void *inp, size_t size);
     
     /*
-        read NULL terminated String
+        read NULL terminated String (referenced instead of copied if the cursor borrows the current section)
+        the terminator is searched in the input (memchr / _cshllink_scan16), the string is allocated once
     */
-    uint32_t cshllink_rNULLstr(char **dest, uint8_t errv1, uint8_t errv2, FILE *fp);
-    uint32_t cshllink_rNULLwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, FILE *fp);
+    uint32_t cshllink_rNULLstr(char **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_cursor *cur);
+    uint32_t cshllink_rNULLwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_cursor *cur);
     
     /*
-        read String
+        read String (referenced instead of copied if the cursor borrows the current section)
     */
-    uint32_t cshllink_rstr(char **dest, uint8_t errv1, uint8_t errv2, FILE *fp, size_t size);
-    uint32_t cshllink_rwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, FILE *fp, size_t size);
+    uint32_t cshllink_rstr(char **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_cursor *cur, size_t size);
+    uint32_t cshllink_rwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_cursor *cur, size_t size);
 
     /*
         write NULL terminated String
     */
-    uint32_t cshllink_wNULLstr(char **dest, uint8_t errv1, uint8_t errv2, FILE *fp);
-    uint32_t cshllink_wNULLwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, FILE *fp);
+    uint32_t cshllink_wNULLstr(char **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_ocursor *cur);
+    uint32_t cshllink_wNULLwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_ocursor *cur);
     
     /*
         write String
     */
-    uint32_t cshllink_wstr(char **dest, uint8_t errv1, uint8_t errv2, FILE *fp, size_t size);
-    uint32_t cshllink_wwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, FILE *fp, size_t size);
+    uint32_t cshllink_wstr(char **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_ocursor *cur, size_t size);
+    uint32_t cshllink_wwstr(char16_t **dest, uint8_t errv1, uint8_t errv2, struct _cshllink_ocursor *cur, size_t size);
+
+    /*
+        read / write the body of an ExtraDataBlock with a fixed layout (BlockSize: layout->size + 8), the writer emits BlockSize, BlockSignature and the body with one write
+    */
+    uint8_t _cshllink_readFixedBlock(const struct _cshllink_layout *layout, void *block, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_writeFixedBlock(const struct _cshllink_layout *layout, const struct _cshllink_extdatablk_blk_info *info, const void *block, struct _cshllink_ocursor *cur);
 
     /*
         Extra Data Block read functions
     */
-    uint8_t _cshllink_readEConsoleDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readEConsoleFEDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readEDarwinDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readEEnvironmentVariableDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readEIconEnvironmentDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readEKnownFolderDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readEPropertyStoreDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readEShimDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readESpecialFolderDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readETrackerDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
-    uint8_t _cshllink_readEVistaAndAboveIDListDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, FILE *fp);
+    uint8_t _cshllink_readEConsoleDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readEConsoleFEDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readEDarwinDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readEEnvironmentVariableDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readEIconEnvironmentDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readEKnownFolderDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readEPropertyStoreDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readEShimDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readESpecialFolderDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readETrackerDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
+    uint8_t _cshllink_readEVistaAndAboveIDListDataBlock(cshllink **input, const struct _cshllink_extdatablk_blk_info info, struct _cshllink_cursor *cur);
 
     /*
         Extra Data Block write functions
     */
-    uint8_t _cshllink_writeEConsoleDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeEConsoleFEDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeEDarwinDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeEEnvironmentVariableDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeEIconEnvironmentDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeEKnownFolderDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeEPropertyStoreDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeEShimDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeESpecialFolderDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeETrackerDataBlock(cshllink **input, FILE *fp);
-    uint8_t _cshllink_writeEVistaAndAboveIDListDataBlock(cshllink **input, FILE *fp);
+    uint8_t _cshllink_writeEConsoleDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeEConsoleFEDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeEDarwinDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeEEnvironmentVariableDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeEIconEnvironmentDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeEKnownFolderDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeEPropertyStoreDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeEShimDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeESpecialFolderDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeETrackerDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    uint8_t _cshllink_writeEVistaAndAboveIDListDataBlock(cshllink **input, struct _cshllink_ocursor *cur);
+    /*
+        write the ItemIDs of an IDList (TerminalBlock excluded)
+    */
+    uint8_t _cshllink_writeIDList(const struct _cshllink_lnktidl_idl *list, struct _cshllink_ocursor *cur);
     
     /*
         frees whole structure
     */
     void cshllink_free(cshllink *inputStruct);
+    /*
+        frees all owned heap fields (borrowed fields are skipped)
+    */
+    void _cshllink_freeFields(cshllink *inputStruct);
+    /*
+        releases the blocks decoded by registered handlers (cshllink_registerBlock)
+    */
+    void _cshllink_freeBlocks(cshllink *inputStruct);
+
+    /*
+        -> cshllink structure pointer
+        -- copies all borrowed fields (cshllink_loadView / cshllink_loadMapped) into owned heap memory and releases a kept mapping
+        <- on error this function will return -1 (inputStruct is unchanged), on success 0
+
+        called by the setters. The IDList functions only receive the list, call cshllink_detach before using them on a view
+    */
+    uint8_t cshllink_detach(cshllink *inputStruct);
+
+    /*
+        -> cshllink structure pointer
+        -> sections (CSHLLINK_SEC_*) whose fields were changed directly
+        -- marks the sections as modified: the writers encode them from the structure instead of copying them from the loaded input (see cshllink_trackDirty)
+        <- on error this function will return -1, on success 0
+
+        the setters and the IDList functions mark their sections themselves. Header fields need no call, they are compared with the input
+    */
+    uint8_t cshllink_setDirty(cshllink *inputStruct, uint32_t sections);
+
+    /*
+        -> cshllink structure pointer (loaded with cshllink_loadView / cshllink_loadMapped keep and not detached yet, or with cshllink_ctx.track)
+        -- opt-in: from now on the writers copy the sections not modified by a setter, an IDList function or cshllink_setDirty from the input instead of encoding them (the input is copied once if the structure is detached later)
+        <- on error this function will return -1 (the input is not kept, e.g. after cshllink_loadBuffer without cshllink_ctx.track), on success 0
+
+        fields changed directly after this call are only written if their section is passed to cshllink_setDirty
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_trackDirty(cshllink *inputStruct);
+
+    /*
+        calls fn for every heap field of sections (CSHLLINK_SEC_*) with its size in bytes (fields may be NULL)
+        IDList and VistaAndAboveIDList offset arrays are not included
+    */
+    // number of fields visited by _cshllink_eachField, plus one for every cshllink_edblklist entry
+    #define _CSHLLINK_FIELD_NUM 30
+    void _cshllink_eachField(cshllink *inputStruct, uint32_t sections, void (*fn)(void **field, size_t size, void *user), void *user);
+    /*
+        _cshllink_eachField callback of cshllink_detach (appends to a _cshllink_fieldlist)
+    */
+    struct _cshllink_fieldlist{
+        void ***fields;
+        size_t *sizes;
+        size_t n;
+    };
+    void _cshllink_collectField(void **field, size_t size, void *user);
+
+    /*
+        -> cshllink structure pointer (loaded or zeroed)
+        -> pool receiving the buffers (NULL: same as cshllink_free)
+        -- clears the content like cshllink_free, but keeps owned heap buffers (strings, blobs, IDList blobs and offset arrays) in pool for cshllink_reload
+        structures of an arena (cshllink_arena) and of another allocator than the buffers already in pool keep nothing
+    */
+    void cshllink_reset(cshllink *inputStruct, cshllink_pool *pool);
+    /*
+        _cshllink_eachField callback of cshllink_reset (keeps the field as spare buffer)
+    */
+    void _cshllink_keepField(void **field, size_t size, void *user);
+    /*
+        -> open file descriptor of type FILE (R mode) / buffer and its size
+        -> cshllink structure pointer (loaded or zeroed, not freed before)
+        -> pool (initialized with {0} or used before)
+        -- same as cshllink_loadFile / cshllink_loadBuffer, but resets inputStruct into pool (cshllink_reset) instead of discarding it: fields are served from the pool when the new content fits
+        <- on error this function will return -1 (the content of inputStruct is undefined), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_reload(FILE *fp, cshllink *inputStruct, cshllink_pool *pool);
+    uint8_t cshllink_reloadBuffer(const uint8_t *data, size_t size, cshllink *inputStruct, cshllink_pool *pool);
 
+    /*
+        spare buffers: keep (frees the buffer if the pool is full), take the smallest buffer of at least "size" bytes (NULL if none)
+    */
+    void _cshllink_spareKeep(cshllink_pool *pool, void *ptr, size_t size);
+    void *_cshllink_spareTake(cshllink_pool *pool, size_t size);
+    /*
+        allocate "size" bytes for the structure read by cur (spare buffers first)
+    */
+    void *_cshllink_curAlloc(struct _cshllink_cursor *cur, size_t size);
 
-    //IDList (also for VistaAndAboveIDList -- param idl pointer)
+    /*
+        -> cshllink structure pointer (loaded)
+        -> compact structure receiving the content
+        -- moves the content of inputStruct into out (heap fields are handed over, not copied), inputStruct is cleared like by cshllink_free and can be loaded again
+        <- on error this function will return -1 (inputStruct is unchanged), on success 0
+
+        the input and the changes tracked by cshllink_trackDirty are not kept (all sections are encoded after cshllink_fromCompact). Fails with 0x2F if skipped sections are only writable from the input
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_toCompact(cshllink *inputStruct, cshllink_compact *out);
+    /*
+        -> compact structure pointer
+        -> cshllink structure receiving the content (not freed before)
+        -- moves the content of in back into out, in is cleared. Does not allocate
+        <- on error this function will return -1, on success 0
+    */
+    uint8_t cshllink_fromCompact(cshllink_compact *in, cshllink *out);
+    /*
+        -> compact structure pointer
+        -- frees all owned heap fields and the cold allocation, in is cleared
+    */
+    void cshllink_freeCompact(cshllink_compact *in);
+    /*
+        -> compact structure pointer
+        -> BlockSignature of the ExtraDataBlock (_CSHLLINK_EDBLK_*Sig)
+        <- block structure (e.g. struct _cshllink_extdatablk_trackdblk * for _CSHLLINK_EDBLK_TrackerDataBlockSig), NULL if the block is not present
+    */
+    void *cshllink_compactBlock(const cshllink_compact *in, uint32_t BlockSignature);
+    /*
+        member of struct _cshllink_extdatablk for an ExtraDataBlock, indexed by the low nibble of its BlockSignature (size 0: no block)
+    */
+    struct _cshllink_edblkmember{
+        uint16_t offset;
+        uint16_t size;
+    };
+    /*
+        true if the "size" bytes at data are all 0
+    */
+    int _cshllink_isZero(const void *data, size_t size);
+
+
+    //IDList container (LinkTargetIDList and VistaAndAboveIDList -- param idl pointer)
+        /*
+            get idl item
+            IN: pointer to IDList; index of the item; size (out, may be NULL): length in bytes of the data (ItemIDSize - 2)
+            OUT: pointer to the data of the item (inside idl_blob)
+                 NULL - Error
+        */
+        const uint8_t *cshllink_IDListItem(const struct _cshllink_lnktidl_idl *list, uint16_t index, uint16_t *size);
+        /*
+            iterate idl items (cshllink_IDListIter, then cshllink_IDListNext until it returns 0)
+            IN: pointer to IDList; iterator / iterator; data (out); size (out): length in bytes of the data (ItemIDSize - 2)
+            OUT: 1 - next item stored in data and size
+                 0 - end of the list
+        */
+        void cshllink_IDListIter(const struct _cshllink_lnktidl_idl *list, cshllink_idl_iter *it);
+        uint8_t cshllink_IDListNext(cshllink_idl_iter *it, const uint8_t **data, uint16_t *size);
+        /*
+            reserve capacity
+            IN: pointer to IDList; number of items; size in bytes of all items (ItemIDSize included)
+            OUT: 0 - Success
+                 255 - Error
+        */
+        uint8_t cshllink_IDListReserve(struct _cshllink_lnktidl_idl *list, uint16_t items, uint32_t bytes);
+        /*
+            replace items: removes "remove" items at index, inserts "num" items there (capacity grows geometrically)
+            IN: pointer to IDList; index; number of items to remove; items to insert (must not point into the list); number of items to insert
+            OUT: 0 - Success
+                 255 - Error (list unchanged)
+
+            lists borrowed from the input (cshllink_loadView / cshllink_loadMapped) fail with _CSHLLINK_ERR_NULLPIDLM, call cshllink_detach first
+            the functions below are shorthands. They do not touch idl_size / BlockSize: the cshllink_*IDListItem functions update them and the writers derive them from idl_bloblen
+        */
+        uint8_t cshllink_IDListSplice(struct _cshllink_lnktidl_idl *list, uint16_t index, uint16_t remove, const cshllink_idl_item *items, uint16_t num);
+        uint8_t cshllink_IDListInsert(struct _cshllink_lnktidl_idl *list, uint16_t index, const cshllink_idl_item *items, uint16_t num);
+        uint8_t cshllink_IDListAppend(struct _cshllink_lnktidl_idl *list, const cshllink_idl_item *items, uint16_t num);
+        uint8_t cshllink_IDListErase(struct _cshllink_lnktidl_idl *list, uint16_t index, uint16_t num);
+            /*
+                size in bytes of idl_blob after cshllink_IDListSplice (SIZE_MAX if the arguments are invalid)
+            */
+            size_t _cshllink_IDListSpliceSize(const struct _cshllink_lnktidl_idl *list, uint16_t index, uint16_t remove, const cshllink_idl_item *items, uint16_t num);
+
+    //IDList
         /*
             set idl item
             IN: pointer to IDL item; data for item; length in bytes of data;
             OUT: 0 - Success
                  255 - Error
         */
-        uint8_t cshllink_setIDListItem(struct _cshllink_lnktidl *list, uint8_t *data, uint16_t size, uint8_t index);
+        uint8_t cshllink_setIDListItem(struct _cshllink_lnktidl *list, uint8_t *data, uint16_t size, uint16_t index);
         /*
             add idl item
             IN: pointer to List of IDL items; data for new item; length in bytes of data
@@ -1182,30 +2377,11 @@
             OUT: 0 - Success
                  255 - Error
         */
-        uint8_t cshllink_removeIDListItem(struct _cshllink_lnktidl *list, uint8_t index);
-
-            //IDList integ. (also for VistaAndAboveIDList -- param idl pointer)
+        uint8_t cshllink_removeIDListItem(struct _cshllink_lnktidl *list, uint16_t index);
             /*
-                set idl item
-                IN: pointer to IDL item; data for item; length in bytes of data;
-                OUT: 0 - Success
-                    255 - Error
+                splice the list and update idl_size (the list must stay below 64 KiB)
             */
-            uint8_t _cshllink_setIDListItem(struct _cshllink_lnktidl_idl_item *item, uint8_t *data, uint16_t size);
-            /*
-                add idl item
-                IN: pointer to List of IDL items; data for new item; length in bytes of data
-                OUT: 0 - Success
-                    255 - Error
-            */
-            uint8_t _cshllink_addIDListItem(struct _cshllink_lnktidl_idl *list, uint8_t *data, uint16_t size);
-            /*
-                remove idl item
-                IN: pointer to List of IDL items; index to be removed
-                OUT: 0 - Success
-                    255 - Error
-            */
-            uint8_t _cshllink_removeIDListItem(struct _cshllink_lnktidl_idl *list, uint8_t index);
+            uint8_t _cshllink_spliceIDList(struct _cshllink_lnktidl *list, uint16_t index, uint16_t remove, const cshllink_idl_item *items, uint16_t num);
 
     //VOLID and LocalBasePath
         /*
@@ -1284,6 +2460,19 @@
 
 
     //EXTRA DATA
+        /*
+            fixed-size ExtraDataBlock field of "size" bytes for the setters: the array itself with CSHLLINK_INLINE_EXTRADATA, otherwise the field is (re)allocated (NULL on failure, the field is left unchanged)
+        */
+        #ifdef CSHLLINK_INLINE_EXTRADATA
+            #define _cshllink_fixedBuf(inputStruct, field, size) ((void *)(field))
+        #else
+            #define _cshllink_fixedBuf(inputStruct, field, size) _cshllink_reallocField((inputStruct)->cshllink_allocator, (void **)&(field), (size))
+        #endif
+        void *_cshllink_reallocField(const cshllink_allocator *allocator, void **field, size_t size);
+        /*
+            copies "len" units of "width" bytes from src into the fixed buffer dest of "count" units (truncated to keep the NULL terminator) and clears the rest
+        */
+        void _cshllink_setPadded(void *dest, const void *src, size_t len, size_t width, size_t count);
         /*
             disable EXTDB
         */
@@ -1386,7 +2575,7 @@
             OUT: 0 - Success
                  255 - Error
         */
-        uint8_t cshllink_setVistaAndAboveIDListItem(struct _cshllink_extdatablk_viidldblk *viaail, uint8_t *data, uint16_t size, uint8_t index);
+        uint8_t cshllink_setVistaAndAboveIDListItem(struct _cshllink_extdatablk_viidldblk *viaail, uint8_t *data, uint16_t size, uint16_t index);
         /*
             add idl item
             IN: pointer to List of IDL items; data for new item; length in bytes of data
@@ -1400,16 +2589,198 @@
             OUT: 0 - Success
                  255 - Error
         */
-        uint8_t cshllink_removeVistaAndAboveIDListItem(struct _cshllink_extdatablk_viidldblk *viaail, uint8_t index);
+        uint8_t cshllink_removeVistaAndAboveIDListItem(struct _cshllink_extdatablk_viidldblk *viaail, uint16_t index);
+            /*
+                splice the list and update BlockSize
+            */
+            uint8_t _cshllink_spliceVistaAndAboveIDList(struct _cshllink_extdatablk_viidldblk *viaail, uint16_t index, uint16_t remove, const cshllink_idl_item *items, uint16_t num);
 
     /*
-        converts ansi to unicode
+        converts ansi to unicode (bytes are widened as ISO 8859-1, see cshllink_ansiToUtf16 for other code pages)
     */
     uint8_t cshllink_ansiToUni(char16_t *dest, char *src);
 
     /*
-        strlen char16
+        strlen char16 (src may be misaligned, e.g. borrowed from the input)
     */
     size_t cshllink_strlen16(char16_t *src);
 
+    /*
+        string kernels: scalar, SSE2 and AVX2 variants, the unsuffixed functions pick the best one supported by the CPU at runtime
+        - _cshllink_scan16: offset in bytes of the first 16-bit NUL at an even offset of the "size" bytes at data ("size" rounded down to even if there is none)
+        - _cshllink_strlen16: cshllink_strlen16, the vector variants only read aligned blocks and never cross a page past the terminator
+        build with CSHLLINK_NO_SIMD to get the scalar variants only
+    */
+    #if !defined(CSHLLINK_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        #define _CSHLLINK_SIMD_X86
+    #endif
+    size_t _cshllink_scan16(const uint8_t *data, size_t size);
+    size_t _cshllink_scan16Scalar(const uint8_t *data, size_t size);
+    size_t _cshllink_strlen16Scalar(const char16_t *src);
+    #ifdef _CSHLLINK_SIMD_X86
+        size_t _cshllink_scan16SSE2(const uint8_t *data, size_t size);
+        size_t _cshllink_scan16AVX2(const uint8_t *data, size_t size);
+        size_t _cshllink_strlen16SSE2(const char16_t *src);
+        size_t _cshllink_strlen16AVX2(const char16_t *src);
+        /*
+            <- 2 (AVX2), 1 (SSE2) or 0
+        */
+        int _cshllink_simdLevel(void);
+    #endif
+
+    /*
+        UTF-8 copies of the string fields (cshllink_toUtf8), NULL if the field is not present
+    */
+    typedef struct _cshllink_utf8{
+        // StringData
+        char *NameString;
+        char *RelativePath;
+        char *WorkingDir;
+        char *CommandLineArguments;
+        char *IconLocation;
+        // LinkInfo
+        char *LocalBasePathUnicode;
+        char *CommonPathSuffixUnicode;
+        // ExtraData
+        char *FaceName;
+        char *DarwinDataUnicode;
+        char *EnvironmentVariableTargetUnicode;
+        char *IconEnvironmentTargetUnicode;
+        char *LayerName;
+        // ANSI fields (decoded with the code page passed to cshllink_toUtf8CodePage)
+        char *LocalBasePath;
+        char *CommonPathSuffix;
+        char *VolumeLabel;
+        char *NetName;
+        char *DeviceName;
+        char *DarwinDataAnsi;
+        char *EnvironmentVariableTargetAnsi;
+        char *IconEnvironmentTargetAnsi;
+        // Buffer holding all strings if allocated by cshllink_toUtf8 (NULL if provided by the caller), released by cshllink_freeUtf8
+        char *buffer;
+        // Allocator of buffer (NULL: global allocator)
+        const cshllink_allocator *allocator;
+    }cshllink_utf8;
+    // number of fields of cshllink_utf8
+    #define _CSHLLINK_UTF8_NUM 20
+
+    /*
+        -> UTF-16LE string (may be misaligned) and its length in characters
+        -> output buffer and its size in bytes (NULL: only computes the length)
+        -> optional pointer receiving the length in bytes of the UTF-8 string, without the terminator (may be NULL)
+        -- transcodes src to a NUL terminated UTF-8 string, surrogates must form valid pairs. ASCII runs are converted 8 (SSE2) or 16 (AVX2) characters at a time
+        <- on error this function will return -1 (0x30: invalid UTF-16, 0x31: dest too small), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_utf16ToUtf8(const char16_t *src, size_t len, char *dest, size_t size, size_t *written);
+    /*
+        -> cshllink structure pointer
+        -> output structure (pointers to the UTF-8 strings)
+        -> optional buffer for all strings and its size in bytes (NULL: one buffer is allocated with the allocator of inputStruct, release it with cshllink_freeUtf8)
+        -> optional pointer receiving the number of bytes needed for all strings (may be NULL)
+        -- transcodes every Unicode field (StringData, LocalBasePathUnicode, CommonPathSuffixUnicode, ExtraData strings) to a NUL terminated UTF-8 string,
+           the ANSI fields are decoded with the code page of the link (cshllink_codePage, default CSHLLINK_CP_DEFAULT)
+        <- on error this function will return -1 (0x31: buf too small, see needed), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_toUtf8(const cshllink *inputStruct, cshllink_utf8 *out, char *buf, size_t size, size_t *needed);
+    /*
+        cshllink_toUtf8 with the code page of the ANSI fields given by the caller (0: CSHLLINK_CP_DEFAULT)
+        <- on error this function will return -1 (0x31: buf too small, see needed, 0x32: unsupported code page), on success 0
+    */
+    uint8_t cshllink_toUtf8CodePage(const cshllink *inputStruct, uint32_t codePage, cshllink_utf8 *out, char *buf, size_t size, size_t *needed);
+    /*
+        -> output structure of cshllink_toUtf8
+        -- releases the buffer allocated by cshllink_toUtf8 and clears out
+    */
+    void cshllink_freeUtf8(cshllink_utf8 *out);
+        /*
+            cshllink_utf16ToUtf8 with a given kernel level (0: scalar, 1: SSE2, 2: AVX2 -- see _cshllink_simdLevel)
+        */
+        uint8_t _cshllink_utf16ToUtf8Level(const char16_t *src, size_t len, char *dest, size_t size, size_t *written, int level);
+        /*
+            transcodes the character at src[*i] (a surrogate pair takes two), advances *i and *o (dest NULL: counts only)
+            <- 0, _CSHLLINK_ERR_UTF16 or _CSHLLINK_ERR_BUFSIZE
+        */
+        uint8_t _cshllink_utf8Char(const uint8_t *src, size_t len, size_t *i, char *dest, size_t size, size_t *o);
+        /*
+            string fields of inputStruct and their length in characters, dest: field of out, ansi: src is in the code page of the link
+        */
+        struct _cshllink_strfield{
+            const void *src;
+            size_t len;
+            char **dest;
+            uint8_t ansi;
+        };
+        int _cshllink_strFields(const cshllink *inputStruct, cshllink_utf8 *out, struct _cshllink_strfield *fields);
+        #ifdef _CSHLLINK_SIMD_X86
+            /*
+                converts the leading all-ASCII blocks of src (8 / 16 characters) into dest (NULL: counts only, room: bytes available)
+                <- number of characters converted
+            */
+            size_t _cshllink_asciiSSE2(const uint8_t *src, size_t len, char *dest, size_t room);
+            size_t _cshllink_asciiAVX2(const uint8_t *src, size_t len, char *dest, size_t room);
+        #endif
+
+    /*
+        code pages of the ANSI fields (LinkInfo paths, VolumeID label, NetName, DeviceName, ExtraData *Ansi strings)
+
+        supported: 437, 850, 852, 866, 874, 932 (Shift-JIS), 1250-1258, 28591 (ISO 8859-1)
+    */
+    // code page used when neither the caller nor the link (ConsoleFEDataBlock) specify one
+    #define CSHLLINK_CP_DEFAULT 1252
+
+    /*
+        -> cshllink structure pointer
+        -> code page returned if the link has no ConsoleFEDataBlock or its code page is not supported
+        <- ConsoleFEDataBlock.CodePage or fallback
+    */
+    uint32_t cshllink_codePage(const cshllink *inputStruct, uint32_t fallback);
+    /*
+        -> ANSI string and its length in bytes
+        -> code page of src (0: CSHLLINK_CP_DEFAULT)
+        -> output buffer and its size in characters (NULL: only computes the length)
+        -> optional pointer receiving the length in characters of the UTF-16 string, without the terminator (may be NULL)
+        -- decodes src to a NUL terminated UTF-16 string, bytes not defined in the code page decode to U+FFFD. ASCII runs are widened 16 (SSE2) or 32 (AVX2) bytes at a time
+        <- on error this function will return -1 (0x31: dest too small, 0x32: unsupported code page), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_ansiToUtf16(const char *src, size_t len, uint32_t codePage, char16_t *dest, size_t size, size_t *written);
+    /*
+        -> ANSI string and its length in bytes
+        -> code page of src (0: CSHLLINK_CP_DEFAULT)
+        -> output buffer and its size in bytes (NULL: only computes the length)
+        -> optional pointer receiving the length in bytes of the UTF-8 string, without the terminator (may be NULL)
+        -- decodes src to a NUL terminated UTF-8 string, bytes not defined in the code page decode to U+FFFD. ASCII runs are copied 16 (SSE2) or 32 (AVX2) bytes at a time
+        <- on error this function will return -1 (0x31: dest too small, 0x32: unsupported code page), on success 0
+
+        exact error codes are stored in cshllink_error
+    */
+    uint8_t cshllink_ansiToUtf8(const char *src, size_t len, uint32_t codePage, char *dest, size_t size, size_t *written);
+        /*
+            cshllink_ansiToUtf16 (utf8: 0) or cshllink_ansiToUtf8 (utf8: 1) with a given kernel level (0: scalar, 1: SSE2, 2: AVX2 -- see _cshllink_simdLevel)
+        */
+        uint8_t _cshllink_ansiDecodeLevel(const uint8_t *src, size_t len, uint32_t codePage, void *dest, size_t size, size_t *written, int utf8, int level);
+        /*
+            table of the bytes 0x80-0xFF of a single-byte code page, NULL if codePage is not one
+        */
+        const uint16_t *_cshllink_cpTable(uint32_t codePage);
+        /*
+            decodes the character at src[*i] (a double-byte character takes two), advances *i (table: see _cshllink_cpTable, NULL: 932)
+        */
+        uint16_t _cshllink_ansiChar(const uint8_t *src, size_t len, size_t *i, const uint16_t *table);
+        #ifdef _CSHLLINK_SIMD_X86
+            /*
+                copies (UTF-8) or widens (UTF-16) the leading ASCII bytes of src into dest (NULL: counts only, room: characters available), 16 / 32 bytes at a time
+                <- number of bytes converted
+            */
+            size_t _cshllink_copyAsciiSSE2(const uint8_t *src, size_t len, char *dest, size_t room);
+            size_t _cshllink_copyAsciiAVX2(const uint8_t *src, size_t len, char *dest, size_t room);
+            size_t _cshllink_widenSSE2(const uint8_t *src, size_t len, char16_t *dest, size_t room);
+            size_t _cshllink_widenAVX2(const uint8_t *src, size_t len, char16_t *dest, size_t room);
+        #endif
+
 #endif
\ No newline at end of file